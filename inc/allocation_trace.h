@@ -0,0 +1,84 @@
+#ifndef ALLOCATOR_ALLOCATION_TRACE_H
+#define ALLOCATOR_ALLOCATION_TRACE_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <string> // Include here all the 'string' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// An allocation trace is the list of all the allocations and deallocations of a real program, in the order they happened. Replaying it shows how an allocator copes with a real workload.
+// The trace is a binary file: a 'trace_header', followed by 'trace_record's of 32 bytes each. The records are written by the recorder library, that you preload in your program:
+//     LD_PRELOAD=./libALLOCATION_TRACE_RECORDER.so ALLOCATION_TRACE_FILE=service.trace ./service
+// The identifier of a record is the address that 'malloc' returned. An address is used again after it is freed, so an identifier only means something during the lifetime of its allocation.
+// A deallocation does not know its size, only the allocation does. The replayer looks it up, so that also the sized deallocations of the allocators in this project can be replayed.
+// A trace is loaded by mapping the file with 'mmap'. Nothing is copied, so also a trace of several gigabytes loads right away, the pages are read while the trace is replayed.
+// The file may be cut off in the middle of a record, for instance when the recorded program crashed. Such a last record is ignored.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This enumeration class 'trace_operation' tells what a single record of an allocation trace did.
+enum class trace_operation : std::uint8_t {
+    allocate, // A new allocation of 'm_size' bytes, at the address 'm_identifier'.
+    deallocate // The allocation at the address 'm_identifier' is given back.
+};
+
+/// This structure 'trace_header' is the start of every trace file.
+struct trace_header {
+    char m_magic[8]{'A', 'L', 'L', 'O', 'C', 'T', 'R', 'C'}; // This field recognises a trace file.
+    std::uint32_t m_version{1}; // This field is the version of the format.
+    std::uint32_t m_record_size{32}; // This field is the number of bytes of a single record, so that a newer record can be recognised.
+};
+
+/// This structure 'trace_record' is a single allocation or deallocation within a trace file.
+struct trace_record {
+    std::uint64_t m_timestamp; // The time of the call, in nanoseconds since the start of the recording.
+    std::uint64_t m_identifier; // The allocation this record belongs to, the address that was returned.
+    std::uint64_t m_size; // The number of bytes of an allocation. It is zero for a deallocation.
+    std::uint32_t m_thread; // The thread that made the call.
+    trace_operation m_operation; // What the call did.
+    std::uint8_t m_padding[3]; // This keeps the record at 32 bytes, without any undefined bytes in the file.
+};
+
+static_assert(sizeof(trace_header) == 16, "The header of a trace file must be exactly 16 bytes.");
+static_assert(sizeof(trace_record) == 32, "A record of a trace file must be exactly 32 bytes.");
+
+/// This is the class 'allocation_trace'. It maps a trace file into memory, and hands out its records.
+class allocation_trace {
+public:
+    /// This is the constructor of the 'allocation_trace' class. It maps the trace file, and checks its header.
+    /// \param trace_path The path of the trace file. When it can not be mapped, or is no trace, an 'std::runtime_error' is thrown.
+    explicit allocation_trace(const std::string& trace_path);
+
+    /// This is the destructor of the 'allocation_trace' class. It unmaps the trace file.
+    ~allocation_trace();
+
+    /// A trace can not be copied, because only one of the copies may unmap the file.
+    allocation_trace(const allocation_trace&) = delete;
+
+    /// A trace can not be copied, because only one of the copies may unmap the file.
+    allocation_trace& operator=(const allocation_trace&) = delete;
+
+    /// This method returns the first record of the trace.
+    /// \return A pointer to the first record, within the mapped file.
+    [[nodiscard]] const trace_record* begin() const noexcept;
+
+    /// This method returns the end of the records of the trace.
+    /// \return A pointer just past the last complete record.
+    [[nodiscard]] const trace_record* end() const noexcept;
+
+    /// This method returns the number of complete records of the trace.
+    /// \return The number of records.
+    [[nodiscard]] std::size_t size() const noexcept;
+
+    /// This static method writes a trace file, for instance a trace that is generated instead of recorded.
+    /// \param trace_path The path of the trace file. It is overwritten. When it can not be written, an 'std::runtime_error' is thrown.
+    /// \param records All the records of the trace, in the order they happened.
+    static void write(const std::string& trace_path, const std::vector<trace_record>& records);
+
+private:
+    void* m_mapped_file; // This field is the first address of the mapped file.
+    std::size_t m_file_size; // This field is the number of bytes of the mapped file.
+    std::size_t m_number_of_records; // This field is the number of complete records after the header.
+};
+
+#endif
@@ -3,40 +3,36 @@
 
 #include <iostream> // Include here all the 'iostream' facilities.
 #include <vector> // Include here all the 'vector' facilities.
+#include <deque> // Include here all the 'deque' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
 #include <chrono> // Include here all the 'chrono' facilities.
 #include <tuple> // Include here all the 'tuple' facilities.
 #include <numeric> // Include here all the 'numeric' facilities.
+#include <atomic> // Include here all the 'atomic' facilities.
+#include <mutex> // Include here all the 'mutex' facilities.
+#include <thread> // Include here all the 'thread' facilities.
+#include <map> // Include here all the 'map' facilities.
+#include <random> // Include here all the 'random' facilities.
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <array> // Include here all the 'array' facilities.
+#include <barrier> // Include here all the 'barrier' facilities.
+#include <malloc.h> // Include here all the 'malloc' facilities.
 
 #include "pool_allocator.h" // Include here all the 'pool_allocator' facilities.
+#include "concurrent_pool_allocator.h" // Include here all the 'concurrent_pool_allocator' facilities.
 #include "malloc_allocator.h" // Include here all the 'malloc_allocator' facilities.
 #include "mmap_allocator.h" // Include here all the 'mmap_allocator' facilities.
 #include "new_allocator.h" // Include here all the 'new_allocator' facilities.
+#include "size_class_allocator.h" // Include here all the 'size_class_allocator' facilities.
+#include "pool_node_allocator.h" // Include here all the 'pool_node_allocator' facilities.
+#include "arena_allocator.h" // Include here all the 'arena_allocator' facilities.
+#include "memory_resources.h" // Include here all the 'memory_resources' facilities.
+#include "growable_vector.h" // Include here all the 'growable_vector' facilities.
 
 #include "benchmark_statistics.h" // Include here all the 'benchmark_statistics' facilities.
-
-/// This structure 'average_running_time' is used to calculate the average running time for various runs of the benchmarker.
-struct average_running_time {
-public:
-    /// This operator overloaded function is used to calculate the sum, and number of runnings for the benchmarker.
-    /// \param summing_value The value that has to be summed up.
-    /// \return The current instance of this structure.
-    average_running_time& operator+(const std::size_t& summing_value) {
-        m_total_running_time += summing_value; // Add all the values.
-        m_number_of_runnings++; // Increment the number of runnings.
-
-        return *this;
-    }
-
-    /// This operator overloading returns the average value.
-    /// \return The average value calculated for different runs.
-    explicit operator double() const {
-        return (double)m_total_running_time / (double)m_number_of_runnings; // Return the average running time.
-    }
-
-private:
-    std::size_t m_total_running_time{}; // This field contains the total running time.
-    std::size_t m_number_of_runnings{}; // This field contains the total number of runnings.
-};
+#include "benchmark_engine.h" // Include here all the 'benchmark_engine' facilities.
+#include "trace_replayer.h" // Include here all the 'trace_replayer' facilities.
+#include "pattern_generator.h" // Include here all the 'pattern_generator' facilities.
 
 /// This class 'allocator_benchmark' is used for benchmarking different types of allocators.
 class allocator_benchmark {
@@ -44,7 +40,9 @@ public:
     /// This is the constructor of the 'allocator_benchmark' class.
     /// \param elements_list A list with the number of elements to benchmark for.
     /// \param run_list  A list for the number of runnings to benchmark for.
-    allocator_benchmark(const std::initializer_list<std::size_t>& elements_list, const std::initializer_list<std::size_t>& run_list);
+    /// \param number_of_threads The number of threads used by the multi-threaded benchmarks.
+    /// \param options The options of the engine that measures the allocators, for instance the number of samples.
+    allocator_benchmark(const std::initializer_list<std::size_t>& elements_list, const std::initializer_list<std::size_t>& run_list, const std::size_t& number_of_threads = 4, const benchmark_options& options = {});
 
     /// This method benchmarks the memory pool allocator.
     /// \return The statistics generated by this benchmarker.
@@ -58,14 +56,775 @@ public:
     /// \return The statistics generated by this benchmarker.
     [[nodiscard]] benchmark_statistics benchmark_memory_mmap() const;
 
+    /// This method benchmarks the 'mmap' allocator with a cache of mapped regions. It allocates the same sizes as the 'mmap' benchmark.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_memory_mmap_cached() const;
+
     /// This method benchmarks the 'new' allocator.
     /// \return The statistics generated by this benchmarker.
     [[nodiscard]] benchmark_statistics benchmark_memory_new() const;
 
+    /// This method benchmarks the size class allocator. It allocates the same sizes as the 'malloc' benchmark.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_memory_size_class() const;
+
+    /// This method benchmarks the monotonic arena allocator. Instead of deallocating every address, the arena is reset once.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_memory_arena() const;
+
+    /// This method benchmarks the polymorphic memory resource with memory pools.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pmr_pool() const;
+
+    /// This method benchmarks the 'std::pmr::unsynchronized_pool_resource' of the standard library.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pmr_std_pool() const;
+
+    /// This method benchmarks the polymorphic memory resource with a monotonic arena.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pmr_arena() const;
+
+    /// This method benchmarks the 'std::pmr::monotonic_buffer_resource' of the standard library.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pmr_std_monotonic() const;
+
+    /// This method benchmarks visiting pooled objects in a random order, with the blocks of the memory pool allocator on normal pages.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_traversal_normal_pages() const;
+
+    /// This method benchmarks visiting pooled objects in a random order, with the blocks of the memory pool allocator on huge pages.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_traversal_huge_pages() const;
+
+    /// This method benchmarks a memory pool allocator that grows into the millions of chunks, whereby every block has the same size.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_growth_fixed() const;
+
+    /// This method benchmarks a memory pool allocator that grows into the millions of chunks, whereby every block is twice as big as the one before.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_growth_geometric() const;
+
+    /// This method benchmarks the latency of single allocations, whereby every new block of the memory pool allocator is linked at once.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_fill_linked() const;
+
+    /// This method benchmarks the latency of single allocations, whereby the chunks of a new block of the memory pool allocator are carved lazily.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_fill_lazy() const;
+
+    /// This method benchmarks the latency of single allocations, whereby every new block of the memory pool allocator is prefaulted.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_fill_prefaulted() const;
+
+    /// This method benchmarks updating a counter per thread, whereby the counters are pooled next to each other, so that they share a cache line (false sharing).
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_counters_packed() const;
+
+    /// This method benchmarks updating a counter per thread, whereby every pooled counter is aligned to a cache line of its own.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_counters_aligned() const;
+
+    /// This method benchmarks batches of chunks, whereby every chunk is allocated and deallocated on its own.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_batch_loop() const;
+
+    /// This method benchmarks batches of chunks, whereby every batch is allocated and deallocated at once.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_batch_bulk() const;
+
+    /// This method benchmarks inserting and erasing elements of an 'std::map' with the standard allocator.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_map_std_allocator() const;
+
+    /// This method benchmarks inserting and erasing elements of an 'std::map' with the memory pool node adapter.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_map_pool_node() const;
+
+    /// This method benchmarks the memory pool allocator shared by multiple threads, whereby every call is protected by a mutex.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_memory_pool_mutex() const;
+
+    /// This method benchmarks the concurrent memory pool allocator shared by multiple threads, whereby every call goes to its lock-free free list.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_memory_pool_lock_free() const;
+
+    /// This method benchmarks a growing buffer of integers in an 'std::vector' with the 'mmap' allocator. Every growth copies all the elements.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_buffer_vector() const;
+
+    /// This method benchmarks a growing buffer of integers in a 'growable_vector' with the 'mmap' allocator. Every growth is done in place or by 'mremap'.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_buffer_growable() const;
+
+    /// This method benchmarks strings in memory of 'new[]', whereby every string is default constructed first, and then assigned.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_objects_new_array() const;
+
+    /// This method benchmarks strings in raw memory of the 'new' allocator, whereby every string is constructed only once.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_objects_new_raw() const;
+
+    /// This method benchmarks the memory pool allocator without any checks, as the reference for the debug modes.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_debug_none() const;
+
+    /// This method benchmarks the guarded memory pool allocator, that checks every allocation and deallocation.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_debug_guarded() const;
+
+    /// This method benchmarks the guarded memory pool allocator, whereby every block is also followed by a guard page.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_debug_guard_pages() const;
+
+    /// This method replays an allocation trace against the 'malloc' memory resource.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_trace_malloc() const;
+
+    /// This method replays an allocation trace against the 'new' memory resource.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_trace_new() const;
+
+    /// This method replays an allocation trace against the memory resource with memory pools.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_trace_pool() const;
+
+    /// This method replays an allocation trace against the memory resource with a monotonic arena.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_trace_arena() const;
+
+    /// This method replays an allocation trace against the pool resource of the standard library.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_trace_std_pool() const;
+
+    /// This method replays all the generated patterns against the memory pool allocator. A chunk only has a single size, so only the fixed size is replayed.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pattern_pool() const;
+
+    /// This method replays all the generated patterns, with all the distributions of sizes, against the 'malloc' allocator.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pattern_malloc() const;
+
+    /// This method replays all the generated patterns, with all the distributions of sizes, against the 'new' allocator.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pattern_new() const;
+
+    /// This method replays all the generated patterns, with all the distributions of sizes, against the size class allocator.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pattern_size_class() const;
+
+    /// This method replays all the generated patterns, with all the distributions of sizes, against the pool resource of the standard library.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_pattern_std_pool() const;
+
+    /// This method sweeps the memory pool allocator behind a mutex over the numbers of threads of the options.
+    /// \return The statistics generated by this benchmarker, the throughput in million calls per second for every number of threads.
+    [[nodiscard]] benchmark_statistics benchmark_scalability_pool_mutex() const;
+
+    /// This method sweeps the concurrent memory pool allocator with magazines over the numbers of threads of the options.
+    /// \return The statistics generated by this benchmarker, the throughput in million calls per second for every number of threads.
+    [[nodiscard]] benchmark_statistics benchmark_scalability_pool_magazines() const;
+
+    /// This method sweeps the concurrent memory pool allocator without magazines, so only with its lock-free free list, over the numbers of threads of the options.
+    /// \return The statistics generated by this benchmarker, the throughput in million calls per second for every number of threads.
+    [[nodiscard]] benchmark_statistics benchmark_scalability_pool_lock_free() const;
+
+    /// This method sweeps the 'malloc' allocator over the numbers of threads of the options.
+    /// \return The statistics generated by this benchmarker, the throughput in million calls per second for every number of threads.
+    [[nodiscard]] benchmark_statistics benchmark_scalability_malloc() const;
+
+    /// This method sweeps the 'new' allocator over the numbers of threads of the options.
+    /// \return The statistics generated by this benchmarker, the throughput in million calls per second for every number of threads.
+    [[nodiscard]] benchmark_statistics benchmark_scalability_new() const;
+
 private:
+    /// This method runs the same worker on multiple threads at the same time, and measures how long it takes until all the threads are finished.
+    /// \tparam Worker The type of the worker. It is called with the index of its thread.
+    /// \param worker The worker that every thread runs.
+    /// \return The elapsed time in nanoseconds. The creation of the threads is not included.
+    template <typename Worker>
+    [[nodiscard]] double run_on_threads(Worker worker) const;
+
+    /// This structure 'thread_timings' contains how long a run on multiple threads took, in total and for every single thread.
+    struct thread_timings {
+        double m_elapsed; // The time until all the threads are finished, in nanoseconds.
+        std::vector<double> m_thread_durations; // The time until every single thread is finished, in nanoseconds. All the threads start at the same time.
+    };
+
+    /// This method runs the same worker on any number of threads at the same time, and measures how long it takes until every single thread is finished.
+    /// \tparam Worker The type of the worker. It is called with the index of its thread.
+    /// \param number_of_threads The number of threads.
+    /// \param pin_threads True if every thread must be pinned to a core.
+    /// \param worker The worker that every thread runs.
+    /// \return The elapsed time of all the threads, and of every single thread. The creation of the threads is not included.
+    template <typename Worker>
+    [[nodiscard]] thread_timings run_threads(std::size_t number_of_threads, bool pin_threads, Worker worker) const;
+
+    /// This method pins a thread to a single core. The threads go round robin over the cores of the machine.
+    /// \param worker_thread The thread that is pinned.
+    /// \param thread_index The index of the thread.
+    static void pin_thread(std::thread& worker_thread, std::size_t thread_index);
+
+    /// This method adds the summary of the samples of a single run to the statistic, and shows it. The median is the result, in microseconds.
+    /// \param statistic The statistic the result is added to.
+    /// \param result_name The name of the result.
+    /// \param single_run The number of runs of the result.
+    /// \param summary The statistics of the samples of the run, in nanoseconds.
+    static void add_summary(benchmark_statistics& statistic, const std::string& result_name, std::size_t single_run, const benchmark_summary& summary);
+
+    /// This method times every single allocate call, and then every single deallocate call, and adds their latencies to the histograms of the statistic.
+    /// \tparam Allocate The type of the allocate call. It is called with the index of the address to allocate.
+    /// \tparam Deallocate The type of the deallocate call. It is called with the index of the address to deallocate.
+    /// \param statistic The statistic the latencies are added to.
+    /// \param number_of_calls The number of allocate calls, and of deallocate calls.
+    /// \param allocate The allocate call.
+    /// \param deallocate The deallocate call.
+    template <typename Allocate, typename Deallocate>
+    void record_latencies(benchmark_statistics& statistic, std::size_t number_of_calls, Allocate allocate, Deallocate deallocate) const;
+
+    /// This method shows the percentiles of the latencies of single calls, if any latencies are recorded.
+    /// \param statistic The statistic with the latency histograms.
+    static void print_latencies(const benchmark_statistics& statistic);
+
+    /// This method benchmarks a polymorphic memory resource. A resource is created for every memory size before anything is measured, and used through an 'std::pmr::polymorphic_allocator'.
+    /// \tparam Resource The type of the memory resource.
+    /// \param identifier The identifier for the statistic of this resource.
+    /// \param resource_name The name of the resource, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    template <typename Resource>
+    [[nodiscard]] benchmark_statistics benchmark_memory_resource(const benchmark_statistics::statistics_recognition& identifier, const std::string& resource_name) const;
+
+    /// This method benchmarks visiting pooled objects in a random order. The number of objects is the number of runs times 'objects_per_run', so that they span much more memory than the TLB covers.
+    /// \param identifier The identifier for the statistic of this traversal.
+    /// \param mode The pages that back the blocks of the memory pool allocator.
+    /// \param traversal_name The name of the traversal, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_traversal(const benchmark_statistics::statistics_recognition& identifier, page_mode mode, const std::string& traversal_name) const;
+
+    /// This method benchmarks a memory pool allocator that grows from a small first block to 'chunks_per_run' times the number of runs. It also shows the number of system calls it took.
+    /// \param identifier The identifier for the statistic of this growth.
+    /// \param growth_factor The factor by which every new block grows.
+    /// \param growth_name The name of the growth, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_growth(const benchmark_statistics::statistics_recognition& identifier, std::size_t growth_factor, const std::string& growth_name) const;
+
+    /// This method benchmarks the latency of every single allocation from a memory pool allocator with blocks of 2 MiB. Besides the total time, it shows the 99th percentile and the worst latency.
+    /// \param identifier The identifier for the statistic of this fill mode.
+    /// \param fill_mode How a new block of the memory pool allocator is prepared.
+    /// \param fill_name The name of the fill mode, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_fill(const benchmark_statistics::statistics_recognition& identifier, block_fill_mode fill_mode, const std::string& fill_name) const;
+
+    /// This method benchmarks batches of 'chunks_per_run' times the number of runs chunks, from a warm memory pool allocator. Besides the total time, it shows the time per chunk.
+    /// \param identifier The identifier for the statistic of this batch mode.
+    /// \param is_bulk Whether a batch is allocated and deallocated at once, or chunk by chunk.
+    /// \param batch_name The name of the batch mode, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_batch(const benchmark_statistics::statistics_recognition& identifier, bool is_bulk, const std::string& batch_name) const;
+
+    /// This method benchmarks updating a counter per thread. The counters are allocated right after each other from a single memory pool allocator.
+    /// \tparam Alignment The alignment of the chunks of the counters.
+    /// \param identifier The identifier for the statistic of these counters.
+    /// \param counters_name The name of the counters, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    template <std::size_t Alignment>
+    [[nodiscard]] benchmark_statistics benchmark_counters(const benchmark_statistics::statistics_recognition& identifier, const std::string& counters_name) const;
+
+    /// This method benchmarks a buffer that grows one element at a time, to 'elements_per_run' times the number of runs integers (32 MiB at most). It also shows how the buffer grew.
+    /// \param identifier The identifier for the statistic of this buffer.
+    /// \param is_growable Whether the buffer is a 'growable_vector', or an 'std::vector'.
+    /// \param buffer_name The name of the buffer, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_buffer(const benchmark_statistics::statistics_recognition& identifier, bool is_growable, const std::string& buffer_name) const;
+
+    /// This method benchmarks creating and destroying arrays of strings that do not fit in the small buffer of a string, so that constructing one costs an allocation.
+    /// \param identifier The identifier for the statistic of these objects.
+    /// \param is_raw Whether the strings are constructed once in raw memory, or constructed by 'new[]' and assigned afterwards.
+    /// \param objects_name The name of the objects, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_objects(const benchmark_statistics::statistics_recognition& identifier, bool is_raw, const std::string& objects_name) const;
+
+    /// This method benchmarks allocating and deallocating 'chunks_per_run' times the number of runs chunks of 32 bytes, with a debug mode. Every run starts with a new pool, so the blocks are created as well.
+    /// \param identifier The identifier for the statistic of this debug mode.
+    /// \param debug_mode How much the memory pool allocator checks the use of its chunks.
+    /// \param debug_name The name of the debug mode, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    [[nodiscard]] benchmark_statistics benchmark_debug(const benchmark_statistics::statistics_recognition& identifier, pool_debug_mode debug_mode, const std::string& debug_name) const;
+
+    /// This method replays an allocation trace against a memory resource. It shows the throughput, the peak of the resident memory and the fragmentation.
+    /// \tparam Resource The type of the memory resource.
+    /// \param identifier The identifier for the statistic of this resource.
+    /// \param trace_name The name of the replay, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    template <typename Resource>
+    [[nodiscard]] benchmark_statistics benchmark_trace(const benchmark_statistics::statistics_recognition& identifier, const std::string& trace_name) const;
+
+    /// This method loads the allocation trace of a run. This is the trace file of 'ALLOCATION_TRACE' when it is set, otherwise a trace of a service is generated.
+    /// \param single_run The number of runs. A generated trace handles ten requests for every run.
+    /// \return The replayer of the trace.
+    [[nodiscard]] static trace_replayer load_trace(std::size_t single_run);
+
+    /// This method replays every generated pattern, with every distribution of sizes, against an allocator that is created before anything is measured. Every run allocates ten times its number of runs.
+    /// \tparam Replay The type of the replay. It is called with a 'trace_replayer', and replays it against the same allocator every time.
+    /// \param identifier The identifier for the statistic of this allocator.
+    /// \param pattern_name The name of the benchmark, as shown in the messages and the results.
+    /// \param fixed_size_only True if the allocator can only allocate a single size, of 'pattern_fixed_size' bytes.
+    /// \param replay The replay against the allocator.
+    /// \return The statistics generated by this benchmarker.
+    template <typename Replay>
+    [[nodiscard]] benchmark_statistics benchmark_pattern(const benchmark_statistics::statistics_recognition& identifier, const std::string& pattern_name, bool fixed_size_only, Replay replay) const;
+
+    /// This method sweeps an allocator that is shared by all the threads, over the numbers of threads of the options. Every number of threads runs a local and a cross-thread scenario.
+    /// In the local scenario, every thread frees its own chunks. In the cross-thread scenario, every thread frees the chunks of the thread before it, in a ring.
+    /// \tparam SharedAllocator The type of the shared allocator. It has a default constructor, 'void* allocate()' and 'void deallocate(void*)', that can be called from any thread.
+    /// \param identifier The identifier for the statistic of this allocator.
+    /// \param scalability_name The name of the benchmark, as shown in the messages and the results.
+    /// \return The statistics generated by this benchmarker.
+    template <typename SharedAllocator>
+    [[nodiscard]] benchmark_statistics benchmark_scalability(const benchmark_statistics::statistics_recognition& identifier, const std::string& scalability_name) const;
+
+    /// The number of rounds of every thread in a scalability run. Every round allocates a batch of chunks, and frees a batch.
+    static constexpr std::size_t scalability_rounds = 64;
+
+    /// The number of chunks of every batch in a scalability run.
+    static constexpr std::size_t scalability_batch_size = 256;
+
+    /// The number of times every number of threads is run. The median of the runs is the result.
+    static constexpr std::size_t scalability_repetitions = 5;
+
+    /// This structure 'shared_locked_pool' shares a memory pool allocator between all the threads, behind a mutex.
+    struct shared_locked_pool {
+        /// This method allocates a chunk, under the lock.
+        /// \return The address of the chunk.
+        void* allocate();
+
+        /// This method gives a chunk back, under the lock.
+        /// \param memory The address of the chunk.
+        void deallocate(void* memory) noexcept;
+
+        pool_allocator<int> m_pool{1024}; // The memory pool allocator of all the threads.
+        std::mutex m_pool_mutex{}; // This mutex protects the memory pool allocator.
+    };
+
+    /// This structure 'shared_concurrent_pool' shares a concurrent memory pool allocator between all the threads.
+    /// \tparam MagazineCapacity The number of chunks that a single magazine of a thread can hold. With zero, every call uses the lock-free free list.
+    template <std::size_t MagazineCapacity>
+    struct shared_concurrent_pool {
+        /// This method allocates a chunk.
+        /// \return The address of the chunk.
+        void* allocate();
+
+        /// This method gives a chunk back.
+        /// \param memory The address of the chunk.
+        void deallocate(void* memory) noexcept;
+
+        concurrent_pool_allocator<int> m_pool{1024, MagazineCapacity}; // The concurrent memory pool allocator of all the threads.
+    };
+
+    /// This structure 'shared_standard_allocator' shares an allocator without a state, like the 'malloc' allocator, between all the threads.
+    /// \tparam Allocator The type of the allocator, of 'int' elements.
+    template <typename Allocator>
+    struct shared_standard_allocator {
+        /// This method allocates a single element.
+        /// \return The address of the element.
+        void* allocate();
+
+        /// This method gives a single element back.
+        /// \param memory The address of the element.
+        void deallocate(void* memory) noexcept;
+
+        Allocator m_allocator{}; // The allocator of all the threads.
+    };
+
+    /// The size in bytes of every allocation of the fixed distribution, so that the memory pool allocator replays the same calls as the others.
+    static constexpr std::size_t pattern_fixed_size = 64;
+
+    /// This structure 'pool_byte_allocator' lets a memory pool allocator replay a trace, as an allocator of bytes. Every allocation takes a single chunk, so no allocation may be bigger than 'T'.
+    /// \tparam T The type of the chunks of the memory pool allocator.
+    template <typename T>
+    struct pool_byte_allocator {
+        using value_type = std::byte; // The replayer allocates bytes.
+
+        /// This method allocates a single chunk.
+        /// \return The first byte of the chunk.
+        std::byte* allocate(std::size_t);
+
+        /// This method gives a single chunk back.
+        /// \param memory The first byte of the chunk.
+        void deallocate(std::byte* memory, std::size_t) noexcept;
+
+        pool_allocator<T>& m_pool; // The memory pool allocator that hands out the chunks.
+    };
+
     std::vector<std::size_t> m_number_of_runs; // This field contains a vector with the number of runs.
     std::vector<std::size_t> m_number_of_elements; // This field contains a vector with the number of elements.
+    std::size_t m_number_of_threads; // This field contains the number of threads for the multi-threaded benchmarks.
+    benchmark_engine m_engine; // This field is the engine that measures the allocators, and summarises the samples.
 };
 
+// This method runs the same worker on multiple threads at the same time, and measures how long it takes until all the threads are finished.
+template <typename Worker>
+double allocator_benchmark::run_on_threads(Worker worker) const {
+    return run_threads(m_number_of_threads, false, worker).m_elapsed;
+}
+
+// This method times every single allocate call, and then every single deallocate call, and adds their latencies to the histograms of the statistic.
+template <typename Allocate, typename Deallocate>
+void allocator_benchmark::record_latencies(benchmark_statistics& statistic, std::size_t number_of_calls, Allocate allocate, Deallocate deallocate) const {
+    const auto& clock = m_engine.get_clock(); // Reading the time stamp counter disturbs a single call the least.
+    latency_histogram allocate_latencies{}; // The latencies of the allocate calls, recording them does not allocate anything.
+    latency_histogram deallocate_latencies{}; // The latencies of the deallocate calls.
+
+    for (std::size_t i = 0; i < number_of_calls; i++) {
+        auto begin_time = clock.now(); // The start time of this call.
+        allocate(i);
+        auto end_time = clock.now(); // The end time of this call.
+
+        allocate_latencies.record(static_cast<std::uint64_t>(clock.to_nanoseconds(end_time - begin_time)));
+    }
+
+    for (std::size_t i = 0; i < number_of_calls; i++) {
+        auto begin_time = clock.now(); // The start time of this call.
+        deallocate(i);
+        auto end_time = clock.now(); // The end time of this call.
+
+        deallocate_latencies.record(static_cast<std::uint64_t>(clock.to_nanoseconds(end_time - begin_time)));
+    }
+
+    statistic.add_latencies(benchmark_statistics::latency_operation::allocate, allocate_latencies);
+    statistic.add_latencies(benchmark_statistics::latency_operation::deallocate, deallocate_latencies);
+}
+
+// This method benchmarks a polymorphic memory resource. A resource is created for every memory size before anything is measured, and used through an 'std::pmr::polymorphic_allocator'.
+template <typename Resource>
+benchmark_statistics allocator_benchmark::benchmark_memory_resource(const benchmark_statistics::statistics_recognition& identifier, const std::string& resource_name) const {
+    std::cout << "---- BENCHMARK " << resource_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for the memory resource.
+    std::deque<Resource> memory_resources{}; // A memory resource for every memory size, reused by all the iterations.
+
+    for ([[maybe_unused]] const auto& memory_size : m_number_of_elements)
+        memory_resources.emplace_back();
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
+
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (std::size_t size_index = 0; size_index < m_number_of_elements.size(); size_index++) {
+                const auto& memory_size = m_number_of_elements[size_index]; // The number of elements of every allocation.
+                auto& memory_resource = memory_resources[size_index]; // This is our memory resource.
+                std::pmr::polymorphic_allocator<int> memory_polymorphic{&memory_resource}; // This is the allocator that only knows the base class of the resource.
+
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_polymorphic.allocate(memory_size); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_polymorphic.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+
+                // A monotonic resource ignores every deallocation, so it gives its memory back at once, like the arena benchmark.
+                if constexpr (std::is_same_v<Resource, arena_memory_resource>)
+                    memory_resource.get_arena().reset();
+                else if constexpr (std::is_same_v<Resource, std::pmr::monotonic_buffer_resource>)
+                    memory_resource.release();
+            }
+        }, m_number_of_elements.size());
+
+        add_summary(new_statistic, resource_name + "_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                Resource memory_resource{}; // A new memory resource, so that mapping its memory is part of the latencies.
+                std::pmr::polymorphic_allocator<int> memory_polymorphic{&memory_resource}; // This is the allocator that only knows the base class of the resource.
+
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_polymorphic.allocate(memory_size); }, [&] (std::size_t i) { memory_polymorphic.deallocate(assigned_addresses[i], memory_size); });
+            }
+        }
+    }
+
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK " << resource_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks updating a counter per thread. The counters are allocated right after each other from a single memory pool allocator.
+template <std::size_t Alignment>
+benchmark_statistics allocator_benchmark::benchmark_counters(const benchmark_statistics::statistics_recognition& identifier, const std::string& counters_name) const {
+    static constexpr std::size_t updates_per_run = 1000; // The number of updates of every thread for a single run.
+
+    std::cout << "---- BENCHMARK " << counters_name << " (" << m_number_of_threads << " THREADS) ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for these counters.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        // Every memory size is a repetition with new counters.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            pool_allocator<std::uint64_t, Alignment> memory_pool{m_number_of_threads}; // This is our memory pool allocator, all the counters come from the same block.
+            std::vector<chunk<std::uint64_t, Alignment>*> thread_counters{m_number_of_threads}; // The counter of every thread.
+
+            for (auto& single_counter : thread_counters) {
+                single_counter = memory_pool.allocate(); // The chunks follow each other, so without alignment several counters share a cache line.
+                single_counter->m_data = 0;
+            }
+
+            sum_durations.push_back(run_on_threads([&] (std::size_t thread_index) {
+                std::atomic_ref<std::uint64_t> thread_counter{thread_counters[thread_index]->m_data}; // Every update must really write to memory.
+
+                for (std::size_t i = 0; i < single_run * updates_per_run; i++)
+                    thread_counter.fetch_add(1, std::memory_order_relaxed); // Only this thread updates its counter, but the cache line may be shared.
+            }));
+
+            for (auto& free_memory_addresses : thread_counters)
+                memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+        }
+
+        add_summary(new_statistic, "counters_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK " << counters_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+
+// This method replays an allocation trace against a memory resource. It shows the throughput, the peak of the resident memory and the fragmentation.
+template <typename Resource>
+benchmark_statistics allocator_benchmark::benchmark_trace(const benchmark_statistics::statistics_recognition& identifier, const std::string& trace_name) const {
+    std::cout << "---- BENCHMARK " << trace_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for the replays.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        auto replayer = load_trace(single_run); // The trace of this run.
+
+        // A single iteration replays the whole trace against a new resource. The statistics are per call.
+        auto run_summary = m_engine.measure([&] () {
+            Resource memory_resource{}; // This is our memory resource.
+            std::pmr::polymorphic_allocator<std::byte> memory_polymorphic{&memory_resource}; // This is the allocator that only knows the base class of the resource.
+
+            replayer.replay(memory_polymorphic);
+        }, replayer.get_number_of_operations());
+
+        add_summary(new_statistic, trace_name + "_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+
+        // The footprint is measured in a replay of its own, that touches all the allocated memory. 'malloc' first gives back what it kept from the replays before.
+        malloc_trim(0);
+
+        Resource footprint_resource{}; // A new memory resource, that holds no memory yet.
+        std::pmr::polymorphic_allocator<std::byte> footprint_polymorphic{&footprint_resource}; // This is the allocator that only knows the base class of the resource.
+        auto footprint = replayer.measure_footprint(footprint_polymorphic); // The memory that the replay needed.
+
+        std::cout << "Replayed " << replayer.get_number_of_operations() << " calls of " << replayer.get_number_of_threads() << " threads, throughput: " << 1000.0 / run_summary.m_median << " million calls per second" << std::endl;
+        std::cout << "Peak allocated: " << footprint.m_peak_live_bytes / 1024 << " KiB, peak resident growth: " << footprint.m_peak_resident_bytes / 1024 << " KiB, fragmentation: " << footprint.m_fragmentation * 100.0 << " %" << std::endl;
+    }
+
+    std::cout << "---- END BENCHMARK " << trace_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method replays every generated pattern, with every distribution of sizes, against an allocator that is created before anything is measured. Every run allocates ten times its number of runs.
+template <typename Replay>
+benchmark_statistics allocator_benchmark::benchmark_pattern(const benchmark_statistics::statistics_recognition& identifier, const std::string& pattern_name, bool fixed_size_only, Replay replay) const {
+    std::cout << "---- BENCHMARK " << pattern_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for all the patterns.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        for (auto distribution : {size_distribution::fixed, size_distribution::uniform, size_distribution::power_law, size_distribution::bimodal}) {
+            if (fixed_size_only && distribution != size_distribution::fixed)
+                continue;
+
+            for (auto pattern : {allocation_pattern::fifo, allocation_pattern::lifo, allocation_pattern::random_free, allocation_pattern::producer_consumer, allocation_pattern::sawtooth, allocation_pattern::steady_state_churn}) {
+                pattern_options options{pattern, distribution, single_run * 10, 16, 4096, single_run}; // Every allocator replays the same seed.
+
+                if (distribution == size_distribution::fixed)
+                    options.m_minimum_size = options.m_maximum_size = pattern_fixed_size;
+
+                trace_replayer replayer{pattern_generator{options}.generate()}; // The replayer of this pattern.
+                auto result_name = pattern_generator::get_pattern_name(pattern) + "_" + pattern_generator::get_distribution_name(distribution); // The name of this pattern.
+
+                // A single iteration replays the whole pattern against the allocator. The statistics are per call.
+                auto run_summary = m_engine.measure([&] () {
+                    replay(replayer);
+                }, replayer.get_number_of_operations());
+
+                std::cout << "Pattern " << result_name << ":" << std::endl;
+                add_summary(new_statistic, result_name + "_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+            }
+        }
+    }
+
+    std::cout << "---- END BENCHMARK " << pattern_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method allocates a single chunk.
+template <typename T>
+std::byte* allocator_benchmark::pool_byte_allocator<T>::allocate(std::size_t) {
+    return reinterpret_cast<std::byte*>(m_pool.allocate()); // The data of a chunk starts at its first byte.
+}
+
+// This method gives a single chunk back.
+template <typename T>
+void allocator_benchmark::pool_byte_allocator<T>::deallocate(std::byte* memory, std::size_t) noexcept {
+    m_pool.deallocate(reinterpret_cast<chunk<T>*>(memory));
+}
+
+// This method runs the same worker on any number of threads at the same time, and measures how long it takes until every single thread is finished.
+template <typename Worker>
+allocator_benchmark::thread_timings allocator_benchmark::run_threads(std::size_t number_of_threads, bool pin_threads, Worker worker) const {
+    const auto& clock = m_engine.get_clock(); // Every thread reads the same clock.
+    std::atomic<std::size_t> ready_threads{0}; // The number of threads that are waiting for the start signal.
+    std::atomic<bool> start_signal{false}; // All the threads start at the same time when this signal is set.
+    std::vector<std::uint64_t> end_times(number_of_threads); // The time every thread is finished, written once by its own thread.
+    std::vector<std::thread> worker_threads{}; // The threads that run the worker.
+
+    for (std::size_t i = 0; i < number_of_threads; i++) {
+        worker_threads.emplace_back([&, i] () {
+            ready_threads++; // This thread is ready.
+
+            // Wait until all the threads are created.
+            while (!start_signal.load(std::memory_order_acquire))
+                std::this_thread::yield();
+
+            worker(i); // Run the actual work.
+            end_times[i] = clock.now();
+        });
+
+        // The thread only waits so far, so it can still move to its core.
+        if (pin_threads)
+            pin_thread(worker_threads.back(), i);
+    }
+
+    // Wait until all the threads are ready, so that creating the threads is not measured.
+    while (ready_threads.load() != number_of_threads)
+        std::this_thread::yield();
+
+    auto begin_time = clock.now(); // The start time.
+    start_signal.store(true, std::memory_order_release); // Let all the threads start.
+
+    for (auto& single_thread : worker_threads)
+        single_thread.join();
+
+    thread_timings timings{clock.to_nanoseconds(clock.now() - begin_time), {}}; // The durations of this run.
+
+    for (const auto& single_end : end_times)
+        timings.m_thread_durations.push_back(clock.to_nanoseconds(single_end - begin_time));
+
+    return timings;
+}
+
+// This method sweeps an allocator that is shared by all the threads, over the numbers of threads of the options. Every number of threads runs a local and a cross-thread scenario.
+template <typename SharedAllocator>
+benchmark_statistics allocator_benchmark::benchmark_scalability(const benchmark_statistics::statistics_recognition& identifier, const std::string& scalability_name) const {
+    std::cout << "---- BENCHMARK " << scalability_name << " (" << (m_engine.get_options().m_pin_threads ? "PINNED" : "UNPINNED") << " THREADS) ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for all the numbers of threads.
+
+    for (const auto& scenario_name : {std::string{"local"}, std::string{"cross_thread"}}) {
+        auto is_cross_thread = scenario_name == "cross_thread"; // True if every thread frees the chunks of another thread.
+
+        // Go through all the numbers of threads of the sweep.
+        for (const auto& number_of_threads : m_engine.get_options().m_thread_counts) {
+            auto number_of_calls = static_cast<double>(number_of_threads * scalability_rounds * scalability_batch_size * 2); // The allocations and the deallocations of all the threads.
+            std::vector<double> call_durations{}; // The time of a single call of every run, over all the threads, in nanoseconds.
+            std::vector<double> jain_fairness{}; // The fairness index of Jain of every run.
+            std::vector<double> slowest_ratios{}; // The throughput of the slowest thread, relative to the fastest thread, of every run.
+
+            for (std::size_t repetition = 0; repetition < scalability_repetitions; repetition++) {
+                SharedAllocator shared_allocator{}; // A new allocator, that all the threads share.
+                std::vector<std::vector<void*>> batches(2 * number_of_threads, std::vector<void*>(scalability_batch_size)); // Two batches for every thread, one is filled while the other one is freed by the next thread.
+                std::barrier round_barrier{static_cast<std::ptrdiff_t>(number_of_threads)}; // In the cross-thread scenario, a batch is handed over only when all the threads have filled theirs.
+
+                // A single pass that is not timed fills every batch once, so that the timed rounds reuse memory instead of carving new blocks.
+                for (auto& single_batch : batches)
+                    for (auto& get_memory_addresses : single_batch)
+                        get_memory_addresses = shared_allocator.allocate(); // Allocate memory, get addresses.
+
+                for (auto& single_batch : batches)
+                    for (auto& free_memory_addresses : single_batch)
+                        shared_allocator.deallocate(free_memory_addresses); // Deallocate memory.
+
+                auto timings = run_threads(number_of_threads, m_engine.get_options().m_pin_threads, [&] (std::size_t thread_index) {
+                    for (std::size_t round = 0; round < scalability_rounds; round++) {
+                        auto& own_batch = batches[2 * thread_index + round % 2]; // The batch that this thread fills in this round.
+
+                        for (auto& get_memory_addresses : own_batch)
+                            get_memory_addresses = shared_allocator.allocate(); // Allocate memory, get addresses.
+
+                        // Hand the batch over. The next round fills the other batch, so the next thread can free this one in the meantime.
+                        if (is_cross_thread)
+                            round_barrier.arrive_and_wait();
+
+                        auto& freed_batch = is_cross_thread ? batches[2 * ((thread_index + number_of_threads - 1) % number_of_threads) + round % 2] : own_batch; // The batch that this thread frees.
+
+                        for (auto& free_memory_addresses : freed_batch)
+                            shared_allocator.deallocate(free_memory_addresses); // Deallocate memory.
+                    }
+                });
+
+                // Every thread makes the same number of calls, so its throughput is the inverse of its duration.
+                double sum_throughput = 0.0; // The sum of the throughput of all the threads.
+                double sum_squared_throughput = 0.0; // The sum of the squares of the throughput of all the threads.
+
+                for (const auto& single_duration : timings.m_thread_durations) {
+                    sum_throughput += 1.0 / single_duration;
+                    sum_squared_throughput += 1.0 / (single_duration * single_duration);
+                }
+
+                auto [fastest_duration, slowest_duration] = std::minmax_element(timings.m_thread_durations.begin(), timings.m_thread_durations.end()); // The first and the last thread that finished.
+
+                call_durations.push_back(timings.m_elapsed / number_of_calls);
+                jain_fairness.push_back(sum_throughput * sum_throughput / (static_cast<double>(number_of_threads) * sum_squared_throughput));
+                slowest_ratios.push_back(*fastest_duration / *slowest_duration);
+            }
+
+            auto call_summary = benchmark_engine::summarize(call_durations); // The statistics of the time of a single call.
+            auto throughput = 1000.0 / call_summary.m_median; // In million calls per second, for all the threads together.
+
+            new_statistic.add_result(std::make_tuple(scenario_name + "_" + std::to_string(number_of_threads), number_of_threads, throughput)); // Create a new statistic for this number of threads.
+
+            std::cout << "Scenario " << scenario_name << ", " << number_of_threads << " threads: throughput " << throughput << " million calls per second (median), fairness of Jain " << benchmark_engine::summarize(jain_fairness).m_median
+                      << ", slowest thread at " << benchmark_engine::summarize(slowest_ratios).m_median * 100.0 << " % of the fastest" << std::endl;
+        }
+    }
+
+    std::cout << "---- END BENCHMARK " << scalability_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method allocates a chunk.
+template <std::size_t MagazineCapacity>
+void* allocator_benchmark::shared_concurrent_pool<MagazineCapacity>::allocate() {
+    return m_pool.allocate();
+}
+
+// This method gives a chunk back.
+template <std::size_t MagazineCapacity>
+void allocator_benchmark::shared_concurrent_pool<MagazineCapacity>::deallocate(void* memory) noexcept {
+    m_pool.deallocate(static_cast<chunk<int>*>(memory));
+}
+
+// This method allocates a single element.
+template <typename Allocator>
+void* allocator_benchmark::shared_standard_allocator<Allocator>::allocate() {
+    return m_allocator.allocate(1);
+}
+
+// This method gives a single element back.
+template <typename Allocator>
+void allocator_benchmark::shared_standard_allocator<Allocator>::deallocate(void* memory) noexcept {
+    m_allocator.deallocate(static_cast<int*>(memory), 1);
+}
 
-#endif
\ No newline at end of file
+#endif
@@ -8,6 +8,19 @@
 #include <vector> // Include here all the 'vector' facilities.
 
 #include "pool_allocator.h" // Include here all the 'pool_allocator' facilities.
+#include "concurrent_pool_allocator.h" // Include here all the 'concurrent_pool_allocator' facilities.
+#include "lock_free_chunk_stack.h" // Include here all the 'lock_free_chunk_stack' facilities.
+#include "size_class_allocator.h" // Include here all the 'size_class_allocator' facilities.
+#include "pool_node_allocator.h" // Include here all the 'pool_node_allocator' facilities.
+#include "arena_allocator.h" // Include here all the 'arena_allocator' facilities.
+#include "memory_resources.h" // Include here all the 'memory_resources' facilities.
+#include "growable_vector.h" // Include here all the 'growable_vector' facilities.
+#include "benchmark_engine.h" // Include here all the 'benchmark_engine' facilities.
+#include "benchmark_statistics.h" // Include here all the 'benchmark_statistics' facilities.
+#include "allocator_benchmark.h" // Include here all the 'allocator_benchmark' facilities.
+#include "trace_replayer.h" // Include here all the 'trace_replayer' facilities.
+#include "pattern_generator.h" // Include here all the 'pattern_generator' facilities.
+#include "malloc_allocator.h" // Include here all the 'malloc_allocator' facilities.
 
 /// This structure 'allocator_tester' will test our memory pool allocator.
 struct allocator_tester {
@@ -19,6 +32,81 @@ struct allocator_tester {
 
     /// This static method validates the memory pool with a compound type.
     static void pool_validate_compound();
+
+    /// This static method validates that a chunk does not need more memory than its data, or the address to the next chunk.
+    static void pool_validate_chunk_footprint();
+
+    /// This static method validates that chunks are given back to the block they were allocated from, also when there are multiple blocks.
+    static void pool_validate_multi_block_deallocation();
+
+    /// This static method validates that fully free blocks are given back to the operating system, both explicitly and automatically.
+    static void pool_validate_trim();
+
+    /// This static method validates the memory pool allocator, the block allocator and the 'mmap' allocator on huge pages. It also passes when the system has no huge pages at all.
+    static void pool_validate_huge_pages();
+
+    /// This static method validates that blocks fill their last page, and that the blocks grow when a growth factor is given.
+    static void pool_validate_growth();
+
+    /// This static method validates linked, lazy and prefaulted blocks, also when their chunks are reused after a decommit.
+    static void pool_validate_fill_modes();
+
+    /// This static method validates the alignment of every pointer returned by the memory pool allocator and the 'malloc', 'mmap' and 'new' allocators, for over-aligned types and for a given alignment.
+    static void pool_validate_alignment();
+
+    /// This static method validates that the 'new' allocator only hands out raw memory, so that a container constructs and destroys every element exactly once.
+    static void new_validate_raw_storage();
+
+    /// This static method validates allocating and deallocating batches of chunks at once, also mixed with single chunks.
+    static void pool_validate_bulk();
+
+    /// This static method validates constructing and destroying objects within the memory pool allocator, also with a 'pool_unique_ptr' and a throwing constructor.
+    static void pool_validate_objects();
+
+    /// This static method validates the local NUMA mode. On a machine with a single node, it validates that everything degrades to that node.
+    static void pool_validate_numa();
+
+    /// This static method validates the guarded memory pool allocator. Every misuse must be reported, and must leave the free list intact.
+    static void pool_validate_guarded();
+
+    /// This static method validates the size class allocator within a vector, a string and an unordered map.
+    static void size_class_validate_containers();
+
+    /// This static method validates the memory pool node adapter within a list, a map, a set and an unordered map.
+    static void pool_node_validate_containers();
+
+    /// This static method validates the monotonic arena. It checks the initial buffer, the alignment, big requests and the reuse of the blocks after a reset.
+    static void arena_validate_reset();
+
+    /// This static method validates the cache of mapped regions. It checks the reuse without system calls, the merging of regions, the growth and the high-water mark.
+    static void mmap_validate_cache();
+
+    /// This static method validates growing memory in place with every allocator, and the 'growable_vector' that uses it, also with objects that are not trivially copyable.
+    static void growable_validate_reallocation();
+
+    /// This static method validates all the polymorphic memory resources, by using them for the same containers, chosen at runtime.
+    static void pmr_validate_resources();
+
+    /// This static method validates the concurrent memory pool, whereby chunks are freed by another thread than the allocating one.
+    static void concurrent_pool_validate_cross_thread();
+
+    /// This static method stresses the lock-free free list, whereby multiple threads push and pop the same chunks at the same time.
+    static void lock_free_stack_stress();
+
+    /// This static method validates the statistics of the benchmark engine on known samples, and a measurement with its calibrated iterations.
+    static void benchmark_validate_statistics();
+
+    /// This static method validates the latency histogram: its relative error, its percentiles, merging, and the queries of the benchmark statistics.
+    static void benchmark_validate_histogram();
+
+    /// This static method validates the allocation traces: writing and mapping a trace file, a broken file, and replaying an incomplete trace against several allocators.
+    static void trace_validate_replay();
+
+    /// This static method validates the pattern generator: every pattern frees every allocation exactly once, the sizes follow their distribution, and a seed always generates the same pattern.
+    static void pattern_validate_generator();
+
+    /// This static method validates the scalability mode: every number of threads of the sweep gets a result for both scenarios, also with pinned threads and a number of threads that is not a power of two.
+    static void scalability_validate_sweep();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef ALLOCATOR_ARENA_ALLOCATOR_H
+#define ALLOCATOR_ARENA_ALLOCATOR_H
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <limits> // Include here all the 'limits' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
+
+#include "monotonic_arena.h" // Include here all the 'monotonic_arena' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers.
+// It hands out memory from a 'monotonic_arena'. Deallocating does nothing, the memory comes back when the arena is reset.
+// The allocator only refers to the arena, it does not own it. So the arena must outlive all the containers that use it.
+// Copies, also rebound copies for another type, refer to the same arena, and are therefore equal.
+// The last allocation of the arena can grow in place. Otherwise 'reallocate' copies it to a new allocation, the old one is only given back by a reset.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'arena_allocator', used for allocating memory from a monotonic arena.
+/// \tparam T The type of this specific class.
+template <typename T>
+class arena_allocator {
+public:
+    /// You must specify this type definition within an allocator. It is an value type.
+    [[maybe_unused]] typedef T value_type;
+
+    /// This is the constructor of the 'arena_allocator' class. It refers to the given arena.
+    /// \param arena The arena this allocator allocates its memory from.
+    explicit arena_allocator(monotonic_arena& arena) noexcept;
+
+    /// The converting constructor for this allocator. It refers to the same arena as the other allocator.
+    /// \tparam U The type of 'arena_allocator' U.
+    template <typename U>
+    [[maybe_unused]] arena_allocator(const arena_allocator<U>& other_allocator) noexcept; // Allocators must be implicitly convertible, so this constructor is not explicit.
+
+    /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
+    /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
+    /// \return The first memory address of the allocated block of memory.
+    [[maybe_unused]] [[nodiscard]] T* allocate(std::size_t number_of_elements);
+
+    /// This method does nothing. The memory is given back when the arena is reset.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    [[maybe_unused]] void deallocate(T* allocated_memory, std::size_t number_of_elements) noexcept;
+
+    /// This method resizes the allocated memory. The last allocation of the arena grows in place, otherwise the content is copied to a new allocation.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method. Its objects are moved bytewise, so 'T' must be trivially copyable.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return The first memory address of the resized block of memory. It may differ from 'allocated_memory'.
+    [[nodiscard]] T* reallocate(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements);
+
+    /// This method grows the allocated memory in place, without moving it. This only succeeds for the last allocation of the arena.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return True if the memory has room for the new number of elements now. Otherwise nothing is changed.
+    bool try_expand(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept;
+
+    /// This method returns the maximum size that you can allocate.
+    /// \return The number of the maximum amount that you can allocate.
+    [[maybe_unused]] [[nodiscard]] std::size_t max_size() const;
+
+    /// This method returns the arena this allocator refers to.
+    /// \return A pointer to the arena.
+    [[nodiscard]] monotonic_arena* get_arena() const noexcept;
+
+private:
+    monotonic_arena* m_arena; // This field is the arena this allocator allocates its memory from.
+};
+
+// This is the constructor of the 'arena_allocator' class. It refers to the given arena.
+template<typename T>
+arena_allocator<T>::arena_allocator(monotonic_arena &arena) noexcept :
+    m_arena{&arena}
+{}
+
+// The converting constructor for this allocator. It refers to the same arena as the other allocator.
+template<typename T>
+template<typename U>
+[[maybe_unused]] arena_allocator<T>::arena_allocator(const arena_allocator<U> &other_allocator) noexcept :
+    m_arena{other_allocator.get_arena()}
+{}
+
+// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
+template<typename T>
+[[maybe_unused]] T *arena_allocator<T>::allocate(std::size_t number_of_elements) {
+    // Check if the number of bytes fits in a 'std::size_t'.
+    if (number_of_elements > max_size())
+        throw std::bad_array_new_length();
+
+    return static_cast<T*>(m_arena->allocate(number_of_elements * sizeof(T), alignof(T))); // Bump the pointer of the arena.
+}
+
+// This method does nothing. The memory is given back when the arena is reset.
+template<typename T>
+[[maybe_unused]] void arena_allocator<T>::deallocate([[maybe_unused]] T *allocated_memory, [[maybe_unused]] std::size_t number_of_elements) noexcept {}
+
+// This method resizes the allocated memory. The last allocation of the arena grows in place, otherwise the content is copied to a new allocation.
+template<typename T>
+T *arena_allocator<T>::reallocate(T *allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable objects can be moved to another address bytewise.");
+
+    if (try_expand(allocated_memory, old_number_of_elements, new_number_of_elements))
+        return allocated_memory;
+
+    auto* new_memory = allocate(new_number_of_elements);
+    std::memcpy(new_memory, allocated_memory, std::min(old_number_of_elements, new_number_of_elements) * sizeof(T));
+
+    return new_memory; // The old allocation stays in the arena until the next reset.
+}
+
+// This method grows the allocated memory in place, without moving it. This only succeeds for the last allocation of the arena.
+template<typename T>
+bool arena_allocator<T>::try_expand(T *allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept {
+    // Check if the number of bytes fits in a 'std::size_t'.
+    if (new_number_of_elements > max_size())
+        return false;
+
+    return m_arena->try_expand(allocated_memory, old_number_of_elements * sizeof(T), new_number_of_elements * sizeof(T));
+}
+
+// This method returns the maximum size that you can allocate.
+template<typename T>
+[[maybe_unused]] std::size_t arena_allocator<T>::max_size() const {
+    return std::numeric_limits<std::size_t>::max() / sizeof(T); // Calculate the amount of allocating memory.
+}
+
+// This method returns the arena this allocator refers to.
+template<typename T>
+monotonic_arena *arena_allocator<T>::get_arena() const noexcept {
+    return m_arena;
+}
+
+/// This operator compares two 'arena' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if both allocators refer to the same arena.
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& first_allocator, const arena_allocator<U>& second_allocator) { return first_allocator.get_arena() == second_allocator.get_arena(); }
+
+/// This operator compares two 'arena' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if the allocators refer to different arenas.
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& first_allocator, const arena_allocator<U>& second_allocator) { return !(first_allocator == second_allocator); }
+
+#endif
@@ -0,0 +1,156 @@
+#ifndef ALLOCATOR_BENCHMARK_ENGINE_H
+#define ALLOCATOR_BENCHMARK_ENGINE_H
+
+#include <chrono> // Include here all the 'chrono' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// A single measurement of a short piece of code says very little. The first iterations pay for cold caches, page faults and lazy initialisation, a clock in whole microseconds rounds short runs to zero, and a single preemption by the scheduler dominates a plain mean.
+// The 'benchmark_engine' therefore first runs some warmup iterations that are not measured. Then it calibrates how many iterations fit in a single sample: it doubles the iterations until a sample takes at least the minimum sample time.
+// Every sample is the time of all its iterations, divided by the number of iterations. The samples are summarised by robust statistics: the minimum, the median, the 90th and the 99th percentile, besides the mean with its standard deviation and its 95% confidence interval.
+// The median is the value to compare, one outlier hardly moves it. A wide confidence interval, or a 99th percentile far above the median, tells that the machine was not quiet during the measurement.
+// The 'benchmark_clock' reads 'std::chrono::steady_clock' in nanoseconds. On x86 it can read the time stamp counter with 'rdtsc' instead, which costs a few cycles instead of a call into the vDSO.
+// The ticks of this counter are converted to nanoseconds with a rate that is calibrated against the steady clock once, when the clock is created. On other processors the steady clock is always used.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This structure 'benchmark_options' contains the options of the benchmark engine. All the fields have a default value, so you only set what you need.
+struct benchmark_options {
+    std::size_t m_warmup_iterations{2}; // This is the number of iterations that are run before anything is measured.
+    std::size_t m_number_of_samples{15}; // This is the number of samples that are taken of every measurement.
+    std::chrono::nanoseconds m_minimum_sample_time{std::chrono::milliseconds{1}}; // A single sample runs as many iterations as needed to take at least this long.
+    std::size_t m_maximum_iterations{1 << 20}; // A single sample never runs more iterations than this, also when the iterations take (almost) no time.
+    bool m_use_cycle_counter{false}; // When this is true, the time stamp counter of the processor is read with 'rdtsc', if there is one.
+    bool m_record_latencies{false}; // When this is true, the benchmarks also time every single allocate and deallocate call, into a latency histogram.
+    std::vector<std::size_t> m_thread_counts{1, 2, 4, 8, 16, 32, 64}; // These are the numbers of threads that the scalability benchmarks sweep over.
+    bool m_pin_threads{false}; // When this is true, the scalability benchmarks pin every thread to a core, round robin over the cores of the machine.
+};
+
+/// This structure 'benchmark_summary' contains the statistics of the samples of a single measurement. All the times are in nanoseconds.
+struct benchmark_summary {
+    std::size_t m_number_of_samples{0}; // The number of samples that are summarised.
+    std::size_t m_iterations_per_sample{1}; // The number of iterations within every sample.
+    double m_minimum{0.0}; // The fastest sample.
+    double m_median{0.0}; // The sample in the middle. This is the value to compare between benchmarks.
+    double m_p90{0.0}; // The 90th percentile of the samples.
+    double m_p99{0.0}; // The 99th percentile of the samples.
+    double m_maximum{0.0}; // The slowest sample.
+    double m_mean{0.0}; // The mean of the samples.
+    double m_standard_deviation{0.0}; // The standard deviation of the samples, with a correction for a small number of samples.
+    double m_confidence_low{0.0}; // The lower bound of the 95% confidence interval of the mean.
+    double m_confidence_high{0.0}; // The upper bound of the 95% confidence interval of the mean.
+};
+
+/// This is the class 'benchmark_clock'. It reads the steady clock, or the time stamp counter of the processor, in ticks that can be converted to nanoseconds.
+class benchmark_clock {
+public:
+    /// This is the constructor of the 'benchmark_clock' class. The time stamp counter is calibrated against the steady clock right away.
+    /// \param use_cycle_counter True if the time stamp counter must be read. Without one, the steady clock is used anyway.
+    explicit benchmark_clock(bool use_cycle_counter = false);
+
+    /// This method reads the clock.
+    /// \return The current time, in ticks of this clock.
+    [[nodiscard]] std::uint64_t now() const noexcept;
+
+    /// This method converts a number of ticks to nanoseconds.
+    /// \param number_of_ticks The difference between two readings of this clock.
+    /// \return The number of nanoseconds.
+    [[nodiscard]] double to_nanoseconds(std::uint64_t number_of_ticks) const noexcept;
+
+    /// This method tells if this clock reads the time stamp counter.
+    /// \return True for the time stamp counter, false for the steady clock.
+    [[nodiscard]] bool is_cycle_counter() const noexcept;
+
+private:
+    /// This method reads the steady clock in nanoseconds.
+    /// \return The number of nanoseconds since the epoch of the steady clock.
+    static std::uint64_t read_steady_clock() noexcept;
+
+    /// This method reads the time stamp counter of the processor.
+    /// \return The number of cycles of the counter.
+    static std::uint64_t read_cycle_counter() noexcept;
+
+    bool m_use_cycle_counter; // This field tells if the time stamp counter is read, instead of the steady clock.
+    double m_nanoseconds_per_tick; // This field is the calibrated length of a single tick. For the steady clock, a tick is a nanosecond.
+};
+
+/// This is the class 'benchmark_engine'. It measures a workload with warmup iterations and calibrated samples, and summarises the samples.
+class benchmark_engine {
+public:
+    /// This is the constructor of the 'benchmark_engine' class.
+    /// \param options The options of the engine, for instance the number of samples.
+    explicit benchmark_engine(const benchmark_options& options = {});
+
+    /// This method measures a workload. It runs the warmup iterations, calibrates the iterations per sample, and takes all the samples.
+    /// \tparam Workload The type of the workload. It is called without any arguments, every call is a single iteration.
+    /// \param workload The workload that is measured.
+    /// \param operations_per_iteration The number of operations within a single iteration. The statistics are per operation.
+    /// \return The statistics of the samples, in nanoseconds per operation.
+    template <typename Workload>
+    [[nodiscard]] benchmark_summary measure(Workload workload, std::size_t operations_per_iteration = 1) const;
+
+    /// This method summarises the samples of a measurement.
+    /// \param samples The samples, in nanoseconds. They are sorted by this method.
+    /// \param iterations_per_sample The number of iterations within every sample, only used for showing.
+    /// \return The statistics of the samples.
+    [[nodiscard]] static benchmark_summary summarize(std::vector<double> samples, std::size_t iterations_per_sample = 1);
+
+    /// This method returns the clock that the engine measures with.
+    /// \return A constant reference to the clock.
+    [[nodiscard]] const benchmark_clock& get_clock() const noexcept;
+
+    /// This method returns the options of the engine.
+    /// \return A constant reference to the options.
+    [[nodiscard]] const benchmark_options& get_options() const noexcept;
+
+private:
+    /// This method returns the percentile of sorted samples, interpolated between the two samples around it.
+    /// \param sorted_samples The samples, sorted from fast to slow. There is at least one sample.
+    /// \param fraction The percentile as a fraction, so 0.9 for the 90th percentile.
+    /// \return The percentile, in nanoseconds.
+    static double percentile(const std::vector<double>& sorted_samples, double fraction) noexcept;
+
+    /// This method returns the critical value of the Student t-distribution for a two-sided 95% confidence interval.
+    /// \param degrees_of_freedom The number of samples minus one.
+    /// \return The number of standard errors on both sides of the mean.
+    static double critical_value(std::size_t degrees_of_freedom) noexcept;
+
+    benchmark_options m_options; // This field contains the options of the engine.
+    benchmark_clock m_clock; // This field is the clock that the engine measures with.
+};
+
+// This method measures a workload. It runs the warmup iterations, calibrates the iterations per sample, and takes all the samples.
+template <typename Workload>
+benchmark_summary benchmark_engine::measure(Workload workload, std::size_t operations_per_iteration) const {
+    // The warmup faults in the pages, and fills the caches and the free lists.
+    for (std::size_t i = 0; i < m_options.m_warmup_iterations; i++)
+        workload();
+
+    // This runs a number of iterations, and returns how long it takes.
+    auto run_iterations = [&] (std::size_t number_of_iterations) {
+        auto begin_time = m_clock.now(); // The start time.
+
+        for (std::size_t i = 0; i < number_of_iterations; i++)
+            workload();
+
+        return m_clock.to_nanoseconds(m_clock.now() - begin_time); // The duration of all the iterations.
+    };
+
+    // Double the iterations, until a sample takes long enough to be much longer than the resolution of the clock.
+    std::size_t iterations_per_sample = 1; // The number of iterations within every sample.
+
+    while (iterations_per_sample < m_options.m_maximum_iterations && run_iterations(iterations_per_sample) < static_cast<double>(m_options.m_minimum_sample_time.count()))
+        iterations_per_sample *= 2;
+
+    std::vector<double> samples{}; // The time of a single operation, for every sample.
+    samples.reserve(m_options.m_number_of_samples); // Growing this vector may not disturb the measurements.
+
+    for (std::size_t i = 0; i < m_options.m_number_of_samples; i++)
+        samples.push_back(run_iterations(iterations_per_sample) / static_cast<double>(iterations_per_sample * operations_per_iteration));
+
+    return summarize(std::move(samples), iterations_per_sample);
+}
+
+#endif
@@ -6,6 +6,10 @@
 #include <ctime> // Include here all the 'ctime' facilities.
 #include <iomanip> // Include here all the 'iomanip' facilities.
 #include <sstream> // Include here all the 'sstream' facilities.
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <string> // Include here all the 'string' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+#include <vector> // Include here all the 'vector' facilities.
 
 #include "benchmark_statistics.h" // Include here all the 'benchmark_statistics' facilities.
 
@@ -20,6 +24,10 @@ public:
     void generate_matlab_plot() const;
 
 private:
+    /// This method writes a second figure to the MATLAB-script, with the throughput against the number of threads of every scalability benchmark. Without any scalability benchmark, nothing is written.
+    /// \param output_file_string The MATLAB-script.
+    void write_scalability_plot(std::ofstream& output_file_string) const;
+
     std::vector<benchmark_statistics> m_statistics; // This field contains a vector with all the statistics from the benchmarker.
 };
 
@@ -4,6 +4,9 @@
 #include <vector> // Include here all the 'vector' facilities.
 #include <string> // Include here all the 'string' facilities.
 #include <tuple> // Include here all the 'tuple' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+
+#include "latency_histogram.h" // Include here all the 'latency_histogram' facilities.
 
 /// This is the 'benchmark_statistics' class. It contains all the statistics generated during the benchmark of all the different allocators.
 class benchmark_statistics {
@@ -13,7 +16,57 @@ public:
         memory_malloc, // Used for recognizing the 'malloc' allocator.
         memory_pool, // Used for recognizing the memory pool allocator.
         memory_mmap, // Used for recognizing the 'mmap' allocator.
-        memory_new // Used for recognizing the 'new' allocator.
+        memory_new, // Used for recognizing the 'new' allocator.
+        memory_pool_mutex, // Used for recognizing the memory pool allocator, shared by multiple threads with a mutex.
+        memory_pool_lock_free, // Used for recognizing the concurrent memory pool allocator, shared by multiple threads with a lock-free free list.
+        memory_size_class, // Used for recognizing the size class allocator.
+        map_std_allocator, // Used for recognizing an 'std::map' with the standard allocator.
+        map_pool_node, // Used for recognizing an 'std::map' with the memory pool node adapter.
+        memory_arena, // Used for recognizing the monotonic arena allocator.
+        pmr_pool, // Used for recognizing the polymorphic memory resource with memory pools.
+        pmr_std_pool, // Used for recognizing the 'std::pmr::unsynchronized_pool_resource' of the standard library.
+        pmr_arena, // Used for recognizing the polymorphic memory resource with a monotonic arena.
+        pmr_std_monotonic, // Used for recognizing the 'std::pmr::monotonic_buffer_resource' of the standard library.
+        traversal_normal_pages, // Used for recognizing a random traversal over the memory pool allocator with normal pages.
+        traversal_huge_pages, // Used for recognizing a random traversal over the memory pool allocator with huge pages.
+        growth_fixed, // Used for recognizing a growing memory pool allocator, whereby every block has the same size.
+        growth_geometric, // Used for recognizing a growing memory pool allocator, whereby every block is twice as big as the one before.
+        fill_linked, // Used for recognizing the memory pool allocator, whereby every new block is linked at once.
+        fill_lazy, // Used for recognizing the memory pool allocator, whereby the chunks of a new block are carved lazily.
+        fill_prefaulted, // Used for recognizing the memory pool allocator, whereby every new block is prefaulted.
+        counters_packed, // Used for recognizing counters of multiple threads in chunks that share a cache line.
+        counters_aligned, // Used for recognizing counters of multiple threads in chunks that are aligned to a cache line.
+        batch_loop, // Used for recognizing batches of chunks, allocated and deallocated one by one.
+        batch_bulk, // Used for recognizing batches of chunks, allocated and deallocated at once.
+        memory_mmap_cached, // Used for recognizing the 'mmap' allocator with a cache of mapped regions.
+        buffer_vector, // Used for recognizing a growing buffer in an 'std::vector', that copies its elements on every growth.
+        buffer_growable, // Used for recognizing a growing buffer in a 'growable_vector', that lets the allocator grow it in place.
+        objects_new_array, // Used for recognizing strings in memory of 'new[]', that are constructed twice: by 'new[]' and by the container.
+        objects_new_raw, // Used for recognizing strings in raw memory of the 'new' allocator, that are constructed only once.
+        debug_none, // Used for recognizing the memory pool allocator, without any checks.
+        debug_guarded, // Used for recognizing the memory pool allocator, with canaries, poison and a bitmap of the chunks in use.
+        debug_guard_pages, // Used for recognizing the memory pool allocator, with the checks and a guard page after every block.
+        trace_malloc, // Used for recognizing a replayed allocation trace, against the 'malloc' memory resource.
+        trace_new, // Used for recognizing a replayed allocation trace, against the 'new' memory resource.
+        trace_pool, // Used for recognizing a replayed allocation trace, against the memory resource with memory pools.
+        trace_arena, // Used for recognizing a replayed allocation trace, against the memory resource with a monotonic arena.
+        trace_std_pool, // Used for recognizing a replayed allocation trace, against the pool resource of the standard library.
+        pattern_pool, // Used for recognizing the generated allocation patterns, replayed against the memory pool allocator.
+        pattern_malloc, // Used for recognizing the generated allocation patterns, replayed against the 'malloc' allocator.
+        pattern_new, // Used for recognizing the generated allocation patterns, replayed against the 'new' allocator.
+        pattern_size_class, // Used for recognizing the generated allocation patterns, replayed against the size class allocator.
+        pattern_std_pool, // Used for recognizing the generated allocation patterns, replayed against the pool resource of the standard library.
+        scalability_pool_mutex, // Used for recognizing the throughput against the number of threads, of the memory pool allocator behind a mutex.
+        scalability_pool_magazines, // Used for recognizing the throughput against the number of threads, of the concurrent memory pool allocator with magazines.
+        scalability_pool_lock_free, // Used for recognizing the throughput against the number of threads, of the concurrent memory pool allocator with only its lock-free free list.
+        scalability_malloc, // Used for recognizing the throughput against the number of threads, of the 'malloc' allocator.
+        scalability_new // Used for recognizing the throughput against the number of threads, of the 'new' allocator.
+    };
+
+    /// This enumeration class 'latency_operation' tells which call of an allocator a latency belongs to.
+    enum class latency_operation {
+        allocate, // Used for recognizing the latencies of single allocations.
+        deallocate // Used for recognizing the latencies of single deallocations.
     };
 
     /// This is the constructor of the 'benchmark_statistics' class.
@@ -28,12 +81,30 @@ public:
     /// \return A constant reference to the vector with the various results of the benchmarker.
     [[nodiscard]] const std::vector<std::tuple<std::string, std::size_t, double>>& get_all_results() const;
 
+    /// This method adds the latencies of single calls to the histogram of their operation.
+    /// \param operation The operation the latencies belong to.
+    /// \param latencies A histogram with the latencies, in nanoseconds.
+    void add_latencies(const latency_operation& operation, const latency_histogram& latencies);
+
+    /// This method returns the histogram with the latencies of an operation.
+    /// \param operation The operation of the latencies.
+    /// \return A constant reference to the histogram, it is empty when no latencies are recorded.
+    [[nodiscard]] const latency_histogram& get_latencies(const latency_operation& operation) const;
+
+    /// This method returns a percentile of the latencies of an operation, for instance the 99.9th percentile that service levels are set on.
+    /// \param operation The operation of the latencies.
+    /// \param fraction The percentile as a fraction, so 0.999 for the 99.9th percentile.
+    /// \return The percentile in nanoseconds. Zero when no latencies are recorded.
+    [[nodiscard]] std::uint64_t get_latency_percentile(const latency_operation& operation, double fraction) const;
+
     /// This method returns the recognition of your total identifier
     /// \return A constant reference to the identifier for your current statistic.
     [[nodiscard]] const statistics_recognition& get_total_identifier() const;
 
 private:
     statistics_recognition m_total_identifier; // This field is used for identifying your current statistic.
+    latency_histogram m_allocate_latencies; // This field contains the latencies of single allocations, of all the runs.
+    latency_histogram m_deallocate_latencies; // This field contains the latencies of single deallocations, of all the runs.
     std::vector<std::tuple<std::string, std::size_t, double>> m_statistic_information; // This field is a vector that contains all the statistics used within the benchmark (its type is a tuple).
 };
 
@@ -4,11 +4,14 @@
 #include <iostream> // Include here all the 'iostream' facilities.
 #include <sys/mman.h> // Include here all the 'sys/mman' facilities.
 
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
 // ---- EXTRA INFORMATION ---- //
 // This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers.
 // But, in this case it is used for allocating new blocks for a memory pool allocator.
 // If you want to make an allocator yourself, you should mainly provide it with two methods, in this case an 'allocate' and a 'deallocate' method.
 // To allocate and deallocate memory, use is made of the various facilities that Linux offers for this purpose, namely 'mmap' and 'munmap'.
+// Optionally, the blocks can be backed by huge pages. A block is then rounded up to whole huge pages of 2 MiB.
 // ---- END EXTRA INFORMATION ---- //
 
 /// This is the template class 'block_allocator', used for allocating memory for a new block for the memory pool allocator.
@@ -19,6 +22,13 @@ public:
     /// You must specify this type definition within an allocator. It is an value type.
     [[maybe_unused]] typedef T value_type;
 
+    /// This is the constructor of the 'block_allocator' class. It is a default constructor, the blocks use normal pages.
+    block_allocator() = default;
+
+    /// This is the constructor of the 'block_allocator' class.
+    /// \param mode The pages that back the blocks.
+    explicit block_allocator(page_mode mode) noexcept;
+
     /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
     /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
     /// \return The first memory address of the allocated block.
@@ -29,17 +39,33 @@ public:
     /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
     [[maybe_unused]] void deallocate(T* memory, std::size_t number_of_elements) noexcept;
 
+    /// This method returns the pages that back the blocks of this allocator.
+    /// \return The page mode.
+    [[nodiscard]] page_mode get_page_mode() const noexcept;
+
 private:
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
     [[maybe_unused]] void used_memory(T* pointer_to_memory, const std::size_t& number_of_bytes, bool is_allocating = true); // Used for showing messages.
+
+    page_mode m_page_mode{page_mode::normal}; // This field contains the pages that back the blocks.
 };
 
+// This is the constructor of the 'block_allocator' class.
+template<typename T>
+block_allocator<T>::block_allocator(page_mode mode) noexcept :
+    m_page_mode{mode}
+{}
+
 // This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
 template<typename T>
 [[maybe_unused]] T *block_allocator<T>::allocate(std::size_t number_of_elements) {
+    // A block with huge pages is aligned to a huge page. It throws 'std::bad_alloc' when allocating failed.
+    if (m_page_mode != page_mode::normal)
+        return reinterpret_cast<T*>(memory_mapping::map_region(number_of_elements * sizeof(T), memory_mapping::huge_page_size(), m_page_mode));
+
     auto* allocated_memory = mmap(nullptr, number_of_elements * sizeof(T), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0); // Allocate a new memory block with 'mmap'. You can read/write to this memory. Also, the mapping is not mapped to a file.
 
     // Check if allocating new memory succeeded.
@@ -52,11 +78,23 @@ template<typename T>
 // This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
 template<typename T>
 [[maybe_unused]] void block_allocator<T>::deallocate(T *memory, std::size_t number_of_elements) noexcept {
+    // A block with huge pages was rounded up to whole huge pages, so the same size must be unmapped.
+    if (m_page_mode != page_mode::normal) {
+        memory_mapping::unmap_region(memory, number_of_elements * sizeof(T), m_page_mode);
+        return;
+    }
+
     // Here, you unmap the just allocated memory. You are passing the first address of the allocated block, together with the number of bytes.
     if (munmap(memory, number_of_elements * sizeof(T)))
         std::cerr << "Deallocating memory failed!" << std::endl; // If this function failed deallocating the memory, print this as standard error.
 }
 
+// This method returns the pages that back the blocks of this allocator.
+template<typename T>
+page_mode block_allocator<T>::get_page_mode() const noexcept {
+    return m_page_mode;
+}
+
 // This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
 template<typename T>
 [[maybe_unused]] void block_allocator<T>::used_memory(T *pointer_to_memory, const size_t &number_of_bytes, bool is_allocating) {
@@ -1,119 +1,742 @@
 #ifndef ALLOCATOR_CHUNK_LIST_H
 #define ALLOCATOR_CHUNK_LIST_H
 
+#include <algorithm> // Include here all the 'algorithm' facilities.
 #include <cstddef> // Include here all the 'cstddef' facilities.
-#include <sys/mman.h> // Include here all the 'sys/mman' facilities.
-
-/// This structure is used within a memory pool allocator. It contains a data element, together with the address to the next chunk.
-/// \tparam T The type of this specific structure.
-template <typename T>
-struct chunk {
-    T m_data; // This is your data field.
-    chunk* m_next_node; // This is the value to the next node field. It is a memory address.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <iostream> // Include here all the 'iostream' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+#include "pool_options.h" // Include here all the 'pool_options' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// A chunk is either allocated or free, never both. An allocated chunk only needs its data, and a free chunk only needs the address to the next free chunk.
+// That is why both fields share the same storage: the address to the next chunk is written over the data as soon as the chunk is freed.
+// A chunk therefore costs exactly 'max(sizeof(T), sizeof(void*))' bytes, rounded up to the alignment of 'T'. For an 'int' this is 8 bytes instead of 16 bytes.
+// The fields of a union are never constructed or destroyed by the union itself, so 'T' may have a constructor or destructor. The user of the chunk is responsible for it.
+// A chunk is aligned like 'T', so an 'alignas' on 'T' is respected. The 'Alignment' parameter can align it even more, without changing 'T' itself.
+// The size of a chunk is always a multiple of its alignment. With an alignment of 64 bytes, every chunk has a cache line of its own, so two threads never write to the same cache line (no false sharing).
+// ---- END EXTRA INFORMATION ---- //
+
+/// This union is used within a memory pool allocator. It contains a data element while it is allocated, or the address to the next chunk while it is free.
+/// \tparam T The type of this specific union.
+/// \tparam Alignment The minimum alignment of every chunk. It must be a power of two. The chunk is never aligned less than 'T' and the address to the next chunk.
+template <typename T, std::size_t Alignment = alignof(T)>
+union alignas(T) alignas(void*) alignas(Alignment) chunk {
+    T m_data; // This is your data field. It is only valid while the chunk is allocated.
+    chunk* m_next_node; // This is the value to the next node field. It is a memory address, and only valid while the chunk is free.
+};
+
+// ---- EXTRA INFORMATION ---- //
+// Every block of chunks is mapped at an address that is a multiple of 'chunk_block_alignment', and a block is never bigger than this alignment.
+// The first bytes of a block contain a small header, followed by the chunks. Clearing the lower bits of the address of any chunk therefore gives the header of its own block.
+// The header contains the index of the block within the list of blocks of the memory pool allocator. So finding the owning block of a chunk goes in O(1) time.
+// The header also contains the address of the memory pool allocator itself. So a single chunk is enough to find its way back to its pool, without storing the pool anywhere else.
+// 'mmap' always maps whole pages. So the number of chunks is rounded up, until the last page of the block is full as well. Otherwise the rest of that page would be wasted.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// Linking all the chunks of a new block writes to every page of it. The allocation that maps the block pays for all these page faults, which is a big spike in its latency.
+// With lazy carving, a new block only keeps an index to the first chunk that was never handed out. The free list only contains the chunks that were given back.
+// An allocation first takes a chunk from the free list, and otherwise bumps the index. So the pages of the block are faulted in one by one, spread over the allocations.
+// With prefaulting, all the pages are faulted in by the kernel when the block is mapped, and the chunks are carved lazily. The spike stays, but it is smaller and predictable.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// A guarded block checks how its chunks are used, so that a bug is reported before it silently corrupts the free list.
+// Every chunk is surrounded by canaries: words with a fixed pattern that are never handed out. A canary that changed by the time the chunk is freed, means that something was written past the data.
+// A freed chunk is poisoned: all its bytes after the address to the next chunk get a fixed pattern. When the poison changed by the time the chunk is handed out again, it was written to after it was freed.
+// A bitmap with a single bit per chunk tells which chunks are in use. Freeing a chunk whose bit is not set is a double free, which is detected in O(1) time, without walking the free list.
+// With guard pages, every block is followed by a page without any access rights. Running past the end of a block then faults right away, instead of writing into whatever comes next.
+// The canaries cost a word per chunk (or the alignment of a chunk, when that is bigger), the bitmap costs a single bit per chunk. The checks only touch the chunk itself and its canaries.
+// ---- END EXTRA INFORMATION ---- //
+
+/// The alignment of every block of chunks. It is also the maximum size of a block.
+inline constexpr std::size_t chunk_block_alignment = std::size_t{2} * 1024 * 1024;
+
+/// The pattern of the canaries around every chunk of a guarded block.
+inline constexpr std::uint64_t chunk_canary = 0x5AFEC0DE5AFEC0DE;
+
+/// The pattern of the bytes of a free chunk of a guarded block.
+inline constexpr unsigned char chunk_poison = 0xDD;
+
+/// This function reports a misuse of a chunk of a guarded block.
+/// \param violation_handler The function that is called with the misuse. With a 'nullptr', the misuse is printed as standard error.
+/// \param violation The misuse that is detected.
+/// \param memory The address of the chunk that is misused.
+inline void report_pool_violation(pool_violation_handler violation_handler, pool_violation violation, const void* memory) noexcept {
+    static constexpr const char* violation_names[] = {"double free", "foreign chunk", "use after free", "buffer overflow"}; // The names of the misuses, in the order of the enumeration.
+
+    if (violation_handler != nullptr) {
+        violation_handler(violation, memory);
+        return;
+    }
+
+    std::cerr << "Checking the chunk at " << memory << " failed! It is a " << violation_names[static_cast<std::size_t>(violation)] << "." << std::endl; // If the chunk is misused, print this as standard error.
+}
+
+/// This structure is the header at the start of every block of chunks.
+struct chunk_block_header {
+    std::size_t m_block_index; // This is the index of the block within the list of blocks of its memory pool allocator.
+    void* m_owner; // This is the memory pool allocator that owns this block, or a 'nullptr'.
 };
 
 /// This is the class 'chunk_list'. It is used to allocate/deallocate memory for the list of chunks for a block in your memory pool allocator.
 /// \tparam T The type of this specific class.
-template <typename T>
+/// \tparam Alignment The minimum alignment of every chunk. It must be a power of two.
+template <typename T, std::size_t Alignment = alignof(T)>
 class chunk_list {
 public:
     /// This is the constructor of the 'chunk_list' class.
-    /// \param number_of_chunks This is the number of chunks that you want to allocate. It is NOT in bytes!
-    explicit chunk_list(const std::size_t& number_of_chunks);
+    /// \param number_of_chunks This is the minimum number of chunks that you want to allocate. It is NOT in bytes! It is rounded up to fill the last page, and limited to the chunks that fit in 'chunk_block_alignment'.
+    /// \param block_index This is the index of this block within the list of blocks of its memory pool allocator.
+    /// \param mode These are the pages that back this block. With huge pages, the block is a single huge page.
+    /// \param fill_mode This is how the chunks of the block are prepared, once the block is mapped.
+    /// \param owner This is the memory pool allocator that owns this block. It is written into the header of the block.
+    /// \param numa_node This is the NUMA node that the block is bound to, before any of its pages is touched.
+    /// \param debug_mode This is how much the use of the chunks is checked. A guarded block surrounds its chunks with canaries, and keeps a bitmap of the chunks in use.
+    /// \param violation_handler This is the function that is called for every misuse of a chunk of a guarded block, or a 'nullptr' to print it as standard error.
+    explicit chunk_list(const std::size_t& number_of_chunks, const std::size_t& block_index = 0, page_mode mode = page_mode::normal, block_fill_mode fill_mode = block_fill_mode::linked, void* owner = nullptr, std::size_t numa_node = memory_mapping::any_numa_node, pool_debug_mode debug_mode = pool_debug_mode::none, pool_violation_handler violation_handler = nullptr);
+
+    /// This method gets a free chunk from your current block of chunks. The block itself is allocated on the first call.
+    /// \return Return the address to a free chunk, or a 'nullptr' when all the chunks of this block are in use.
+    chunk<T, Alignment>* get_free_chunk();
 
-    /// This method gets a free chunk from your current block of chunks.
-    /// \return Return the address to a free chunk.
-    chunk<T>* get_free_chunk();
+    /// This method gets several free chunks at once. First the chunks of the free list are taken, and then a contiguous run of chunks that were never used.
+    /// \param free_chunks The place where the addresses of the chunks are written to. It must have room for 'number_of_chunks' addresses.
+    /// \param number_of_chunks The maximum number of chunks that you want.
+    /// \return The number of chunks that were written, it is less than 'number_of_chunks' when this block is full.
+    std::size_t get_free_chunks(chunk<T, Alignment>** free_chunks, std::size_t number_of_chunks);
 
     /// This method removes a just allocated chunk. Due to that you are using a linked list under the hood, you are only chancing the 'm_next_node' field from this struct.
-    /// \param free_chunk The address to an allocated chunk.
-    void remove_chunk(chunk<T>* free_chunk) noexcept;
+    /// \param free_chunk The address to an allocated chunk. It must belong to this block.
+    void remove_chunk(chunk<T, Alignment>* free_chunk) noexcept;
 
-    /// This method removes the whole list of chunks. It deallocates the whole block of memory.
+    /// This method removes a chain of allocated chunks at once. The chain is spliced in front of the free list, so its chunks are not visited.
+    /// \param first_chunk The first chunk of the chain. It must belong to this block.
+    /// \param last_chunk The last chunk of the chain. The chunks from 'first_chunk' up to 'last_chunk' must already be linked with their 'm_next_node' field.
+    /// \param number_of_chunks The number of chunks within the chain.
+    void remove_chunks(chunk<T, Alignment>* first_chunk, chunk<T, Alignment>* last_chunk, std::size_t number_of_chunks) noexcept;
+
+    /// This method removes the whole list of chunks. It deallocates the whole block of memory. The block is allocated again on the next call to 'get_free_chunk'.
     void remove_chunk_list() noexcept;
 
+    /// This method gives the pages of the chunks back to the operating system, but keeps the block mapped. All the chunks must be free.
+    /// \return The number of bytes that are given back. The first page, with the header, is always kept. A block of explicit huge pages can not be decommitted partly, so it gives nothing back.
+    std::size_t decommit_chunk_list() noexcept;
+
+    /// This method changes the index of this block within the list of blocks of its memory pool allocator.
+    /// \param block_index The new index of this block.
+    void set_block_index(const std::size_t& block_index) noexcept;
+
+    /// This method tells whether a chunk of a guarded block is in use, by reading its bit of the bitmap.
+    /// \param allocated_chunk The address to a chunk within this block.
+    /// \return True if the chunk is handed out and not freed yet. False for a free chunk, or an address that is not a chunk of this block.
+    [[nodiscard]] bool is_chunk_in_use(const chunk<T, Alignment>* allocated_chunk) const noexcept;
+
+    /// This method checks the canaries of a chunk of a guarded block that is deallocated, marks it free and poisons it. An overwritten canary is reported.
+    /// \param allocated_chunk The address to a chunk within this block. It must be in use, its object must already be destroyed.
+    void guard_released_chunk(chunk<T, Alignment>* allocated_chunk) noexcept;
+
+    /// This method tells whether this block checks the use of its chunks.
+    /// \return True if the block is guarded.
+    [[nodiscard]] bool is_guarded() const noexcept;
+
+    /// This method tells whether all the chunks of this block are in use.
+    /// \return True if there is no free chunk left.
+    [[nodiscard]] bool is_full() const noexcept;
+
+    /// This method tells whether none of the chunks of this block are in use.
+    /// \return True if all the chunks are free.
+    [[nodiscard]] bool is_empty() const noexcept;
+
+    /// This method tells whether the chunks of this block are in physical memory, so neither unmapped nor decommitted.
+    /// \return True if the block uses memory.
+    [[nodiscard]] bool is_resident() const noexcept;
+
+    /// This method returns the number of chunks of this block that are in use.
+    /// \return The number of chunks in use, it is NOT in bytes!
+    [[nodiscard]] std::size_t get_used_chunks() const noexcept;
+
+    /// This method returns the NUMA node that this block is bound to.
+    /// \return The node, or 'memory_mapping::any_numa_node' when the block is not bound.
+    [[nodiscard]] std::size_t get_numa_node() const noexcept;
+
+    /// This method returns the number of chunks of this block.
+    /// \return The number of chunks, it is NOT in bytes!
+    [[nodiscard]] std::size_t get_number_of_chunks() const noexcept;
+
+    /// This method returns the number of bytes that are mapped for this block.
+    /// \return The size of the block in bytes.
+    [[nodiscard]] std::size_t get_size_block() const noexcept;
+
+    /// This method finds the index of the block that a chunk belongs to, by reading the header of its block.
+    /// \param allocated_chunk The address to a chunk within a block.
+    /// \return The index of the block, as given to the constructor or the 'set_block_index' method.
+    static std::size_t find_block_index(const chunk<T, Alignment>* allocated_chunk) noexcept;
+
+    /// This method finds the memory pool allocator that a chunk belongs to, by reading the header of its block.
+    /// \param allocated_chunk The address to a chunk within a block.
+    /// \return The owner, as given to the constructor, or a 'nullptr'.
+    static void* find_owner(const chunk<T, Alignment>* allocated_chunk) noexcept;
+
 private:
+    /// The offset of the first chunk within a block. The header is rounded up, so that the chunks are still aligned.
+    static constexpr std::size_t chunk_offset = (sizeof(chunk_block_header) + alignof(chunk<T, Alignment>) - 1) / alignof(chunk<T, Alignment>) * alignof(chunk<T, Alignment>);
+
+    static_assert((Alignment & (Alignment - 1)) == 0, "The alignment of a chunk must be a power of two.");
+    static_assert(chunk_offset + sizeof(chunk<T, Alignment>) <= chunk_block_alignment, "A single chunk must fit within a block.");
+
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
-    [[maybe_unused]] void used_memory(chunk<T>* pointer_to_memory, const std::size_t& number_of_bytes, bool is_allocating = true); // Used for showing messages.
+    [[maybe_unused]] void used_memory(chunk<T, Alignment>* pointer_to_memory, const std::size_t& number_of_bytes, bool is_allocating = true); // Used for showing messages.
+
+    /// This value indicates that an address is not a chunk of this block.
+    static constexpr std::size_t no_chunk = static_cast<std::size_t>(-1);
+
+    /// This method calculates the number of chunks of a block. The chunks fill all the pages that are needed for the requested number of chunks.
+    /// \param number_of_chunks The minimum number of chunks.
+    /// \param mode The pages that back the block.
+    /// \param guard_size The number of bytes of the canaries in front of every chunk, and after the last one.
+    /// \return The number of chunks that fit in the pages of the block.
+    static std::size_t fill_pages(const std::size_t& number_of_chunks, page_mode mode, std::size_t guard_size) noexcept;
+
+    /// This method calculates the number of bytes of the canaries between the chunks.
+    /// \param debug_mode How much the use of the chunks is checked.
+    /// \return A word, or the alignment of a chunk when that is bigger. Zero when the block is not guarded.
+    static std::size_t find_guard_size(pool_debug_mode debug_mode) noexcept;
+
+    /// This method returns a chunk of this block by its index.
+    /// \param chunk_index The index of the chunk, below the number of chunks.
+    /// \return The address of the chunk. The chunks of a guarded block are further apart, because of the canaries in between.
+    chunk<T, Alignment>* chunk_at(std::size_t chunk_index) const noexcept;
+
+    /// This method finds the index of a chunk within this block.
+    /// \param allocated_chunk The address that should be a chunk of this block.
+    /// \return The index of the chunk, or 'no_chunk' when the address is not a chunk that was ever handed out.
+    std::size_t find_chunk_index(const chunk<T, Alignment>* allocated_chunk) const noexcept;
+
+    /// This method writes the canaries in front of a chunk and after it.
+    /// \param guarded_chunk The address to a chunk within this block.
+    void write_canaries(chunk<T, Alignment>* guarded_chunk) noexcept;
+
+    /// This method checks whether the canaries in front of a chunk and after it still have their pattern.
+    /// \param guarded_chunk The address to a chunk within this block.
+    /// \return True if both canaries are intact.
+    bool has_intact_canaries(const chunk<T, Alignment>* guarded_chunk) const noexcept;
+
+    /// This method poisons all the bytes of a chunk, after the address to the next chunk.
+    /// \param guarded_chunk The address to a free chunk within this block.
+    void poison_chunk(chunk<T, Alignment>* guarded_chunk) noexcept;
+
+    /// This method checks whether all the bytes of a chunk, after the address to the next chunk, are still poisoned.
+    /// \param guarded_chunk The address to a free chunk within this block.
+    /// \return True if the poison is intact.
+    bool is_poisoned(const chunk<T, Alignment>* guarded_chunk) const noexcept;
+
+    /// This method changes the bit of a chunk within the bitmap of the chunks in use.
+    /// \param chunk_index The index of the chunk.
+    /// \param is_in_use Whether the chunk is in use from now on.
+    void mark_chunk(std::size_t chunk_index, bool is_in_use) noexcept;
 
-    chunk<T>* m_current_chunk; // This field will hold the address to the current chunk.
-    chunk<T>* m_begin_chunk; // This field will hold the address to the first chunk.
+    /// This method checks a chunk that is taken from the free list of a guarded block. Its poison must be intact, and the next chunk of the free list must be a free chunk of this block.
+    /// \param reused_chunk The chunk that is handed out. The free list already continues at the next chunk.
+    void guard_reused_chunk(chunk<T, Alignment>* reused_chunk) noexcept;
+
+    /// This method prepares a chunk of a guarded block that was never handed out, by writing its canaries.
+    /// \param carved_chunk The chunk that is handed out.
+    void guard_carved_chunk(chunk<T, Alignment>* carved_chunk) noexcept;
+
+    /// This method links all the free chunks that were ever handed out again, by reading the bitmap. It is used when the free list of a guarded block is overwritten.
+    void rebuild_free_list() noexcept;
+
+    /// This method returns the number of bytes of the guard page after this block.
+    /// \return A single page with guard pages and normal pages, otherwise zero.
+    std::size_t get_guard_page_size() const noexcept;
+
+    /// This method makes sure that the chunks of the block can be handed out. It maps the block on the first call, and prepares the chunks again after a decommit.
+    void make_resident();
+
+    /// This method makes all the chunks of the block free. With a linked block they are linked to each other, otherwise they are carved out later on.
+    void prepare_chunks() noexcept;
+
+    /// This method returns the header of this block.
+    /// \return The address of the header at the start of the block.
+    chunk_block_header* get_header() const noexcept;
+
+    chunk<T, Alignment>* m_current_chunk; // This field will hold the address to the current chunk of the free list.
+    chunk<T, Alignment>* m_begin_chunk; // This field will hold the address to the first chunk.
 
     bool m_is_allocated; // This field indicates whether you allocated a chunk.
+    bool m_is_decommitted; // This field indicates whether the pages of the chunks were given back to the operating system.
 
+    std::size_t m_guard_size; // This field indicates the number of bytes of the canaries between the chunks, or zero when the block is not guarded.
     std::size_t m_number_of_chunks; // This field indicates the number of chunks per block.
+    std::size_t m_used_chunks; // This field indicates the number of chunks that are in use.
+    std::size_t m_carved_chunks; // This field indicates the number of chunks that were ever handed out, or linked into the free list.
+    std::size_t m_block_index; // This field indicates the index of this block within the list of blocks.
     std::size_t m_size_block; // This field indicates the size of your block with various chunks.
+    page_mode m_page_mode; // This field indicates the pages that back your block.
+    block_fill_mode m_fill_mode; // This field indicates how the chunks of your block are prepared.
+    void* m_owner; // This field is the memory pool allocator that owns your block.
+    std::size_t m_numa_node; // This field indicates the NUMA node that your block is bound to.
+    pool_debug_mode m_debug_mode; // This field indicates how much the use of your chunks is checked.
+    pool_violation_handler m_violation_handler; // This field is the function that is called for every misuse of your chunks.
+    std::vector<std::uint64_t> m_allocation_bitmap; // This field contains a bit for every chunk, that is set while the chunk is in use. It is empty when your block is not guarded.
 };
 
 // This is the constructor of the 'chunk_list' class.
-template<typename T>
-chunk_list<T>::chunk_list(const size_t &number_of_chunks) :
+template<typename T, std::size_t Alignment>
+chunk_list<T, Alignment>::chunk_list(const size_t &number_of_chunks, const size_t &block_index, page_mode mode, block_fill_mode fill_mode, void *owner, std::size_t numa_node, pool_debug_mode debug_mode, pool_violation_handler violation_handler) :
     m_current_chunk{nullptr},
     m_begin_chunk{nullptr},
     m_is_allocated{false},
-    m_number_of_chunks{number_of_chunks},
-    m_size_block{number_of_chunks * sizeof(chunk<T>)}
+    m_is_decommitted{false},
+    m_guard_size{find_guard_size(debug_mode)},
+    m_number_of_chunks{fill_pages(number_of_chunks, mode, m_guard_size)},
+    m_used_chunks{0},
+    m_carved_chunks{0},
+    m_block_index{block_index},
+    m_size_block{chunk_offset + m_guard_size + m_number_of_chunks * (sizeof(chunk<T, Alignment>) + m_guard_size)},
+    m_page_mode{mode},
+    m_fill_mode{fill_mode},
+    m_owner{owner},
+    m_numa_node{numa_node},
+    m_debug_mode{debug_mode},
+    m_violation_handler{violation_handler},
+    m_allocation_bitmap(debug_mode == pool_debug_mode::none ? 0 : (m_number_of_chunks + 63) / 64)
 {}
 
-// This method gets a free chunk from your current block of chunks.
-template<typename T>
-chunk<T> *chunk_list<T>::get_free_chunk() {
-    // Check if you never allocated new memory for you current block.
-    if (m_current_chunk == nullptr) {
-        auto* allocated_memory = reinterpret_cast<chunk<T>*>(mmap(nullptr, m_size_block, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0)); // Allocate a new memory block with 'mmap'. You can read/write to this memory. Also, the mapping is not mapped to a file.
-
-        // Check if allocating succeeded.
-        if (allocated_memory != MAP_FAILED) {
-            auto* current_memory_element = allocated_memory; // Indication for your current memory address.
-
-            // Check if you already allocated memory for you block (later block with chunks).
-            if (!m_is_allocated) {
-                m_begin_chunk = allocated_memory; // Your first memory block.
-                m_is_allocated = true; // After this call, you will always have an initial memory block.
-            }
-
-            // Go through the allocated block of memory, and divide smaller parts for single chunks. This allows for less fragmentation within you memory.
-            for (std::size_t i = 0; i < m_number_of_chunks - 1; i++) {
-                current_memory_element->m_next_node = reinterpret_cast<chunk<T>*>(reinterpret_cast<char*>(current_memory_element) + sizeof(chunk<T>)); // Allocate memory for a single chunk out of the bigger block of memory.
-                current_memory_element = current_memory_element->m_next_node; // Go to the next chunk, you also want to allocate memory for the next chunk, unless you reached the maximum number of chunks.
-            }
-
-            current_memory_element->m_next_node = nullptr; // Last in the block of memory, it must be a 'nullptr'.
-            m_current_chunk = allocated_memory; // First element in the allocated block of memory.
-        }
-        else
-            throw std::bad_alloc(); // Allocating failed, throw this exception.
+// This method gets a free chunk from your current block of chunks. The block itself is allocated on the first call.
+template<typename T, std::size_t Alignment>
+chunk<T, Alignment> *chunk_list<T, Alignment>::get_free_chunk() {
+    make_resident(); // The block must be in memory, before a chunk is handed out.
+
+    chunk<T, Alignment>* free_memory_chunk; // The chunk that is handed out.
+
+    // First reuse a chunk that was given back. Otherwise carve the next chunk that was never used. When both fail, all the chunks of this block are in use.
+    if (m_current_chunk != nullptr) {
+        free_memory_chunk = m_current_chunk; // Get free memory.
+        m_current_chunk = m_current_chunk->m_next_node; // Go to the next chunk, your old chunk will be returned (first available place in memory). Allocating here goes in O(1) time.
+
+        if (is_guarded())
+            guard_reused_chunk(free_memory_chunk);
+    }
+    else if (m_carved_chunks < m_number_of_chunks) {
+        free_memory_chunk = chunk_at(m_carved_chunks++); // Bump the index, also in O(1) time. Only the page of this chunk is touched.
+
+        if (is_guarded())
+            guard_carved_chunk(free_memory_chunk);
     }
+    else
+        return nullptr;
 
-    auto* free_memory_chunk = m_current_chunk; // Get free memory.
-    m_current_chunk = m_current_chunk->m_next_node; // Go to the next chunk, your old chunk will be returned (first available place in memory). Allocating here goes in O(1) time.
+    m_used_chunks++; // One more chunk is in use.
 
     return free_memory_chunk; // Return the free chunk.
 }
 
+// This method gets several free chunks at once. First the chunks of the free list are taken, and then a contiguous run of chunks that were never used.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_free_chunks(chunk<T, Alignment> **free_chunks, std::size_t number_of_chunks) {
+    make_resident(); // The block must be in memory, before a chunk is handed out.
+
+    std::size_t handed_out_chunks{0}; // The number of chunks that are written.
+
+    // A guarded block checks every chunk on its own.
+    if (is_guarded()) {
+        for (; handed_out_chunks < number_of_chunks; handed_out_chunks++) {
+            if ((free_chunks[handed_out_chunks] = get_free_chunk()) == nullptr)
+                break;
+        }
+
+        return handed_out_chunks;
+    }
+
+    // Take the chunks that were given back, from the front of the free list.
+    for (; handed_out_chunks < number_of_chunks && m_current_chunk != nullptr; handed_out_chunks++) {
+        free_chunks[handed_out_chunks] = m_current_chunk;
+        m_current_chunk = m_current_chunk->m_next_node;
+    }
+
+    // Carve the rest as a single run of chunks that follow each other. Only the index is bumped, the chunks themselves are not touched.
+    auto carved_chunks = std::min(number_of_chunks - handed_out_chunks, m_number_of_chunks - m_carved_chunks);
+
+    for (std::size_t i = 0; i < carved_chunks; i++)
+        free_chunks[handed_out_chunks++] = chunk_at(m_carved_chunks + i);
+
+    m_carved_chunks += carved_chunks;
+    m_used_chunks += handed_out_chunks; // All these chunks are in use now.
+
+    return handed_out_chunks;
+}
+
+// This method makes sure that the chunks of the block can be handed out. It maps the block on the first call, and prepares the chunks again after a decommit.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::make_resident() {
+    // Check if you never allocated new memory for you current block.
+    if (!m_is_allocated) {
+        auto* allocated_memory = reinterpret_cast<char*>(memory_mapping::map_region(m_size_block + get_guard_page_size(), chunk_block_alignment, m_page_mode)); // Allocate a new memory block at an aligned address. It throws 'std::bad_alloc' when allocating failed.
+
+        // The page right after the block faults on every access. When protecting fails, the block simply has no guard page.
+        if (get_guard_page_size() != 0)
+            memory_mapping::protect_region(allocated_memory + memory_mapping::round_to_pages(m_size_block), get_guard_page_size());
+
+        // Bind the block to its node, before any page is faulted in. When binding fails, the block simply stays where the operating system puts it.
+        if (m_numa_node != memory_mapping::any_numa_node)
+            memory_mapping::bind_region(allocated_memory, m_size_block, m_numa_node, m_page_mode);
+
+        // Fault in all the pages at once, before anything is written to the block.
+        if (m_fill_mode == block_fill_mode::prefaulted)
+            memory_mapping::prefault_region(allocated_memory, m_size_block, m_page_mode);
+
+        new (allocated_memory) chunk_block_header{m_block_index, m_owner}; // The header is the first part of the block.
+        m_begin_chunk = reinterpret_cast<chunk<T, Alignment>*>(allocated_memory + chunk_offset + m_guard_size); // Your first chunk, right after the header (and its canary).
+        m_is_allocated = true; // After this call, you will always have a memory block.
+
+        prepare_chunks(); // Divide the block into single chunks.
+    }
+    else if (m_is_decommitted) {
+        m_is_decommitted = false; // The pages are given back on the first access, filled with zeros.
+
+        // The dropped pages must be faulted in again, the header page keeps its content.
+        if (m_fill_mode == block_fill_mode::prefaulted)
+            memory_mapping::prefault_region(get_header(), m_size_block, m_page_mode);
+
+        prepare_chunks(); // The links were lost with the pages, so divide the block into single chunks again.
+    }
+}
+
 // This method removes a just allocated chunk. Due to that you are using a linked list under the hood, you are only chancing the 'm_next_node' field from this struct.
-template<typename T>
-void chunk_list<T>::remove_chunk(chunk<T> *free_chunk) noexcept {
-    reinterpret_cast<chunk<T>*>(free_chunk)->m_next_node = m_current_chunk; // This chunk is now at the end of your list.
-    m_current_chunk = reinterpret_cast<chunk<T>*>(free_chunk); // Your current chunk, if you ask new memory, it will return the address of 'free_chunk'. This is allowed within a memory pool allocator.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::remove_chunk(chunk<T, Alignment> *free_chunk) noexcept {
+    free_chunk->m_next_node = m_current_chunk; // This chunk is now at the end of your list.
+    m_current_chunk = free_chunk; // Your current chunk, if you ask new memory, it will return the address of 'free_chunk'. This is allowed within a memory pool allocator.
+    m_used_chunks--; // One less chunk is in use.
+}
+
+// This method removes a chain of allocated chunks at once. The chain is spliced in front of the free list, so its chunks are not visited.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::remove_chunks(chunk<T, Alignment> *first_chunk, chunk<T, Alignment> *last_chunk, std::size_t number_of_chunks) noexcept {
+    last_chunk->m_next_node = m_current_chunk; // The end of the chain points to the old free list.
+    m_current_chunk = first_chunk; // The chain is the front of the free list now.
+    m_used_chunks -= number_of_chunks; // All these chunks are free again.
 }
 
 // This method removes the whole list of chunks. It deallocates the whole block of memory.
-template<typename T>
-void chunk_list<T>::remove_chunk_list() noexcept {
-    // Here, you unmap the just allocated memory. You are passing the first address of the allocated block, together with the number of bytes.
-    if (munmap(m_begin_chunk, m_size_block))
-        std::cerr << "Deallocating memory failed!" << std::endl; // If this function failed deallocating the memory, print this as standard error.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::remove_chunk_list() noexcept {
+    // Only a block that was allocated, can be deallocated. You are passing the first address of the allocated block (its header), together with the number of bytes.
+    if (m_is_allocated)
+        memory_mapping::unmap_region(get_header(), m_size_block + get_guard_page_size(), m_page_mode);
+
+    m_is_allocated = false; // The block is gone.
+    m_is_decommitted = false;
+    m_current_chunk = nullptr;
+    m_begin_chunk = nullptr;
+    m_used_chunks = 0;
+    m_carved_chunks = 0;
+    std::fill(m_allocation_bitmap.begin(), m_allocation_bitmap.end(), 0); // No chunk is in use anymore.
+}
+
+// This method gives the pages of the chunks back to the operating system, but keeps the block mapped. All the chunks must be free.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::decommit_chunk_list() noexcept {
+    // Only a block in physical memory, without any chunk in use, can be decommitted. Explicit huge pages can only be given back as a whole.
+    if (!is_resident() || !is_empty() || m_page_mode == page_mode::explicit_huge)
+        return 0;
+
+    auto* first_page = reinterpret_cast<char*>(get_header()); // The block starts at a page, with the header.
+    auto number_of_bytes = get_size_block() - memory_mapping::page_size(); // Keep the first page, so that the header can still be found.
+
+    // A block of a single page can not be decommitted without losing its header.
+    if (number_of_bytes == 0 || !memory_mapping::decommit_region(first_page + memory_mapping::page_size(), number_of_bytes))
+        return 0;
+
+    m_is_decommitted = true; // The chunks must be prepared again before they are used.
+    m_current_chunk = nullptr;
+    m_carved_chunks = 0;
+
+    return number_of_bytes; // Return the number of bytes that were given back.
+}
+
+// This method changes the index of this block within the list of blocks of its memory pool allocator.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::set_block_index(const size_t &block_index) noexcept {
+    m_block_index = block_index; // Used when the block is allocated later on.
+
+    // The header of an allocated block must point to the new index as well.
+    if (m_is_allocated)
+        get_header()->m_block_index = block_index;
+}
+
+// This method tells whether a chunk of a guarded block is in use, by reading its bit of the bitmap.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_chunk_in_use(const chunk<T, Alignment> *allocated_chunk) const noexcept {
+    auto chunk_index = find_chunk_index(allocated_chunk); // The bit of the chunk, if it is a chunk at all.
+    return chunk_index != no_chunk && (m_allocation_bitmap[chunk_index / 64] >> (chunk_index % 64) & 1) != 0;
+}
+
+// This method checks the canaries of a chunk of a guarded block that is deallocated, marks it free and poisons it. An overwritten canary is reported.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::guard_released_chunk(chunk<T, Alignment> *allocated_chunk) noexcept {
+    // Repair the canaries after the report, so that the same overflow is not reported again.
+    if (!has_intact_canaries(allocated_chunk)) {
+        report_pool_violation(m_violation_handler, pool_violation::buffer_overflow, allocated_chunk);
+        write_canaries(allocated_chunk);
+    }
+
+    mark_chunk(find_chunk_index(allocated_chunk), false);
+    poison_chunk(allocated_chunk); // Every write to this chunk is detected, until it is handed out again.
+}
+
+// This method tells whether this block checks the use of its chunks.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_guarded() const noexcept {
+    return m_debug_mode != pool_debug_mode::none;
+}
+
+// This method tells whether all the chunks of this block are in use.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_full() const noexcept {
+    return m_used_chunks == m_number_of_chunks;
+}
+
+// This method tells whether none of the chunks of this block are in use.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_empty() const noexcept {
+    return m_used_chunks == 0;
+}
+
+// This method tells whether the chunks of this block are in physical memory, so neither unmapped nor decommitted.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_resident() const noexcept {
+    return m_is_allocated && !m_is_decommitted;
+}
+
+// This method returns the number of chunks of this block that are in use.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_used_chunks() const noexcept {
+    return m_used_chunks;
+}
+
+// This method returns the NUMA node that this block is bound to.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_numa_node() const noexcept {
+    return m_numa_node;
+}
+
+// This method returns the number of chunks of this block.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_number_of_chunks() const noexcept {
+    return m_number_of_chunks;
+}
+
+// This method returns the number of bytes that are mapped for this block.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_size_block() const noexcept {
+    return memory_mapping::round_to_pages(m_size_block, m_page_mode); // 'mmap' always maps whole pages.
+}
+
+// This method finds the index of the block that a chunk belongs to, by reading the header of its block.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::find_block_index(const chunk<T, Alignment> *allocated_chunk) noexcept {
+    auto block_begin = reinterpret_cast<std::uintptr_t>(allocated_chunk) & ~(chunk_block_alignment - 1); // Clear the lower bits, this gives the start of the block.
+    return reinterpret_cast<const chunk_block_header*>(block_begin)->m_block_index; // The header is at the start of the block.
+}
+
+// This method finds the memory pool allocator that a chunk belongs to, by reading the header of its block.
+template<typename T, std::size_t Alignment>
+void *chunk_list<T, Alignment>::find_owner(const chunk<T, Alignment> *allocated_chunk) noexcept {
+    auto block_begin = reinterpret_cast<std::uintptr_t>(allocated_chunk) & ~(chunk_block_alignment - 1); // Clear the lower bits, this gives the start of the block.
+    return reinterpret_cast<const chunk_block_header*>(block_begin)->m_owner; // The header is at the start of the block.
+}
+
+// This method calculates the number of chunks of a block. The chunks fill all the pages that are needed for the requested number of chunks.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::fill_pages(const size_t &number_of_chunks, page_mode mode, std::size_t guard_size) noexcept {
+    auto first_chunk_offset = chunk_offset + guard_size; // The first chunk follows the header, and its canary.
+    auto chunk_stride = sizeof(chunk<T, Alignment>) + guard_size; // Every chunk is followed by a canary.
+
+    auto limited_chunks = std::min(std::max(number_of_chunks, std::size_t{1}), (chunk_block_alignment - first_chunk_offset) / chunk_stride); // A block has at least one chunk, and is never bigger than its alignment.
+    auto mapped_bytes = memory_mapping::round_to_pages(first_chunk_offset + limited_chunks * chunk_stride, mode); // The bytes that 'mmap' maps anyway.
+
+    return (std::min(mapped_bytes, chunk_block_alignment) - first_chunk_offset) / chunk_stride; // All the chunks that fit in these pages.
+}
+
+// This method calculates the number of bytes of the canaries between the chunks.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::find_guard_size(pool_debug_mode debug_mode) noexcept {
+    // A canary keeps the next chunk aligned, so it is rounded up to the alignment of a chunk.
+    if (debug_mode == pool_debug_mode::none)
+        return 0;
+
+    return std::max(sizeof(std::uint64_t), alignof(chunk<T, Alignment>));
+}
+
+// This method returns a chunk of this block by its index.
+template<typename T, std::size_t Alignment>
+chunk<T, Alignment> *chunk_list<T, Alignment>::chunk_at(std::size_t chunk_index) const noexcept {
+    return reinterpret_cast<chunk<T, Alignment>*>(reinterpret_cast<char*>(m_begin_chunk) + chunk_index * (sizeof(chunk<T, Alignment>) + m_guard_size));
+}
+
+// This method finds the index of a chunk within this block.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::find_chunk_index(const chunk<T, Alignment> *allocated_chunk) const noexcept {
+    auto chunk_stride = sizeof(chunk<T, Alignment>) + m_guard_size; // The distance between two chunks.
+    auto chunk_distance = reinterpret_cast<std::uintptr_t>(allocated_chunk) - reinterpret_cast<std::uintptr_t>(m_begin_chunk); // An address in front of the first chunk wraps around, so it is too big.
+
+    // The address must be the start of a chunk, that was handed out at least once.
+    if (!is_resident() || chunk_distance % chunk_stride != 0 || chunk_distance / chunk_stride >= m_carved_chunks)
+        return no_chunk;
+
+    return chunk_distance / chunk_stride;
+}
+
+// This method writes the canaries in front of a chunk and after it.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::write_canaries(chunk<T, Alignment> *guarded_chunk) noexcept {
+    auto* front_canary = reinterpret_cast<std::uint64_t*>(reinterpret_cast<char*>(guarded_chunk) - m_guard_size); // The canary in front of the chunk.
+    auto* back_canary = reinterpret_cast<std::uint64_t*>(reinterpret_cast<char*>(guarded_chunk) + sizeof(chunk<T, Alignment>)); // The canary after the chunk.
+
+    std::fill_n(front_canary, m_guard_size / sizeof(std::uint64_t), chunk_canary);
+    std::fill_n(back_canary, m_guard_size / sizeof(std::uint64_t), chunk_canary);
+}
+
+// This method checks whether the canaries in front of a chunk and after it still have their pattern.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::has_intact_canaries(const chunk<T, Alignment> *guarded_chunk) const noexcept {
+    auto* front_canary = reinterpret_cast<const std::uint64_t*>(reinterpret_cast<const char*>(guarded_chunk) - m_guard_size); // The canary in front of the chunk.
+    auto* back_canary = reinterpret_cast<const std::uint64_t*>(reinterpret_cast<const char*>(guarded_chunk) + sizeof(chunk<T, Alignment>)); // The canary after the chunk.
+    auto is_canary = [](std::uint64_t word) { return word == chunk_canary; }; // A word of a canary must still have the pattern.
+
+    return std::all_of(front_canary, front_canary + m_guard_size / sizeof(std::uint64_t), is_canary) && std::all_of(back_canary, back_canary + m_guard_size / sizeof(std::uint64_t), is_canary);
+}
+
+// This method poisons all the bytes of a chunk, after the address to the next chunk.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::poison_chunk(chunk<T, Alignment> *guarded_chunk) noexcept {
+    auto* chunk_bytes = reinterpret_cast<unsigned char*>(guarded_chunk); // The raw bytes of the chunk.
+    std::fill(chunk_bytes + sizeof(chunk<T, Alignment>*), chunk_bytes + sizeof(chunk<T, Alignment>), chunk_poison); // The address to the next chunk is written by the free list itself.
+}
+
+// This method checks whether all the bytes of a chunk, after the address to the next chunk, are still poisoned.
+template<typename T, std::size_t Alignment>
+bool chunk_list<T, Alignment>::is_poisoned(const chunk<T, Alignment> *guarded_chunk) const noexcept {
+    auto* chunk_bytes = reinterpret_cast<const unsigned char*>(guarded_chunk); // The raw bytes of the chunk.
+    return std::all_of(chunk_bytes + sizeof(chunk<T, Alignment>*), chunk_bytes + sizeof(chunk<T, Alignment>), [](unsigned char single_byte) { return single_byte == chunk_poison; });
+}
+
+// This method changes the bit of a chunk within the bitmap of the chunks in use.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::mark_chunk(std::size_t chunk_index, bool is_in_use) noexcept {
+    auto chunk_bit = std::uint64_t{1} << (chunk_index % 64); // The bit of the chunk within its word.
+
+    if (is_in_use)
+        m_allocation_bitmap[chunk_index / 64] |= chunk_bit;
+    else
+        m_allocation_bitmap[chunk_index / 64] &= ~chunk_bit;
+}
+
+// This method checks a chunk that is taken from the free list of a guarded block. Its poison must be intact, and the next chunk of the free list must be a free chunk of this block.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::guard_reused_chunk(chunk<T, Alignment> *reused_chunk) noexcept {
+    mark_chunk(find_chunk_index(reused_chunk), true); // It is in use from now on, so it is never linked again by a rebuild.
+
+    // An overwritten address to the next chunk would send the next allocation anywhere. The free list is rebuilt from the bitmap instead.
+    bool is_linked = m_current_chunk == nullptr || (find_chunk_index(m_current_chunk) != no_chunk && !is_chunk_in_use(m_current_chunk)); // Indication whether the free list continues at a free chunk.
+
+    if (!is_linked || !is_poisoned(reused_chunk))
+        report_pool_violation(m_violation_handler, pool_violation::use_after_free, reused_chunk);
+
+    if (!is_linked)
+        rebuild_free_list();
+}
+
+// This method prepares a chunk of a guarded block that was never handed out, by writing its canaries.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::guard_carved_chunk(chunk<T, Alignment> *carved_chunk) noexcept {
+    auto chunk_index = m_carved_chunks - 1; // The chunk that was carved last.
+
+    // The canary in front of a chunk is the canary after the chunk before it. Writing it again would hide an overflow of that chunk, so only the first chunk writes it.
+    if (chunk_index == 0)
+        write_canaries(carved_chunk);
+    else
+        std::fill_n(reinterpret_cast<std::uint64_t*>(reinterpret_cast<char*>(carved_chunk) + sizeof(chunk<T, Alignment>)), m_guard_size / sizeof(std::uint64_t), chunk_canary);
+
+    mark_chunk(chunk_index, true);
+}
+
+// This method links all the free chunks that were ever handed out again, by reading the bitmap. It is used when the free list of a guarded block is overwritten.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::rebuild_free_list() noexcept {
+    m_current_chunk = nullptr; // Start with an empty free list.
+
+    // Link every chunk whose bit is not set, from the last one to the first one.
+    for (auto chunk_index = m_carved_chunks; chunk_index > 0; chunk_index--) {
+        auto* free_chunk = chunk_at(chunk_index - 1); // The chunk that may be free.
+
+        if (is_chunk_in_use(free_chunk))
+            continue;
+
+        poison_chunk(free_chunk);
+        free_chunk->m_next_node = m_current_chunk;
+        m_current_chunk = free_chunk;
+    }
+}
+
+// This method returns the number of bytes of the guard page after this block.
+template<typename T, std::size_t Alignment>
+std::size_t chunk_list<T, Alignment>::get_guard_page_size() const noexcept {
+    // A huge page can not be protected partly, so only a block of normal pages gets a guard page.
+    return m_debug_mode == pool_debug_mode::guard_pages && m_page_mode == page_mode::normal ? memory_mapping::page_size() : 0;
+}
+
+// This method makes all the chunks of the block free. With a linked block they are linked to each other, otherwise they are carved out later on.
+template<typename T, std::size_t Alignment>
+void chunk_list<T, Alignment>::prepare_chunks() noexcept {
+    m_current_chunk = nullptr; // The free list is empty, the chunks of a lazy block are only carved out on request.
+    m_carved_chunks = 0;
+
+    if (m_fill_mode != block_fill_mode::linked)
+        return;
+
+    auto* current_memory_element = m_begin_chunk; // Indication for your current memory address.
+
+    // Go through the allocated block of memory, and divide smaller parts for single chunks. This allows for less fragmentation within you memory.
+    for (std::size_t i = 0; i < m_number_of_chunks - 1; i++) {
+        current_memory_element->m_next_node = chunk_at(i + 1); // Allocate memory for a single chunk out of the bigger block of memory.
+        current_memory_element = current_memory_element->m_next_node; // Go to the next chunk, you also want to allocate memory for the next chunk, unless you reached the maximum number of chunks.
+    }
+
+    current_memory_element->m_next_node = nullptr; // Last in the block of memory, it must be a 'nullptr'.
+    m_current_chunk = m_begin_chunk; // First element in the allocated block of memory.
+    m_carved_chunks = m_number_of_chunks; // All the chunks are in the free list, so nothing is left to carve.
+
+    // A guarded block gets all its canaries and all its poison at once. Linking already touched all its pages.
+    if (is_guarded()) {
+        for (std::size_t i = 0; i < m_number_of_chunks; i++) {
+            write_canaries(chunk_at(i));
+            poison_chunk(chunk_at(i));
+        }
+    }
+}
+
+// This method returns the header of this block.
+template<typename T, std::size_t Alignment>
+chunk_block_header *chunk_list<T, Alignment>::get_header() const noexcept {
+    return reinterpret_cast<chunk_block_header*>(reinterpret_cast<char*>(m_begin_chunk) - m_guard_size - chunk_offset); // The header is right in front of the first chunk (and its canary).
 }
 
-template<typename T>
-[[maybe_unused]] void chunk_list<T>::used_memory(chunk<T> *pointer_to_memory, const size_t &number_of_bytes, bool is_allocating) {
+template<typename T, std::size_t Alignment>
+[[maybe_unused]] void chunk_list<T, Alignment>::used_memory(chunk<T, Alignment> *pointer_to_memory, const size_t &number_of_bytes, bool is_allocating) {
     // Show a message of allocating/deallocating.
     std::cout << "---- ALLOCATOR MESSAGE ---- \t" << (is_allocating ? "Allocated memory: " : "Deallocated memory: ")
         << sizeof(T) * number_of_bytes << " bytes at address: " << std::hex << std::showbase << reinterpret_cast<T*>(pointer_to_memory) << std::dec << std::endl;
 }
 
-#endif
\ No newline at end of file
+#endif
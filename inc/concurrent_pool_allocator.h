@@ -0,0 +1,228 @@
+#ifndef ALLOCATOR_CONCURRENT_POOL_ALLOCATOR_H
+#define ALLOCATOR_CONCURRENT_POOL_ALLOCATOR_H
+
+#include <array> // Include here all the 'array' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <mutex> // Include here all the 'mutex' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+#include "block_allocator.h" // Include here all the 'block_allocator' facilities.
+#include "chunk_list.h" // Include here all the 'chunk_list' facilities.
+#include "lock_free_chunk_stack.h" // Include here all the 'lock_free_chunk_stack' facilities.
+#include "thread_slot_registry.h" // Include here all the 'thread_slot_registry' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This is a memory pool allocator that can be shared by multiple threads. Every thread has its own cache with free chunks, called a 'magazine'.
+// Allocating and deallocating only touch the magazine of the calling thread, so no synchronization is needed at all on the fast path.
+// When a magazine runs empty it is refilled with a whole batch of chunks from a shared 'depot', and when it runs full a whole batch is flushed back to the depot.
+// The free chunks of the depot are kept in a lock-free stack, so even these batch transfers do not take a lock. Only carving a new block takes the block lock.
+// A chunk can be freed by any thread, not only by the thread that allocated it. It simply ends up in the magazine of the freeing thread.
+// Each thread keeps two magazines (a 'loaded' and a 'previous' one), so that a thread that allocates and frees around a magazine boundary does not hit the depot every time.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the 'concurrent_pool_allocator' class, that represents a memory pool allocator that can be used from multiple threads at the same time.
+/// \tparam T The type of this specific class.
+template <typename T>
+class concurrent_pool_allocator {
+public:
+    /// This is the constructor of the 'concurrent_pool_allocator' class.
+    /// \param chunk_per_blocks This is the number of chunks that a block of memory will contain. This is NOT in bytes!
+    /// \param magazine_capacity This is the number of chunks that a single magazine of a thread can hold. With zero, every call goes to the depot.
+    explicit concurrent_pool_allocator(const std::size_t& chunk_per_blocks, const std::size_t& magazine_capacity = 32);
+
+    /// This is the destructor of the 'concurrent_pool_allocator' class. All the threads must have stopped using this allocator.
+    ~concurrent_pool_allocator();
+
+    /// A concurrent memory pool can not be copied, because the threads refer to its caches.
+    concurrent_pool_allocator(const concurrent_pool_allocator&) = delete;
+
+    /// A concurrent memory pool can not be copied, because the threads refer to its caches.
+    concurrent_pool_allocator& operator=(const concurrent_pool_allocator&) = delete;
+
+    /// This method allocates memory for a new chunk. It can be called from any thread.
+    /// \return The address of an allocated chunk.
+    [[maybe_unused]] chunk<T>* allocate();
+
+    /// This method releases memory for an allocated chunk. It can be called from any thread, also from another thread than the allocating one.
+    /// \param release_chunk The address of the chunk that you want to deallocate.
+    [[maybe_unused]] void deallocate(chunk<T>* release_chunk) noexcept;
+
+private:
+    /// This structure 'thread_cache' holds the two magazines of a single thread. It is aligned to a cache line, so that threads do not share cache lines.
+    struct alignas(64) thread_cache {
+        std::vector<chunk<T>*> m_loaded_magazine; // This is the magazine that is used for allocating and deallocating.
+        std::vector<chunk<T>*> m_previous_magazine; // This is the magazine that was used before, it is either full or empty.
+    };
+
+    /// This method returns the cache of the calling thread, and creates it when the thread uses this allocator for the first time.
+    /// \return The cache of the calling thread, or a 'nullptr' when the thread has no cache (no slot left, or no memory for the cache).
+    thread_cache* get_thread_cache() noexcept;
+
+    /// This method refills an empty magazine with a batch of chunks from the depot.
+    /// \param empty_magazine The magazine that has to be refilled.
+    void refill_magazine(std::vector<chunk<T>*>& empty_magazine);
+
+    /// This method flushes a whole magazine back to the depot, with a single push of the whole chain.
+    /// \param full_magazine The magazine that has to be flushed.
+    void flush_magazine(std::vector<chunk<T>*>& full_magazine) noexcept;
+
+    /// This method carves a single new chunk out of the last block. The block lock must be held.
+    /// \return The address to a free chunk.
+    chunk<T>* carve_block_chunk();
+
+    std::array<std::unique_ptr<thread_cache>, thread_slot_registry::max_thread_slots> m_thread_caches; // This field contains the caches of all the threads, indexed by their slot. A slot is only touched by its own thread.
+
+    lock_free_chunk_stack<T> m_depot_chunks; // This field is the list of free chunks within the depot. It is shared by all the threads without a lock.
+
+    std::mutex m_block_mutex; // This mutex protects the blocks, this are all the fields below.
+    std::vector<chunk_list<T>, block_allocator<chunk_list<T>>> m_block_list; // This field is a vector of blocks, that uses a custom allocator. New chunks are carved out of the last block.
+    std::size_t m_chunks_per_block; // The number of chunks per block.
+    std::size_t m_magazine_capacity; // The number of chunks a single magazine can hold.
+};
+
+// This is the constructor of the 'concurrent_pool_allocator' class.
+template<typename T>
+concurrent_pool_allocator<T>::concurrent_pool_allocator(const std::size_t &chunk_per_blocks, const std::size_t &magazine_capacity) :
+    m_thread_caches{},
+    m_depot_chunks{},
+    m_block_mutex{},
+    m_block_list{},
+    m_chunks_per_block{chunk_per_blocks},
+    m_magazine_capacity{magazine_capacity}
+{}
+
+// This is the destructor of the 'concurrent_pool_allocator' class. All the threads must have stopped using this allocator.
+template<typename T>
+concurrent_pool_allocator<T>::~concurrent_pool_allocator() {
+    // Go through all the blocks, deallocate the memory for the list of chunks. The magazines only contain addresses within these blocks.
+    for ([[maybe_unused]] auto& single_block : m_block_list)
+        single_block.remove_chunk_list();
+}
+
+// This method allocates memory for a new chunk. It can be called from any thread.
+template<typename T>
+[[maybe_unused]] chunk<T> *concurrent_pool_allocator<T>::allocate() {
+    auto* current_cache = get_thread_cache(); // The cache of the calling thread.
+
+    // Without a cache, you have to go to the depot for every single chunk.
+    if (current_cache == nullptr) {
+        if (auto* free_memory_chunk = m_depot_chunks.pop())
+            return free_memory_chunk;
+
+        std::lock_guard<std::mutex> block_lock{m_block_mutex};
+        return carve_block_chunk();
+    }
+
+    auto& loaded_magazine = current_cache->m_loaded_magazine; // The magazine you are allocating from.
+
+    // The loaded magazine is empty. Use the previous one if it still has chunks, otherwise get a new batch from the depot.
+    if (loaded_magazine.empty()) {
+        if (!current_cache->m_previous_magazine.empty())
+            loaded_magazine.swap(current_cache->m_previous_magazine);
+        else
+            refill_magazine(loaded_magazine);
+    }
+
+    auto* free_memory_chunk = loaded_magazine.back(); // Take the most recently freed chunk, it is probably still in your cache.
+    loaded_magazine.pop_back();
+
+    return free_memory_chunk; // Return the free chunk.
+}
+
+// This method releases memory for an allocated chunk. It can be called from any thread, also from another thread than the allocating one.
+template<typename T>
+[[maybe_unused]] void concurrent_pool_allocator<T>::deallocate(chunk<T>* release_chunk) noexcept {
+    auto* current_cache = get_thread_cache(); // The cache of the calling thread.
+
+    // Without a cache, you have to return the chunk directly to the depot.
+    if (current_cache == nullptr) {
+        m_depot_chunks.push(release_chunk);
+        return;
+    }
+
+    auto& loaded_magazine = current_cache->m_loaded_magazine; // The magazine you are deallocating to.
+
+    // The loaded magazine is full. Continue with the previous one, after flushing it to the depot when it is full as well.
+    if (loaded_magazine.size() == m_magazine_capacity) {
+        if (!current_cache->m_previous_magazine.empty())
+            flush_magazine(current_cache->m_previous_magazine);
+
+        loaded_magazine.swap(current_cache->m_previous_magazine);
+    }
+
+    loaded_magazine.push_back(release_chunk); // This never allocates, the magazine has reserved its full capacity.
+}
+
+// This method returns the cache of the calling thread, and creates it when the thread uses this allocator for the first time.
+template<typename T>
+typename concurrent_pool_allocator<T>::thread_cache *concurrent_pool_allocator<T>::get_thread_cache() noexcept {
+    auto current_slot = thread_slot_registry::current_slot(); // The slot of the calling thread.
+
+    // A thread without a slot, or a pool without magazines, does not use a cache.
+    if (current_slot == thread_slot_registry::no_thread_slot || m_magazine_capacity == 0)
+        return nullptr;
+
+    auto& current_cache = m_thread_caches[current_slot]; // Only this thread touches this element, so no lock is needed.
+
+    // Create the cache when this is the first time this slot is used.
+    if (!current_cache) {
+        try {
+            auto new_cache = std::make_unique<thread_cache>();
+            new_cache->m_loaded_magazine.reserve(m_magazine_capacity); // Reserve the full capacity, so that deallocating never allocates.
+            new_cache->m_previous_magazine.reserve(m_magazine_capacity);
+            current_cache = std::move(new_cache);
+        }
+        catch (const std::bad_alloc&) {
+            return nullptr; // There is no memory for a cache, fall back on the depot.
+        }
+    }
+
+    return current_cache.get(); // Return the cache of this thread.
+}
+
+// This method refills an empty magazine with a batch of chunks from the depot.
+template<typename T>
+void concurrent_pool_allocator<T>::refill_magazine(std::vector<chunk<T>*> &empty_magazine) {
+    // First reuse the chunks that were flushed by the threads.
+    while (empty_magazine.size() < m_magazine_capacity) {
+        auto* free_memory_chunk = m_depot_chunks.pop();
+
+        // The depot is empty, the rest has to come from a block.
+        if (free_memory_chunk == nullptr)
+            break;
+
+        empty_magazine.push_back(free_memory_chunk);
+    }
+
+    // The depot did not have enough chunks, carve the rest out of the blocks. The block lock is only taken once for the whole batch.
+    if (empty_magazine.size() < m_magazine_capacity) {
+        std::lock_guard<std::mutex> block_lock{m_block_mutex};
+
+        while (empty_magazine.size() < m_magazine_capacity)
+            empty_magazine.push_back(carve_block_chunk());
+    }
+}
+
+// This method flushes a whole magazine back to the depot, with a single push of the whole chain.
+template<typename T>
+void concurrent_pool_allocator<T>::flush_magazine(std::vector<chunk<T>*> &full_magazine) noexcept {
+    // Link all the chunks of the magazine to each other, so that the depot only has to splice a single chain.
+    for (std::size_t i = 0; i + 1 < full_magazine.size(); i++)
+        full_magazine[i]->m_next_node = full_magazine[i + 1];
+
+    m_depot_chunks.push_chain(full_magazine.front(), full_magazine.back()); // The whole chain goes on top of the depot at once.
+    full_magazine.clear(); // The magazine is empty again, its capacity is kept.
+}
+
+// This method carves a single new chunk out of the last block. The block lock must be held.
+template<typename T>
+chunk<T> *concurrent_pool_allocator<T>::carve_block_chunk() {
+    // Check if you have reached the end of the last block. The chunks of a block are only handed out once, so a block is full for good.
+    if (m_block_list.empty() || m_block_list.back().is_full())
+        m_block_list.push_back(chunk_list<T>{m_chunks_per_block, 0, page_mode::normal, block_fill_mode::lazy}); // Create a new block with chunks. Its chunks never come back to the block, so they are carved lazily.
+
+    return m_block_list.back().get_free_chunk(); // Get a free chunk.
+}
+
+#endif
@@ -0,0 +1,270 @@
+#ifndef ALLOCATOR_GROWABLE_VECTOR_H
+#define ALLOCATOR_GROWABLE_VECTOR_H
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+
+#include "malloc_allocator.h" // Include here all the 'malloc_allocator' facilities.
+#include "reallocation_traits.h" // Include here all the 'reallocation_traits' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This is a small vector, that grows its buffer with the help of its allocator. When the buffer is full, its capacity is doubled in one of three ways:
+// First, the allocator is asked to grow the buffer in place with 'try_expand'. Nothing moves, so this works for every type.
+// Second, for a trivially copyable type, the allocator is asked to 'reallocate' the buffer. 'realloc' and 'mremap' move whole pages, instead of copying every byte.
+// Only when both are not possible, a new buffer is allocated, the elements are moved into it, and the old buffer is deallocated. This is what 'std::vector' always does.
+// The vector counts how often every way was taken, so a benchmark or a test can tell whether the allocator helped.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'growable_vector'. It is a vector that grows its buffer in place, or lets its allocator move it, before it copies its elements.
+/// \tparam T The type of the elements.
+/// \tparam Allocator The allocator of the buffer. It may have a 'try_expand' and a 'reallocate' method.
+template <typename T, typename Allocator = malloc_allocator<T>>
+class growable_vector {
+public:
+    /// You must specify this type definition within a container. It is an value type.
+    [[maybe_unused]] typedef T value_type;
+
+    /// This is the constructor of the 'growable_vector' class. The buffer is allocated with the first element.
+    /// \param allocator The allocator of the buffer.
+    explicit growable_vector(const Allocator& allocator = Allocator{});
+
+    /// This is the destructor of the 'growable_vector' class. It destroys all the elements, and deallocates the buffer.
+    ~growable_vector();
+
+    /// A growable vector can not be copied, its buffer is meant to be big.
+    growable_vector(const growable_vector&) = delete;
+
+    /// A growable vector can not be copied, its buffer is meant to be big.
+    growable_vector& operator=(const growable_vector&) = delete;
+
+    /// This method constructs a new element at the end of the vector. The buffer grows when it is full.
+    /// \tparam Args The types of the arguments of the constructor.
+    /// \param arguments The arguments that are passed to the constructor of 'T'.
+    /// \return A reference to the new element.
+    template <typename... Args>
+    T& emplace_back(Args&&... arguments);
+
+    /// This method copies an element to the end of the vector.
+    /// \param value The element that you want to add.
+    void push_back(const T& value);
+
+    /// This method moves an element to the end of the vector.
+    /// \param value The element that you want to add.
+    void push_back(T&& value);
+
+    /// This method destroys the last element of the vector. The vector may not be empty.
+    void pop_back() noexcept;
+
+    /// This method makes sure that the buffer has room for the given number of elements.
+    /// \param number_of_elements The number of elements the buffer must have room for. This is NOT in bytes!
+    void reserve(std::size_t number_of_elements);
+
+    /// This method changes the number of elements. New elements are value initialized, the elements above the new size are destroyed.
+    /// \param number_of_elements The new number of elements.
+    void resize(std::size_t number_of_elements);
+
+    /// This method destroys all the elements. The buffer is kept.
+    void clear() noexcept;
+
+    /// This operator returns an element of the vector.
+    /// \param index The index of the element, it must be below the size.
+    /// \return A reference to the element.
+    T& operator[](std::size_t index) noexcept { return m_data[index]; }
+
+    /// This operator returns an element of the vector.
+    /// \param index The index of the element, it must be below the size.
+    /// \return A constant reference to the element.
+    const T& operator[](std::size_t index) const noexcept { return m_data[index]; }
+
+    /// This method returns the buffer of the vector.
+    /// \return The address of the first element, or a 'nullptr' when nothing is allocated yet.
+    [[nodiscard]] T* data() noexcept { return m_data; }
+
+    /// This method returns the buffer of the vector.
+    /// \return The address of the first element, or a 'nullptr' when nothing is allocated yet.
+    [[nodiscard]] const T* data() const noexcept { return m_data; }
+
+    /// This method returns the first element, for range-based for loops.
+    /// \return The address of the first element.
+    [[nodiscard]] T* begin() noexcept { return m_data; }
+
+    /// This method returns the end of the elements, for range-based for loops.
+    /// \return The address right after the last element.
+    [[nodiscard]] T* end() noexcept { return m_data + m_size; }
+
+    /// This method returns the number of elements.
+    /// \return The number of elements.
+    [[nodiscard]] std::size_t size() const noexcept { return m_size; }
+
+    /// This method returns the number of elements the buffer has room for.
+    /// \return The capacity of the buffer, it is NOT in bytes!
+    [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+    /// This method tells whether the vector has no elements.
+    /// \return True if the vector is empty.
+    [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+    /// This method returns the number of times the buffer grew in place.
+    /// \return The number of in-place growths.
+    [[nodiscard]] std::size_t get_number_of_expansions() const noexcept { return m_number_of_expansions; }
+
+    /// This method returns the number of times the buffer was moved by the allocator itself.
+    /// \return The number of reallocations.
+    [[nodiscard]] std::size_t get_number_of_reallocations() const noexcept { return m_number_of_reallocations; }
+
+    /// This method returns the number of times the elements were moved to a new buffer one by one.
+    /// \return The number of copies.
+    [[nodiscard]] std::size_t get_number_of_copies() const noexcept { return m_number_of_copies; }
+
+private:
+    using allocator_traits = std::allocator_traits<Allocator>; // The traits that allocate and deallocate the buffer.
+    using growth_traits = reallocation_traits<Allocator>; // The traits that grow the buffer.
+
+    /// This method gives the buffer room for the given number of elements. It tries to grow in place, then to reallocate, and only then it copies.
+    /// \param new_capacity The new capacity, it must be bigger than the current one.
+    void grow(std::size_t new_capacity);
+
+    /// This method calculates the capacity after the buffer is full.
+    /// \return The doubled capacity, at least a single element.
+    [[nodiscard]] std::size_t next_capacity() const noexcept { return std::max(m_capacity * 2, std::size_t{1}); }
+
+    Allocator m_allocator; // This field is the allocator of the buffer.
+    T* m_data; // This field is the buffer with the elements.
+    std::size_t m_size; // This field indicates the number of elements.
+    std::size_t m_capacity; // This field indicates the number of elements the buffer has room for.
+    std::size_t m_number_of_expansions; // The number of times the buffer grew in place.
+    std::size_t m_number_of_reallocations; // The number of times the buffer was moved by the allocator.
+    std::size_t m_number_of_copies; // The number of times the elements were moved one by one.
+};
+
+// This is the constructor of the 'growable_vector' class. The buffer is allocated with the first element.
+template<typename T, typename Allocator>
+growable_vector<T, Allocator>::growable_vector(const Allocator &allocator) :
+    m_allocator{allocator},
+    m_data{nullptr},
+    m_size{0},
+    m_capacity{0},
+    m_number_of_expansions{0},
+    m_number_of_reallocations{0},
+    m_number_of_copies{0}
+{}
+
+// This is the destructor of the 'growable_vector' class. It destroys all the elements, and deallocates the buffer.
+template<typename T, typename Allocator>
+growable_vector<T, Allocator>::~growable_vector() {
+    clear();
+
+    if (m_data != nullptr)
+        allocator_traits::deallocate(m_allocator, m_data, m_capacity);
+}
+
+// This method constructs a new element at the end of the vector. The buffer grows when it is full.
+template<typename T, typename Allocator>
+template<typename... Args>
+T &growable_vector<T, Allocator>::emplace_back(Args&&... arguments) {
+    // The arguments may refer to an element of this vector, so the new element is constructed before the buffer moves.
+    if (m_size == m_capacity) {
+        T new_element(std::forward<Args>(arguments)...);
+        grow(next_capacity());
+
+        return *std::construct_at(m_data + m_size++, std::move(new_element));
+    }
+
+    return *std::construct_at(m_data + m_size++, std::forward<Args>(arguments)...);
+}
+
+// This method copies an element to the end of the vector.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+}
+
+// This method moves an element to the end of the vector.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+}
+
+// This method destroys the last element of the vector. The vector may not be empty.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::pop_back() noexcept {
+    std::destroy_at(m_data + --m_size);
+}
+
+// This method makes sure that the buffer has room for the given number of elements.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::reserve(std::size_t number_of_elements) {
+    if (number_of_elements > m_capacity)
+        grow(number_of_elements);
+}
+
+// This method changes the number of elements. New elements are value initialized, the elements above the new size are destroyed.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::resize(std::size_t number_of_elements) {
+    reserve(number_of_elements);
+
+    while (m_size < number_of_elements)
+        std::construct_at(m_data + m_size++);
+
+    while (m_size > number_of_elements)
+        pop_back();
+}
+
+// This method destroys all the elements. The buffer is kept.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::clear() noexcept {
+    std::destroy_n(m_data, m_size);
+    m_size = 0;
+}
+
+// This method gives the buffer room for the given number of elements. It tries to grow in place, then to reallocate, and only then it copies.
+template<typename T, typename Allocator>
+void growable_vector<T, Allocator>::grow(std::size_t new_capacity) {
+    // The first buffer is simply allocated.
+    if (m_data == nullptr) {
+        m_data = allocator_traits::allocate(m_allocator, new_capacity);
+        m_capacity = new_capacity;
+        return;
+    }
+
+    // Growing in place does not move anything.
+    if (growth_traits::try_expand(m_allocator, m_data, m_capacity, new_capacity)) {
+        m_capacity = new_capacity;
+        m_number_of_expansions++;
+        return;
+    }
+
+    // The allocator moves the buffer itself, for instance with 'realloc' or 'mremap'.
+    if constexpr (growth_traits::can_reallocate) {
+        m_data = growth_traits::reallocate(m_allocator, m_data, m_capacity, new_capacity);
+        m_capacity = new_capacity;
+        m_number_of_reallocations++;
+        return;
+    }
+    else {
+        auto* new_data = allocator_traits::allocate(m_allocator, new_capacity); // The new buffer.
+        std::size_t moved_elements{0}; // The number of elements that are moved to the new buffer.
+
+        // Move the elements one by one. When moving can throw, they are copied, so that the old buffer stays intact.
+        try {
+            for (; moved_elements < m_size; moved_elements++)
+                std::construct_at(new_data + moved_elements, std::move_if_noexcept(m_data[moved_elements]));
+        }
+        catch (...) {
+            std::destroy_n(new_data, moved_elements);
+            allocator_traits::deallocate(m_allocator, new_data, new_capacity);
+            throw;
+        }
+
+        std::destroy_n(m_data, m_size);
+        allocator_traits::deallocate(m_allocator, m_data, m_capacity);
+
+        m_data = new_data;
+        m_capacity = new_capacity;
+        m_number_of_copies++;
+    }
+}
+
+#endif
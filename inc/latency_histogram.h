@@ -0,0 +1,79 @@
+#ifndef ALLOCATOR_LATENCY_HISTOGRAM_H
+#define ALLOCATOR_LATENCY_HISTOGRAM_H
+
+#include <array> // Include here all the 'array' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <limits> // Include here all the 'limits' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// A loop of allocations that is timed as a whole only shows the mean. The single allocation that maps a new block is hidden between thousands of allocations from the free list.
+// A 'latency_histogram' records the latency of every single call instead. Storing every latency costs too much memory, so the latencies are counted in buckets, just like an HDR histogram.
+// The buckets are log-linear: every power of two is split in 32 buckets of the same width. Below 64 nanoseconds every bucket is a single nanosecond.
+// So the relative error of a recorded latency is at most 1/32 (about 3%), for any latency up to the full 64 bits. This takes 1920 counters, and no memory is allocated while recording.
+// Recording only counts the latency in its bucket, which is a shift and an increment. A percentile is the highest latency within the bucket where that percentile falls, so it is never too optimistic.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'latency_histogram'. It counts latencies in nanoseconds in log-linear buckets, and answers percentile queries on them.
+class latency_histogram {
+public:
+    /// This method records a single latency.
+    /// \param latency The latency in nanoseconds.
+    void record(std::uint64_t latency) noexcept;
+
+    /// This method adds all the latencies of another histogram to this one.
+    /// \param other_histogram The histogram whose latencies are added.
+    void merge(const latency_histogram& other_histogram) noexcept;
+
+    /// This method forgets all the recorded latencies.
+    void reset() noexcept;
+
+    /// This method returns a percentile of the recorded latencies.
+    /// \param fraction The percentile as a fraction, so 0.999 for the 99.9th percentile.
+    /// \return The highest latency within the bucket of the percentile, in nanoseconds. Zero without any latencies.
+    [[nodiscard]] std::uint64_t get_percentile(double fraction) const noexcept;
+
+    /// This method returns the number of recorded latencies.
+    /// \return The number of latencies.
+    [[nodiscard]] std::uint64_t get_count() const noexcept;
+
+    /// This method returns the lowest recorded latency.
+    /// \return The exact lowest latency in nanoseconds. Zero without any latencies.
+    [[nodiscard]] std::uint64_t get_minimum() const noexcept;
+
+    /// This method returns the highest recorded latency.
+    /// \return The exact highest latency in nanoseconds.
+    [[nodiscard]] std::uint64_t get_maximum() const noexcept;
+
+    /// This method returns the mean of the recorded latencies.
+    /// \return The exact mean in nanoseconds. Zero without any latencies.
+    [[nodiscard]] double get_mean() const noexcept;
+
+private:
+    /// The number of bits of the buckets within a single power of two. So every power of two has 32 buckets.
+    static constexpr std::size_t sub_bucket_bits = 5;
+
+    /// The number of buckets within a single power of two.
+    static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+
+    /// The number of buckets for all the 64-bit latencies.
+    static constexpr std::size_t bucket_count = (64 - sub_bucket_bits + 1) * sub_bucket_count;
+
+    /// This method returns the bucket of a latency.
+    /// \param latency The latency in nanoseconds.
+    /// \return The index of the bucket.
+    static std::size_t bucket_index(std::uint64_t latency) noexcept;
+
+    /// This method returns the highest latency within a bucket.
+    /// \param index The index of the bucket.
+    /// \return The highest latency in nanoseconds that is counted in this bucket.
+    static std::uint64_t highest_latency(std::size_t index) noexcept;
+
+    std::array<std::uint64_t, bucket_count> m_counts{}; // This field contains the number of latencies within every bucket.
+    std::uint64_t m_total_count{0}; // This field is the number of recorded latencies.
+    std::uint64_t m_minimum{std::numeric_limits<std::uint64_t>::max()}; // This field is the exact lowest latency.
+    std::uint64_t m_maximum{0}; // This field is the exact highest latency.
+    long double m_sum{0}; // This field is the sum of all the latencies, for the mean.
+};
+
+#endif
@@ -0,0 +1,125 @@
+#ifndef ALLOCATOR_LOCK_FREE_CHUNK_STACK_H
+#define ALLOCATOR_LOCK_FREE_CHUNK_STACK_H
+
+#include <atomic> // Include here all the 'atomic' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+
+#include "chunk_list.h" // Include here all the 'chunk_list' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This is a free list of chunks that many threads can push to and pop from at the same time, without a lock. It is a so-called 'Treiber stack'.
+// Popping reads the 'm_next_node' field of the top chunk, and then tries to swap the top with that next chunk using a compare-and-swap.
+// Between the read and the swap, other threads may pop the top chunk, pop more chunks, and push the top chunk back. The top looks the same, but its next chunk is wrong now.
+// This is called the 'ABA problem'. To prevent it, the top is stored together with a tag that is incremented on every change. The compare-and-swap then fails, because the tag differs.
+// The tag is stored in the upper 16 bits of the pointer. On 64-bit Linux, user space addresses only use the lower 48 bits, so these bits are always free.
+// Chunks are never unmapped while they are on the stack, so reading the next field of a chunk that was just popped by another thread is always safe.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'lock_free_chunk_stack'. It is a free list of chunks, shared between threads without a lock.
+/// \tparam T The type of this specific class.
+template <typename T>
+class lock_free_chunk_stack {
+public:
+    /// This is the constructor of the 'lock_free_chunk_stack' class. The stack is empty.
+    lock_free_chunk_stack() noexcept;
+
+    /// This method pushes a single free chunk on the stack.
+    /// \param free_chunk The address of the free chunk.
+    void push(chunk<T>* free_chunk) noexcept;
+
+    /// This method pushes a whole chain of free chunks on the stack at once. The chunks must already be linked through their 'm_next_node' field.
+    /// \param first_chunk The first chunk of the chain. It will be the new top of the stack.
+    /// \param last_chunk The last chunk of the chain.
+    void push_chain(chunk<T>* first_chunk, chunk<T>* last_chunk) noexcept;
+
+    /// This method pops a single free chunk from the stack.
+    /// \return The address of a free chunk, or a 'nullptr' when the stack is empty.
+    chunk<T>* pop() noexcept;
+
+    /// This method tells whether the operations on this stack are really lock-free on this platform.
+    /// \return True if no lock is used under the hood.
+    [[nodiscard]] bool is_lock_free() const noexcept;
+
+private:
+    static_assert(sizeof(void*) == sizeof(std::uint64_t), "The tagged pointers of 'lock_free_chunk_stack' need a 64-bit platform.");
+
+    static constexpr std::uint64_t pointer_mask = (std::uint64_t{1} << 48) - 1; // The lower 48 bits contain the address of the top chunk.
+    static constexpr std::uint64_t tag_increment = std::uint64_t{1} << 48; // Adding this value increments the tag in the upper 16 bits.
+
+    /// This method reads the 'm_next_node' field of a chunk. Other threads may read this field at the same time, so it is accessed atomically.
+    /// \param current_chunk The chunk you want to read the next field from.
+    /// \return The address of the next chunk.
+    static chunk<T>* load_next(chunk<T>* current_chunk) noexcept;
+
+    /// This method writes the 'm_next_node' field of a chunk. Other threads may read this field at the same time, so it is accessed atomically.
+    /// \param current_chunk The chunk you want to write the next field of.
+    /// \param next_chunk The address of the next chunk.
+    static void store_next(chunk<T>* current_chunk, chunk<T>* next_chunk) noexcept;
+
+    std::atomic<std::uint64_t> m_tagged_head; // This field contains the address of the top chunk, together with the tag.
+};
+
+// This is the constructor of the 'lock_free_chunk_stack' class. The stack is empty.
+template<typename T>
+lock_free_chunk_stack<T>::lock_free_chunk_stack() noexcept :
+    m_tagged_head{0}
+{}
+
+// This method pushes a single free chunk on the stack.
+template<typename T>
+void lock_free_chunk_stack<T>::push(chunk<T>* free_chunk) noexcept {
+    push_chain(free_chunk, free_chunk); // A single chunk is a chain of one chunk.
+}
+
+// This method pushes a whole chain of free chunks on the stack at once. The chunks must already be linked through their 'm_next_node' field.
+template<typename T>
+void lock_free_chunk_stack<T>::push_chain(chunk<T>* first_chunk, chunk<T>* last_chunk) noexcept {
+    auto old_head = m_tagged_head.load(std::memory_order_relaxed); // The current top, together with its tag.
+    std::uint64_t new_head{}; // The new top, together with the incremented tag.
+
+    // Try to put the chain on top of the stack, until no other thread changed the top in between.
+    do {
+        store_next(last_chunk, reinterpret_cast<chunk<T>*>(old_head & pointer_mask)); // The end of the chain points to the old top.
+        new_head = ((old_head & ~pointer_mask) + tag_increment) | reinterpret_cast<std::uint64_t>(first_chunk);
+    } while (!m_tagged_head.compare_exchange_weak(old_head, new_head, std::memory_order_release, std::memory_order_relaxed));
+}
+
+// This method pops a single free chunk from the stack.
+template<typename T>
+chunk<T> *lock_free_chunk_stack<T>::pop() noexcept {
+    auto old_head = m_tagged_head.load(std::memory_order_acquire); // The current top, together with its tag.
+    std::uint64_t new_head{}; // The new top, together with the incremented tag.
+
+    // Try to replace the top by its next chunk, until no other thread changed the top in between. The tag makes sure that a recycled top is noticed.
+    do {
+        auto* top_chunk = reinterpret_cast<chunk<T>*>(old_head & pointer_mask);
+
+        // The stack is empty, there is nothing to pop.
+        if (top_chunk == nullptr)
+            return nullptr;
+
+        new_head = ((old_head & ~pointer_mask) + tag_increment) | reinterpret_cast<std::uint64_t>(load_next(top_chunk));
+    } while (!m_tagged_head.compare_exchange_weak(old_head, new_head, std::memory_order_acquire, std::memory_order_acquire));
+
+    return reinterpret_cast<chunk<T>*>(old_head & pointer_mask); // Return the old top, it is now owned by the calling thread.
+}
+
+// This method tells whether the operations on this stack are really lock-free on this platform.
+template<typename T>
+bool lock_free_chunk_stack<T>::is_lock_free() const noexcept {
+    return m_tagged_head.is_lock_free(); // A single 64-bit word is lock-free on every common 64-bit platform.
+}
+
+// This method reads the 'm_next_node' field of a chunk. Other threads may read this field at the same time, so it is accessed atomically.
+template<typename T>
+chunk<T> *lock_free_chunk_stack<T>::load_next(chunk<T> *current_chunk) noexcept {
+    return std::atomic_ref<chunk<T>*>{current_chunk->m_next_node}.load(std::memory_order_relaxed);
+}
+
+// This method writes the 'm_next_node' field of a chunk. Other threads may read this field at the same time, so it is accessed atomically.
+template<typename T>
+void lock_free_chunk_stack<T>::store_next(chunk<T> *current_chunk, chunk<T> *next_chunk) noexcept {
+    std::atomic_ref<chunk<T>*>{current_chunk->m_next_node}.store(next_chunk, std::memory_order_relaxed);
+}
+
+#endif
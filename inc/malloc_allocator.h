@@ -3,12 +3,21 @@
 
 #include <iostream> // Include here all the 'iostream' facilities.
 #include <cstdlib> // Include here all the 'cstdlib' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <limits> // Include here all the 'limits' facilities.
+#include <malloc.h> // Include here all the 'malloc' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
 
 // ---- EXTRA INFORMATION ---- //
 // This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers.
 // But, in this case it is used for allocating new memory with 'malloc'.
 // If you want to make an allocator yourself, you should mainly provide it with two methods, in this case an 'allocate' and a 'deallocate' method.
 // PAY ATTENTION! This class was developed by also testing the speed of 'malloc' within the benchmarker. In addition, they practice by making their own allocator. But the purpose of this class is to only test 'malloc' within the benchmarker.
+// 'malloc' only aligns to 'std::max_align_t'. An over-aligned type, or a bigger alignment given to the constructor, is allocated with 'aligned_alloc' instead. 'free' releases both.
+// 'reallocate' uses 'realloc', that grows the memory in place when it can. Big allocations are mapped by 'malloc' itself, and those are moved with 'mremap', without copying.
+// 'try_expand' only succeeds when 'malloc' already handed out enough memory. 'malloc_usable_size' tells how much that is.
 // ---- END EXTRA INFORMATION ---- //
 
 /// This is the class 'malloc_allocator', used for allocating memory with 'malloc'.
@@ -21,13 +30,16 @@ public:
 
     /// This is the constructor of the 'malloc_allocator' class. It is a default constructor.
     malloc_allocator() = default;
+    /// This is the constructor of the 'malloc_allocator' class.
+    /// \param alignment The minimum alignment of the allocated memory, for instance 64 bytes for a whole cache line. It must be a power of two. The memory is never aligned less than 'T'.
+    explicit malloc_allocator(std::size_t alignment) noexcept : m_alignment{alignment} {}
     /// This is the destructor of the 'malloc_allocator' class. It is a default destructor.
     ~malloc_allocator() = default;
 
     /// The constexpr constructor for this allocator.
     /// \tparam U The type of 'malloc_allocator' U.
     template <typename U>
-    [[maybe_unused]] constexpr explicit malloc_allocator (const malloc_allocator<U>& ) noexcept {}
+    [[maybe_unused]] constexpr explicit malloc_allocator (const malloc_allocator<U>& other_allocator) noexcept : m_alignment{other_allocator.get_alignment()} {}
 
     /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
     /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
@@ -39,6 +51,20 @@ public:
     /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
     [[maybe_unused]] void deallocate(T* allocated_memory, std::size_t number_of_elements) noexcept;
 
+    /// This method resizes the allocated memory with 'realloc'. It grows in place when it can, otherwise the content is moved.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method. Its objects are moved bytewise, so 'T' must be trivially copyable.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return The first memory address of the resized block of memory. It may differ from 'allocated_memory'.
+    [[nodiscard]] T* reallocate(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements);
+
+    /// This method grows the allocated memory in place, without moving it. This only succeeds when 'malloc' already handed out enough memory.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return True if the memory has room for the new number of elements. Otherwise nothing is changed.
+    bool try_expand(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept;
+
     /// This method returns the maximum size that you can allocate.
     /// \return The number of the maximum amount that you can allocate.
     [[maybe_unused]] [[nodiscard]] std::size_t max_size() const;
@@ -52,20 +78,36 @@ public:
     /// \param object_to_destroy The address to the allocated memory, whereby you want to destroy its object.
     [[maybe_unused]] void destroy(T* object_to_destroy);
 
+    /// This method returns the minimum alignment that was given to the constructor.
+    /// \return The alignment in bytes. The allocated memory is aligned to this alignment, or to the alignment of 'T' when that is bigger.
+    [[nodiscard]] std::size_t get_alignment() const noexcept { return m_alignment; }
+
 private:
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
     [[maybe_unused]] void used_memory_message(T* pointer_to_memory, std::size_t number_of_bytes, bool is_allocating = true);
+
+    std::size_t m_alignment{1}; // This field contains the minimum alignment of the allocated memory. It is kept when the allocator is rebound to another type.
 };
 
 // This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
 template<typename T>
 [[maybe_unused]] T *malloc_allocator<T>::allocate(std::size_t number_of_elements) {
-    // Allocate memory, check if allocating succeeded.
-    if (auto* allocated_memory = std::malloc(number_of_elements * sizeof(T)))
-        return reinterpret_cast<T*>(allocated_memory); // Return the first address of the allocated block with memory.
+    auto alignment = std::max(m_alignment, alignof(T)); // The memory is never aligned less than 'T'.
+
+    // Check if the number of bytes, rounded up to the alignment, still fits in a 'std::size_t'. Otherwise it wraps around to a tiny block.
+    if (number_of_elements > (std::numeric_limits<std::size_t>::max() - alignment + 1) / sizeof(T))
+        throw std::bad_alloc();
+
+    // Allocate memory, check if allocating succeeded. 'malloc' is aligned to 'std::max_align_t', only a bigger alignment needs 'aligned_alloc', whose size must be a multiple of the alignment.
+    if (alignment <= alignof(std::max_align_t)) {
+        if (auto* allocated_memory = std::malloc(number_of_elements * sizeof(T)))
+            return reinterpret_cast<T*>(allocated_memory); // Return the first address of the allocated block with memory.
+    }
+    else if (auto* allocated_memory = std::aligned_alloc(alignment, (number_of_elements * sizeof(T) + alignment - 1) / alignment * alignment))
+        return reinterpret_cast<T*>(allocated_memory);
 
     throw std::bad_alloc(); // Allocating failed, throw this exception.
 }
@@ -73,7 +115,34 @@ template<typename T>
 // This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
 template<typename T>
 [[maybe_unused]] void malloc_allocator<T>::deallocate(T *allocated_memory, std::size_t) noexcept {
-    std::free(allocated_memory); // Free the allocated memory.
+    std::free(allocated_memory); // Free the allocated memory, also the memory of 'aligned_alloc'.
+}
+
+// This method resizes the allocated memory with 'realloc'. It grows in place when it can, otherwise the content is moved.
+template<typename T>
+T *malloc_allocator<T>::reallocate(T *allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable objects can be moved to another address bytewise.");
+
+    // 'realloc' only keeps the alignment of 'malloc'. A bigger alignment needs a new block of 'aligned_alloc', and a copy.
+    if (std::max(m_alignment, alignof(T)) > alignof(std::max_align_t)) {
+        auto* new_memory = allocate(new_number_of_elements);
+        std::memcpy(new_memory, allocated_memory, std::min(old_number_of_elements, new_number_of_elements) * sizeof(T));
+        deallocate(allocated_memory, old_number_of_elements);
+
+        return new_memory;
+    }
+
+    // When 'realloc' fails, the old memory is still valid, and still owned by the caller.
+    if (auto* resized_memory = std::realloc(allocated_memory, std::max(new_number_of_elements * sizeof(T), std::size_t{1})))
+        return reinterpret_cast<T*>(resized_memory);
+
+    throw std::bad_alloc(); // Allocating failed, throw this exception.
+}
+
+// This method grows the allocated memory in place, without moving it. This only succeeds when 'malloc' already handed out enough memory.
+template<typename T>
+bool malloc_allocator<T>::try_expand(T *allocated_memory, std::size_t, std::size_t new_number_of_elements) noexcept {
+    return new_number_of_elements * sizeof(T) <= malloc_usable_size(allocated_memory); // 'malloc' rounds every request up, the rest of the block is free to use.
 }
 
 // This method returns the maximum size that you can allocate.
@@ -105,7 +174,7 @@ template<typename T>
 /// This operator compares two 'malloc' allocators.
 /// \tparam T The type of this specific class.
 /// \tparam U The type of this specific class.
-/// \return This operator normally returns always true.
+/// \return This operator normally returns always true, 'free' releases the memory of every alignment.
 template <typename T, typename U>
 bool operator==(const malloc_allocator<T>&, const malloc_allocator<U>&) { return true; }
 
@@ -0,0 +1,123 @@
+#ifndef ALLOCATOR_MAPPING_CACHE_H
+#define ALLOCATOR_MAPPING_CACHE_H
+
+#include <array> // Include here all the 'array' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <map> // Include here all the 'map' facilities.
+#include <mutex> // Include here all the 'mutex' facilities.
+#include <set> // Include here all the 'set' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Every call to 'mmap' and 'munmap' enters the kernel, and changes the tree of memory areas of the process. For big buffers that come and go all the time, this costs far more than the work on the buffers.
+// A mapping cache keeps the regions that are deallocated, instead of unmapping them. The next allocation of a size that fits takes such a region, without any system call.
+// The free regions are sorted into buckets by their number of pages (a bucket for every power of two). An allocation searches its own bucket first, and only then the bigger buckets.
+// A region that is bigger than the request is split, and the rest stays in the cache. A region that is given back is merged with the free regions right in front of it and right after it.
+// Growing a region first takes the free region right after it, and then tries to grow into the address space right after it. Otherwise 'mremap' moves the pages to a bigger region, without copying the content.
+// The cache never holds more bytes than its high-water mark. Above it, the biggest free regions are unmapped first, so the fewest system calls give back the most memory.
+// All the methods lock a mutex, so a single cache can be shared by the allocators of multiple threads.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'mapping_cache'. It keeps the regions that are deallocated, and reuses them for the next allocations, instead of unmapping and mapping them again.
+class mapping_cache {
+public:
+    /// This is the constructor of the 'mapping_cache' class.
+    /// \param high_water_mark The maximum number of bytes that the cache keeps. This IS in bytes!
+    explicit mapping_cache(const std::size_t& high_water_mark = std::size_t{64} * 1024 * 1024);
+
+    /// This is the destructor of the 'mapping_cache' class. It unmaps all the cached regions. The regions that are still allocated are not touched.
+    ~mapping_cache();
+
+    /// A cache can not be copied, because the allocators refer to it.
+    mapping_cache(const mapping_cache&) = delete;
+
+    /// A cache can not be copied, because the allocators refer to it.
+    mapping_cache& operator=(const mapping_cache&) = delete;
+
+    /// This method allocates a region of memory. A cached region is reused when it is big enough, otherwise a new region is mapped.
+    /// \param number_of_bytes The number of bytes you want to allocate. It is rounded up to whole pages.
+    /// \return The first address of the region. It is aligned to a page.
+    [[nodiscard]] void* allocate(std::size_t number_of_bytes);
+
+    /// This method gives a region back to the cache. It is merged with the cached regions next to it.
+    /// \param memory The first address of the region.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    void deallocate(void* memory, std::size_t number_of_bytes) noexcept;
+
+    /// This method resizes a region. A region grows in place when the region right after it is cached, otherwise it is moved with 'mremap'. The content is kept.
+    /// \param memory The first address of the region.
+    /// \param old_number_of_bytes The number of bytes of the region, as just passed to the 'allocate' or 'reallocate' method.
+    /// \param new_number_of_bytes The number of bytes you want the region to have.
+    /// \return The first address of the resized region. It may differ from 'memory'.
+    [[nodiscard]] void* reallocate(void* memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes);
+
+    /// This method grows a region in place, without moving it. First the cached region right after it is taken, otherwise the kernel tries to grow the mapping itself.
+    /// \param memory The first address of the region.
+    /// \param old_number_of_bytes The number of bytes of the region, as just passed to the 'allocate' or 'reallocate' method.
+    /// \param new_number_of_bytes The number of bytes you want the region to have.
+    /// \return True if the region has the new size now. Otherwise nothing is changed.
+    bool try_expand(void* memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes) noexcept;
+
+    /// This method unmaps cached regions, the biggest first, until the cache holds at most the given number of bytes.
+    /// \param kept_bytes The number of bytes that the cache may keep.
+    /// \return The number of bytes that are unmapped.
+    std::size_t release(std::size_t kept_bytes = 0) noexcept;
+
+    /// This method returns the number of bytes within the cached regions.
+    /// \return The number of cached bytes, in whole pages.
+    [[nodiscard]] std::size_t get_cached_bytes() const noexcept;
+
+    /// This method returns the number of cached regions. Regions next to each other count as a single region.
+    /// \return The number of cached regions.
+    [[nodiscard]] std::size_t get_number_of_cached_regions() const noexcept;
+
+    /// This method returns the number of allocations that reused a cached region.
+    /// \return The number of hits.
+    [[nodiscard]] std::size_t get_number_of_hits() const noexcept;
+
+    /// This method returns the number of allocations that had to map a new region.
+    /// \return The number of misses.
+    [[nodiscard]] std::size_t get_number_of_misses() const noexcept;
+
+private:
+    /// The number of buckets, one for every power of two of the number of pages.
+    static constexpr std::size_t number_of_buckets = sizeof(std::size_t) * 8;
+
+    /// This method finds the bucket of a region.
+    /// \param number_of_bytes The number of bytes of the region, in whole pages.
+    /// \return The index of the bucket.
+    static std::size_t find_bucket(std::size_t number_of_bytes) noexcept;
+
+    /// This method adds a free region to the cache, and merges it with the cached regions next to it. When the cache can not keep it, it is unmapped.
+    /// \param region_begin The first address of the region.
+    /// \param region_size The number of bytes of the region, in whole pages.
+    void insert_region(std::uintptr_t region_begin, std::size_t region_size) noexcept;
+
+    /// This method removes a free region from the cache.
+    /// \param cached_region The region within the map of all the regions.
+    void erase_region(std::map<std::uintptr_t, std::size_t>::iterator cached_region) noexcept;
+
+    /// This method takes the part of a cached region that is needed, and gives the rest back to the cache.
+    /// \param cached_region The region within the map of all the regions.
+    /// \param number_of_bytes The number of bytes that are needed, in whole pages.
+    /// \return The first address of the region.
+    void* take_region(std::map<std::uintptr_t, std::size_t>::iterator cached_region, std::size_t number_of_bytes) noexcept;
+
+    /// This method unmaps cached regions, the biggest first, until the cache holds at most the given number of bytes. The mutex must be locked.
+    /// \param kept_bytes The number of bytes that the cache may keep.
+    /// \return The number of bytes that are unmapped.
+    std::size_t release_locked(std::size_t kept_bytes) noexcept;
+
+    std::map<std::uintptr_t, std::size_t> m_regions; // This field contains all the cached regions, sorted by their first address. So the neighbours of a region are found in O(log(n)) time.
+    std::array<std::set<std::pair<std::size_t, std::uintptr_t>>, number_of_buckets> m_buckets; // This field contains the cached regions of every bucket, sorted by their size and address.
+    mutable std::mutex m_mutex; // This mutex protects all the fields.
+    std::size_t m_cached_bytes; // The number of bytes within the cached regions.
+    std::size_t m_high_water_mark; // The maximum number of bytes that the cache keeps.
+    std::size_t m_number_of_hits; // The number of allocations that reused a cached region.
+    std::size_t m_number_of_misses; // The number of allocations that had to map a new region.
+};
+
+#endif
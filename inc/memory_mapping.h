@@ -0,0 +1,137 @@
+#ifndef ALLOCATOR_MEMORY_MAPPING_H
+#define ALLOCATOR_MEMORY_MAPPING_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This class bundles the calls to 'mmap' and 'munmap' that are needed by the blocks of the memory pool allocators.
+// 'mmap' only promises that the returned memory is aligned to a page. Some blocks need a much bigger alignment, for instance to find the start of a block by masking an address.
+// To get such a block, a region is mapped that is bigger by the alignment. The aligned part is kept, and the parts before and after it are unmapped again.
+// This only costs address space, the unmapped parts were never touched, so they never used physical memory.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// Normally, a region is built from pages of 4 KiB. A pool that spans gigabytes then needs a lot of entries in the TLB, and misses it often when it is traversed at random.
+// With huge pages of 2 MiB, a single TLB entry covers 512 times as much memory. There are two ways to get them on Linux:
+// Transparent huge pages: the region is aligned to 2 MiB, and 'madvise(MADV_HUGEPAGE)' asks the kernel to back it with huge pages when it can. Otherwise it simply uses normal pages.
+// Explicit huge pages: 'MAP_HUGETLB' takes huge pages from a pool that the administrator reserved. When this pool is empty (or not configured), the transparent way is used instead.
+// In both huge page modes, a region is rounded up to whole huge pages. It must be unmapped with the same mode, so that the same size is unmapped.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// A freshly mapped region does not use any physical memory yet. Every page is faulted in on its first access, one page fault at a time.
+// 'prefault_region' moves this cost to a single moment: 'madvise(MADV_POPULATE_WRITE)' faults in all the pages within one system call.
+// 'MAP_POPULATE' would do the same within 'mmap', but a region with a big alignment is mapped bigger and trimmed afterwards, so it would also populate the parts that are unmapped again.
+// Kernels older than 5.14 do not know this advice. Then every page is simply touched once, which has the same result.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// On a machine with several sockets, every socket has memory of its own, called a NUMA node. Memory of another node is slower, every access goes through the link between the sockets.
+// Linux places a page on the node of the thread that touches it first. So a block that is mapped by one thread, but filled by a thread on another socket, ends up on the wrong node.
+// 'bind_region' binds a region to a single node with 'mbind', before any of its pages is touched. 'get_current_numa_node' tells the node of the calling thread with 'getcpu', without entering the kernel.
+// On a machine with a single node nothing is bound at all. When the kernel does not support NUMA, every region simply uses node 0.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This enumeration class 'page_mode' tells which pages back a mapped region.
+enum class page_mode {
+    normal, // The region uses normal pages.
+    transparent_huge, // The region is aligned to a huge page, and the kernel is asked to back it with huge pages with 'madvise(MADV_HUGEPAGE)'.
+    explicit_huge // The region is mapped with 'MAP_HUGETLB'. When no huge page is reserved, it falls back on transparent huge pages.
+};
+
+/// This is the class 'memory_mapping'. It maps and unmaps regions of anonymous memory directly from the operating system.
+class memory_mapping {
+public:
+    /// This method maps a new region of anonymous memory, that you can read from and write to.
+    /// \param number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \param alignment The alignment of the start of the region. It must be a power of two. Up to a page, this is always satisfied.
+    /// \param mode The pages that back the region. With huge pages, the region is rounded up to whole huge pages, and aligned to a huge page.
+    /// \return The first address of the mapped region.
+    static void* map_region(std::size_t number_of_bytes, std::size_t alignment, page_mode mode = page_mode::normal);
+
+    /// This method unmaps a region of memory, that was mapped with the 'map_region' method.
+    /// \param memory The first address of the region.
+    /// \param number_of_bytes The number of bytes of the region. It must be the same value as passed to the 'map_region' method.
+    /// \param mode The pages that back the region. It must be the same value as passed to the 'map_region' method.
+    static void unmap_region(void* memory, std::size_t number_of_bytes, page_mode mode = page_mode::normal) noexcept;
+
+    /// This method resizes a region of normal pages with 'mremap'. The pages are moved by the kernel when the region does not fit at its address, so the content is never copied.
+    /// \param memory The first address of the region. It must be a single mapping, with normal pages.
+    /// \param old_number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \param new_number_of_bytes The number of bytes you want the region to have. It is rounded up to whole pages.
+    /// \param may_move When this is false, the region only grows in place, into the address space right after it.
+    /// \return The first address of the resized region, or a 'nullptr' when the kernel can not resize it, for instance because it spans several mappings.
+    static void* remap_region(void* memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes, bool may_move = true) noexcept;
+
+    /// This method gives the physical memory of a region back to the operating system, but keeps the region mapped. The next access reads zeros.
+    /// \param memory The first address of the part you want to decommit. It must be aligned to a page.
+    /// \param number_of_bytes The number of bytes you want to decommit. It is rounded up to whole pages.
+    /// \return True if the memory was given back.
+    static bool decommit_region(void* memory, std::size_t number_of_bytes) noexcept;
+
+    /// This method takes all the access rights of a region away, so that every access to it faults right away. It is used for guard pages.
+    /// \param memory The first address of the region. It must be aligned to a page.
+    /// \param number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \return True if the region can not be accessed anymore.
+    static bool protect_region(void* memory, std::size_t number_of_bytes) noexcept;
+
+    /// This method puts all the pages of a region in physical memory right away, so that the first accesses do not fault anymore. The content of the region is kept.
+    /// \param memory The first address of the region. It must be aligned to a page.
+    /// \param number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \param mode The pages that back the region.
+    static void prefault_region(void* memory, std::size_t number_of_bytes, page_mode mode = page_mode::normal) noexcept;
+
+    /// This method counts the bytes of a region that are in physical memory right now.
+    /// \param memory The first address of the region. It must be aligned to a page.
+    /// \param number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \return The number of bytes in whole pages, or zero when the operating system can not tell.
+    static std::size_t get_resident_bytes(const void* memory, std::size_t number_of_bytes);
+
+    /// This method returns the bytes of the whole process that are in physical memory right now, its resident set size. It does not allocate anything itself.
+    /// \return The number of resident bytes, or zero when the operating system can not tell.
+    static std::size_t get_process_resident_bytes() noexcept;
+
+    /// This method binds the pages of a region to a single NUMA node. It must be called before the pages are touched, otherwise they are already placed.
+    /// \param memory The first address of the region. It must be aligned to a page.
+    /// \param number_of_bytes The number of bytes of the region. It is rounded up to whole pages.
+    /// \param numa_node The node that must back the region.
+    /// \param mode The pages that back the region.
+    /// \return True if the region is bound, or if there is only a single node anyway.
+    static bool bind_region(void* memory, std::size_t number_of_bytes, std::size_t numa_node, page_mode mode = page_mode::normal) noexcept;
+
+    /// This method finds the NUMA node that backs a page. The page is faulted in when it is not in physical memory yet.
+    /// \param memory An address within the page.
+    /// \return The node of the page, or 'any_numa_node' when the operating system can not tell.
+    static std::size_t find_numa_node(const void* memory) noexcept;
+
+    /// This method returns the number of NUMA nodes of this machine.
+    /// \return The number of nodes, at least 1.
+    static std::size_t get_number_of_numa_nodes() noexcept;
+
+    /// This method returns the NUMA node of the processor that runs the calling thread.
+    /// \return The node of the calling thread, or 0 when the operating system can not tell.
+    static std::size_t get_current_numa_node() noexcept;
+
+    /// This value indicates that a region may use the memory of any NUMA node.
+    static constexpr std::size_t any_numa_node = static_cast<std::size_t>(-1);
+
+    /// This method returns the size of a single page of memory.
+    /// \return The size of a page in bytes.
+    static std::size_t page_size() noexcept;
+
+    /// This method returns the size of a single huge page of memory.
+    /// \return The size of a huge page in bytes.
+    static constexpr std::size_t huge_page_size() noexcept { return std::size_t{2} * 1024 * 1024; }
+
+    /// This method rounds a number of bytes up to whole pages.
+    /// \param number_of_bytes The number of bytes you want to round up.
+    /// \param mode The pages you want to round up to. Both huge page modes round up to whole huge pages.
+    /// \return The number of bytes in whole pages.
+    static std::size_t round_to_pages(std::size_t number_of_bytes, page_mode mode = page_mode::normal) noexcept;
+
+    /// This method returns the number of system calls ('mmap', 'munmap', 'mremap', 'madvise', 'mprotect' and 'mbind') that this class made so far, by all the threads together.
+    /// \return The number of system calls.
+    static std::size_t get_number_of_system_calls() noexcept;
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef ALLOCATOR_MEMORY_RESOURCES_H
+#define ALLOCATOR_MEMORY_RESOURCES_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <memory_resource> // Include here all the 'memory_resource' facilities.
+
+#include "malloc_allocator.h" // Include here all the 'malloc_allocator' facilities.
+#include "mmap_allocator.h" // Include here all the 'mmap_allocator' facilities.
+#include "new_allocator.h" // Include here all the 'new_allocator' facilities.
+#include "size_class_pool.h" // Include here all the 'size_class_pool' facilities.
+#include "monotonic_arena.h" // Include here all the 'monotonic_arena' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Every allocator within this project is a template of its own. A container with another allocator is another type, so switching the strategy changes a lot of code.
+// The classes in this file wrap every strategy in an 'std::pmr::memory_resource'. A container with an 'std::pmr::polymorphic_allocator' can use any of them, without changing its type.
+// This way, the strategy can be chosen at runtime, for instance per subsystem, and compared with the resources of the standard library itself.
+// The resources of 'malloc', 'mmap' and 'new' are stateless: all the instances of such a resource are equal, memory of the one can be deallocated by the other.
+// The pool resource and the arena resource own their memory, so they are only equal to themselves.
+// PAY ATTENTION! Just like the allocators they wrap, the pool resource and the arena resource are not thread-safe.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'malloc_memory_resource'. It allocates memory with 'malloc', and with 'aligned_alloc' for big alignments.
+class malloc_memory_resource : public std::pmr::memory_resource {
+private:
+    /// This method allocates memory with 'malloc'.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* do_allocate(std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method deallocates memory with 'free'.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void do_deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method compares this resource with another one.
+    /// \param other_resource The other resource.
+    /// \return True if the other resource also uses 'malloc'.
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other_resource) const noexcept override;
+
+    malloc_allocator<std::byte> m_allocator; // This field is the 'malloc' allocator that is wrapped.
+};
+
+/// This is the class 'mmap_memory_resource'. It maps every request with 'mmap'.
+class mmap_memory_resource : public std::pmr::memory_resource {
+private:
+    /// This method allocates memory with 'mmap'.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* do_allocate(std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method deallocates memory with 'munmap'.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void do_deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method compares this resource with another one.
+    /// \param other_resource The other resource.
+    /// \return True if the other resource also uses 'mmap'.
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other_resource) const noexcept override;
+
+    mmap_allocator<std::byte> m_allocator; // This field is the 'mmap' allocator that is wrapped.
+};
+
+/// This is the class 'new_memory_resource'. It allocates memory with 'new', and with the aligned 'new' for big alignments.
+class new_memory_resource : public std::pmr::memory_resource {
+private:
+    /// This method allocates memory with 'new'.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* do_allocate(std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method deallocates memory with 'delete'.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void do_deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method compares this resource with another one.
+    /// \param other_resource The other resource.
+    /// \return True if the other resource also uses 'new'.
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other_resource) const noexcept override;
+
+    new_allocator<std::byte> m_allocator; // This field is the 'new' allocator that is wrapped.
+};
+
+/// This is the class 'pool_memory_resource'. It serves requests of any size from memory pools, one for every size class, comparable to 'std::pmr::unsynchronized_pool_resource'.
+class pool_memory_resource : public std::pmr::memory_resource {
+public:
+    /// This method returns the table of memory pools of this resource.
+    /// \return A reference to the table of memory pools.
+    [[nodiscard]] size_class_pool& get_pool() noexcept;
+
+private:
+    /// This method allocates memory from the memory pool of the size class that fits.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* do_allocate(std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method gives memory back to the memory pool of its size class.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void do_deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method compares this resource with another one.
+    /// \param other_resource The other resource.
+    /// \return True only if the other resource is this resource.
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other_resource) const noexcept override;
+
+    size_class_pool m_pool; // This field is the table of memory pools that owns all the memory.
+};
+
+/// This is the class 'arena_memory_resource'. It bumps a pointer within a monotonic arena, comparable to 'std::pmr::monotonic_buffer_resource'.
+class arena_memory_resource : public std::pmr::memory_resource {
+public:
+    /// This is the constructor of the 'arena_memory_resource' class.
+    /// \param block_size The number of bytes of a single block of the arena. This IS in bytes!
+    explicit arena_memory_resource(const std::size_t& block_size = 64 * 1024);
+
+    /// This is the constructor of the 'arena_memory_resource' class. The arena starts within the given buffer.
+    /// \param initial_buffer The buffer the arena starts with. It must outlive the resource.
+    /// \param buffer_size The number of bytes of the buffer.
+    /// \param block_size The number of bytes of a single block of the arena. This IS in bytes!
+    arena_memory_resource(void* initial_buffer, const std::size_t& buffer_size, const std::size_t& block_size = 64 * 1024);
+
+    /// This method returns the arena of this resource, for instance to reset it.
+    /// \return A reference to the arena.
+    [[nodiscard]] monotonic_arena& get_arena() noexcept;
+
+private:
+    /// This method allocates memory by bumping the pointer of the arena.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* do_allocate(std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method does nothing. The memory is given back when the arena is reset.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void do_deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment) override;
+
+    /// This method compares this resource with another one.
+    /// \param other_resource The other resource.
+    /// \return True only if the other resource is this resource.
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other_resource) const noexcept override;
+
+    monotonic_arena m_arena; // This field is the arena that owns all the memory.
+};
+
+#endif
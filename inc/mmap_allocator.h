@@ -3,13 +3,24 @@
 
 #include <iostream> // Include here all the 'iostream' facilities.
 #include <limits> // Include here all the 'limits' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
 #include <sys/mman.h> // Include here all the 'sys/mman' facilities.
 
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+#include "mapping_cache.h" // Include here all the 'mapping_cache' facilities.
+
 // ---- EXTRA INFORMATION ---- //
 // This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers.
 // But, in this case it is used for allocating new memory with 'mmap'.
 // If you want to make an allocator yourself, you should mainly provide it with two methods, in this case an 'allocate' and a 'deallocate' method.
 // PAY ATTENTION! This class was developed by also testing the speed of 'malloc' within the benchmarker. In addition, they practice by making their own allocator. But the purpose of this class is to only test 'mmap' within the benchmarker.
+// Optionally, the memory can be backed by huge pages. Every allocation is then rounded up to whole huge pages of 2 MiB, so only use it for big allocations.
+// 'mmap' always aligns to a page. Only an alignment above a page maps a bigger region, and trims it to the alignment.
+// With a 'mapping_cache', deallocated memory is kept and reused, instead of a system call for every allocation and deallocation. This only applies to normal pages with an alignment up to a page.
+// The allocator only refers to the cache, just like 'arena_allocator' refers to its arena. So the cache must outlive all the containers that use it.
 // ---- END EXTRA INFORMATION ---- //
 
 /// This is the class 'mmap_allocator', used for allocating memory with 'mmap'.
@@ -22,13 +33,23 @@ public:
 
     /// This is the constructor of the 'mmap_allocator' class. It is a default constructor.
     mmap_allocator() = default;
+    /// This is the constructor of the 'mmap_allocator' class.
+    /// \param mode The pages that back the allocated memory.
+    explicit mmap_allocator(page_mode mode) noexcept : m_page_mode{mode} {}
+    /// This is the constructor of the 'mmap_allocator' class.
+    /// \param alignment The minimum alignment of the allocated memory. It must be a power of two. The memory is never aligned less than a page.
+    /// \param mode The pages that back the allocated memory.
+    explicit mmap_allocator(std::size_t alignment, page_mode mode = page_mode::normal) noexcept : m_page_mode{mode}, m_alignment{alignment} {}
+    /// This is the constructor of the 'mmap_allocator' class. The memory comes from the given cache, and goes back to it.
+    /// \param cache The cache of mapped regions. It must outlive the allocator.
+    explicit mmap_allocator(mapping_cache& cache) noexcept : m_cache{&cache} {}
     /// This is the destructor of the 'mmap_allocator' class. It is a default destructor.
     ~mmap_allocator() = default;
 
     /// The constexpr constructor for this allocator.
     /// \tparam U The type of 'mmap_allocator' U.
     template <typename U>
-    [[maybe_unused]] constexpr explicit mmap_allocator (const mmap_allocator<U>& ) noexcept {}
+    [[maybe_unused]] constexpr explicit mmap_allocator (const mmap_allocator<U>& other_allocator) noexcept : m_page_mode{other_allocator.get_page_mode()}, m_alignment{other_allocator.get_alignment()}, m_cache{other_allocator.get_cache()} {}
 
     /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
     /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
@@ -40,6 +61,20 @@ public:
     /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
     [[maybe_unused]] void deallocate(T* allocated_memory, std::size_t number_of_elements) noexcept;
 
+    /// This method resizes the allocated memory. The pages are moved with 'mremap', or grow in place within the cache, so the content is never copied by the allocator itself.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method. Its objects are moved bytewise, so 'T' must be trivially copyable.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return The first memory address of the resized block of memory. It may differ from 'allocated_memory'.
+    [[nodiscard]] T* reallocate(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements);
+
+    /// This method grows the allocated memory in place, without moving it. The kernel only grows it into address space that is not mapped yet.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param old_number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    /// \param new_number_of_elements The number of elements that you want to have memory for. This is NOT in bytes!
+    /// \return True if the memory has room for the new number of elements now. It must be deallocated with this new number. Otherwise nothing is changed.
+    bool try_expand(T* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept;
+
     /// This method returns the maximum size that you can allocate.
     /// \return The number of the maximum amount that you can allocate.
     [[maybe_unused]] [[nodiscard]] std::size_t max_size() const;
@@ -53,17 +88,55 @@ public:
     /// \param object_to_destroy The address to the allocated memory, whereby you want to destroy its object.
     [[maybe_unused]] void destroy(T* object_to_destroy);
 
+    /// This method returns the pages that back the memory of this allocator.
+    /// \return The page mode.
+    [[nodiscard]] page_mode get_page_mode() const noexcept { return m_page_mode; }
+
+    /// This method returns the minimum alignment that was given to the constructor.
+    /// \return The alignment in bytes. The allocated memory is aligned to this alignment, to the alignment of 'T' or to a page, whichever is the biggest.
+    [[nodiscard]] std::size_t get_alignment() const noexcept { return m_alignment; }
+
+    /// This method returns the cache of mapped regions this allocator refers to.
+    /// \return A pointer to the cache, or a 'nullptr' when every allocation is mapped on its own.
+    [[nodiscard]] mapping_cache* get_cache() const noexcept { return m_cache; }
+
 private:
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
     [[maybe_unused]] void used_memory_message(T* pointer_to_memory, std::size_t number_of_bytes, bool is_allocating = true);
+
+    page_mode m_page_mode{page_mode::normal}; // This field contains the pages that back the allocated memory.
+    std::size_t m_alignment{1}; // This field contains the minimum alignment of the allocated memory. It is kept when the allocator is rebound to another type.
+    mapping_cache* m_cache{nullptr}; // This field is the cache of mapped regions. It is kept when the allocator is rebound to another type.
+
+    /// This method tells whether the allocated memory goes through the cache.
+    /// \return True if there is a cache, and the memory uses normal pages aligned to at most a page.
+    [[nodiscard]] bool is_cached() const noexcept { return m_cache != nullptr && m_page_mode == page_mode::normal && std::max(m_alignment, alignof(T)) <= memory_mapping::page_size(); }
 };
 
 // This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
 template<typename T>
 [[maybe_unused]] T *mmap_allocator<T>::allocate(std::size_t number_of_elements) {
+    // Check if the number of bytes, rounded up to whole pages, fits in a 'std::size_t'.
+    if (number_of_elements > max_size())
+        throw std::bad_array_new_length();
+
+    auto alignment = std::max(m_alignment, alignof(T)); // The memory is never aligned less than 'T'.
+
+    // Reuse a region of the cache, without a system call when it has one that fits.
+    if (is_cached())
+        return reinterpret_cast<T*>(m_cache->allocate(number_of_elements * sizeof(T)));
+
+    // Memory with huge pages is aligned to a huge page. It throws 'std::bad_alloc' when allocating failed.
+    if (m_page_mode != page_mode::normal)
+        return reinterpret_cast<T*>(memory_mapping::map_region(number_of_elements * sizeof(T), std::max(alignment, memory_mapping::huge_page_size()), m_page_mode));
+
+    // An alignment above a page needs a trimmed region. The trimmed parts are already unmapped, so 'munmap' releases the rest just like a normal mapping.
+    if (alignment > memory_mapping::page_size())
+        return reinterpret_cast<T*>(memory_mapping::map_region(number_of_elements * sizeof(T), alignment));
+
     auto* allocated_memory = mmap(nullptr, number_of_elements * sizeof(T), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0); // Allocate a new memory block with 'mmap'. You can read/write to this memory. Also, the mapping is not mapped to a file.
 
     // Check if allocating new memory succeeded.
@@ -76,15 +149,70 @@ template<typename T>
 // This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
 template<typename T>
 [[maybe_unused]] void mmap_allocator<T>::deallocate(T *allocated_memory, std::size_t number_of_elements) noexcept {
+    // Keep the region in the cache, for the next allocation.
+    if (is_cached()) {
+        m_cache->deallocate(allocated_memory, number_of_elements * sizeof(T));
+        return;
+    }
+
+    // Memory with huge pages was rounded up to whole huge pages, so the same size must be unmapped.
+    if (m_page_mode != page_mode::normal) {
+        memory_mapping::unmap_region(allocated_memory, number_of_elements * sizeof(T), m_page_mode);
+        return;
+    }
+
     // Here, you unmap the just allocated memory. You are passing the first address of the allocated block, together with the number of bytes.
     if (munmap(allocated_memory, number_of_elements * sizeof(T)))
         std::cerr << "Deallocating memory failed!" << std::endl; // If this function failed deallocating the memory, print this as standard error.
 }
 
+// This method resizes the allocated memory. The pages are moved with 'mremap', or grow in place within the cache, so the content is never copied by the allocator itself.
+template<typename T>
+T *mmap_allocator<T>::reallocate(T *allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable objects can be moved to another address bytewise.");
+
+    if (is_cached())
+        return reinterpret_cast<T*>(m_cache->reallocate(allocated_memory, old_number_of_elements * sizeof(T), new_number_of_elements * sizeof(T)));
+
+    // A region of normal pages, aligned to at most a page, is a single mapping. So the kernel can move it.
+    if (m_page_mode == page_mode::normal && std::max(m_alignment, alignof(T)) <= memory_mapping::page_size()) {
+        if (auto* resized_memory = memory_mapping::remap_region(allocated_memory, old_number_of_elements * sizeof(T), new_number_of_elements * sizeof(T)))
+            return reinterpret_cast<T*>(resized_memory);
+    }
+
+    // Otherwise, the alignment or the huge pages must be kept. Allocate a new region, and copy the content.
+    auto* new_memory = allocate(new_number_of_elements);
+    std::memcpy(new_memory, allocated_memory, std::min(old_number_of_elements, new_number_of_elements) * sizeof(T));
+    deallocate(allocated_memory, old_number_of_elements);
+
+    return new_memory;
+}
+
+// This method grows the allocated memory in place, without moving it. The kernel only grows it into address space that is not mapped yet.
+template<typename T>
+bool mmap_allocator<T>::try_expand(T *allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept {
+    // A size that does not fit in a 'std::size_t' would seem to fit in the old pages.
+    if (new_number_of_elements > max_size())
+        return false;
+
+    if (is_cached())
+        return m_cache->try_expand(allocated_memory, old_number_of_elements * sizeof(T), new_number_of_elements * sizeof(T));
+
+    // The last page of the memory may already have room for the new size. Memory with huge pages never grows beyond its huge pages.
+    if (memory_mapping::round_to_pages(new_number_of_elements * sizeof(T), m_page_mode) <= memory_mapping::round_to_pages(old_number_of_elements * sizeof(T), m_page_mode))
+        return true;
+
+    // Only a single mapping of normal pages can grow.
+    if (m_page_mode != page_mode::normal || std::max(m_alignment, alignof(T)) > memory_mapping::page_size())
+        return false;
+
+    return memory_mapping::remap_region(allocated_memory, old_number_of_elements * sizeof(T), new_number_of_elements * sizeof(T), false) != nullptr;
+}
+
 // This method returns the maximum size that you can allocate.
 template<typename T>
 [[maybe_unused]] std::size_t mmap_allocator<T>::max_size() const {
-    return std::numeric_limits<std::size_t>::max() / sizeof(T); // Calculate the amount of allocating memory.
+    return (std::numeric_limits<std::size_t>::max() - memory_mapping::huge_page_size()) / sizeof(T); // Calculate the amount of allocating memory. Leave room to round it up to a whole (huge) page.
 }
 
 // This method constructs your type 'T'. Is has nothing to do with allocating memory with 'mmap'.
@@ -110,15 +238,15 @@ template<typename T>
 /// This operator compares two 'mmap' allocators.
 /// \tparam T The type of this specific class.
 /// \tparam U The type of this specific class.
-/// \return This operator normally returns always true.
+/// \return True if both allocators use the same pages and the same cache, so memory of the one can be unmapped by the other.
 template <typename T, typename U>
-bool operator==(const mmap_allocator<T>&, const mmap_allocator<U>&) { return true; }
+bool operator==(const mmap_allocator<T>& first_allocator, const mmap_allocator<U>& second_allocator) { return first_allocator.get_page_mode() == second_allocator.get_page_mode() && first_allocator.get_cache() == second_allocator.get_cache(); }
 
 /// This operator compares two 'mmap' allocators.
 /// \tparam T The type of this specific class.
 /// \tparam U The type of this specific class.
-/// \return This operator normally returns always false.
+/// \return True if the allocators use different pages, or a different cache.
 template <typename T, typename U>
-bool operator!=(const mmap_allocator<T>&, const mmap_allocator<U>&) { return false; }
+bool operator!=(const mmap_allocator<T>& first_allocator, const mmap_allocator<U>& second_allocator) { return !(first_allocator == second_allocator); }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,105 @@
+#ifndef ALLOCATOR_MONOTONIC_ARENA_H
+#define ALLOCATOR_MONOTONIC_ARENA_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// A monotonic arena only moves forward. Allocating just rounds a pointer up to the alignment, and bumps it past the request. Deallocating a single request does nothing at all.
+// All the memory is given back at once with 'reset'. This fits objects that all die together, for instance all the objects of a single request that is handled.
+// When the current block is full, the arena continues in the next block. The blocks are mapped with 'mmap', just like the blocks of the memory pool allocators.
+// A reset rewinds the arena to its first block, but keeps all the blocks. The next round of allocations reuses them, so it does not map anything anymore.
+// The arena can start in a buffer of the caller, for instance a buffer on the stack. Only when that buffer is full, the first block is mapped.
+// The last allocation can grow in place with 'try_expand', as long as the current block has room for it. A buffer that grows while nothing else is allocated never moves.
+// PAY ATTENTION! Just like 'pool_allocator', this class is not thread-safe. Every thread needs its own arena.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'monotonic_arena'. It allocates memory of any size by bumping a pointer, and releases all the memory at once.
+class monotonic_arena {
+public:
+    /// This is the constructor of the 'monotonic_arena' class. The first block is mapped on the first allocation.
+    /// \param block_size The number of bytes of a single block. This IS in bytes!
+    explicit monotonic_arena(const std::size_t& block_size = 64 * 1024);
+
+    /// This is the constructor of the 'monotonic_arena' class. The arena starts within the given buffer, and only maps blocks when this buffer is full.
+    /// \param initial_buffer The buffer the arena starts with. It must outlive the arena.
+    /// \param buffer_size The number of bytes of the buffer.
+    /// \param block_size The number of bytes of a single block. This IS in bytes!
+    monotonic_arena(void* initial_buffer, const std::size_t& buffer_size, const std::size_t& block_size = 64 * 1024);
+
+    /// This is the destructor of the 'monotonic_arena' class. It unmaps all the blocks.
+    ~monotonic_arena();
+
+    /// An arena can not be copied, because the allocators refer to it.
+    monotonic_arena(const monotonic_arena&) = delete;
+
+    /// An arena can not be copied, because the allocators refer to it.
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    /// This method allocates memory of any size and alignment, by bumping a pointer.
+    /// \param number_of_bytes The number of bytes you want to allocate. This IS in bytes!
+    /// \param alignment The alignment of the memory. It must be a power of two.
+    /// \return The first address of the allocated memory. When the request can not be mapped, an 'std::bad_alloc' is thrown.
+    [[nodiscard]] void* allocate(std::size_t number_of_bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /// This method grows an allocation in place, by bumping the pointer further. This only succeeds for the last allocation, when the current region has room for it.
+    /// \param memory The first address of the allocation.
+    /// \param old_number_of_bytes The number of bytes that were allocated.
+    /// \param new_number_of_bytes The number of bytes you want the allocation to have.
+    /// \return True if the allocation has the new size now. Otherwise nothing is changed.
+    bool try_expand(void* memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes) noexcept;
+
+    /// This method rewinds the arena to its start. All the memory is free again, but the blocks are kept for the next allocations.
+    void reset() noexcept;
+
+    /// This method rewinds the arena to its start, and unmaps all the blocks.
+    void release() noexcept;
+
+    /// This method returns the number of blocks that this arena mapped.
+    /// \return The number of blocks, also the ones that are not used since the last reset.
+    [[nodiscard]] std::size_t get_number_of_blocks() const noexcept;
+
+    /// This method returns the number of bytes that were allocated since the last reset, including the padding for the alignment.
+    /// \return The number of allocated bytes.
+    [[nodiscard]] std::size_t get_allocated_bytes() const noexcept;
+
+private:
+    /// This value indicates that the arena is still within its initial buffer.
+    static constexpr std::size_t no_block = static_cast<std::size_t>(-1);
+
+    /// This structure 'arena_block' describes a single mapped block.
+    struct arena_block {
+        std::uintptr_t m_begin; // The first address of the block.
+        std::size_t m_size; // The number of bytes of the block, in whole pages.
+    };
+
+    /// This method tries to bump the pointer within the current region.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory, or a 'nullptr' when it does not fit.
+    void* bump(std::size_t number_of_bytes, std::size_t alignment) noexcept;
+
+    /// This method continues in the next block that is big enough, and maps a new block when no kept block fits.
+    /// \param number_of_bytes The number of bytes you want to allocate.
+    /// \param alignment The alignment of the memory.
+    /// \return The first address of the allocated memory.
+    void* allocate_from_next_block(std::size_t number_of_bytes, std::size_t alignment);
+
+    /// This method makes the given block the current region.
+    /// \param block_index The index of the block.
+    void enter_block(std::size_t block_index) noexcept;
+
+    std::vector<arena_block> m_blocks; // This field contains all the mapped blocks, in the order they are used.
+    std::size_t m_current_block; // The index of the block you are bumping in.
+    std::uintptr_t m_current_position; // The first free address within the current region.
+    std::uintptr_t m_current_end; // The end of the current region.
+    std::uintptr_t m_initial_buffer; // The first address of the buffer of the caller.
+    std::size_t m_initial_size; // The number of bytes of the buffer of the caller.
+    std::size_t m_block_size; // The number of bytes of a single block.
+    std::size_t m_allocated_bytes; // The number of bytes allocated since the last reset.
+};
+
+#endif
@@ -3,15 +3,18 @@
 
 #include <iostream> // Include here all the 'iostream' facilities.
 #include <limits> // Include here all the 'limits' facilities.
+#include <new> // Include here all the 'new' facilities.
 
 // ---- EXTRA INFORMATION ---- //
 // This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers.
 // But, in this case it is used for allocating new memory with 'malloc'.
 // If you want to make an allocator yourself, you should mainly provide it with two methods, in this case an 'allocate' and a 'deallocate' method.
 // PAY ATTENTION! This class was developed by also testing the speed of 'malloc' within the benchmarker. In addition, they practice by making their own allocator. But the purpose of this class is to only test 'new' within the benchmarker.
+// The allocator only hands out raw storage with 'operator new', it does not construct anything. A container constructs every element exactly once, just like with 'malloc' or 'mmap'.
+// An alignment above the default alignment of 'new', of 'T' itself or given to the constructor, uses the aligned 'operator new'. It is deleted with the same alignment, and with its size.
 // ---- END EXTRA INFORMATION ---- //
 
-/// This is the class 'new_allocator', used for allocating memory with 'malloc'.
+/// This is the class 'new_allocator', used for allocating raw memory with 'operator new'.
 /// \tparam T The type of this specific class.
 template <typename T>
 class new_allocator {
@@ -21,13 +24,16 @@ public:
 
     /// This is the constructor of the 'new_allocator' class. It is a default constructor.
     new_allocator() = default;
+    /// This is the constructor of the 'new_allocator' class.
+    /// \param alignment The minimum alignment of the allocated memory, for instance 64 bytes for a whole cache line. It must be a power of two. The memory is never aligned less than 'T'.
+    explicit new_allocator(std::size_t alignment) noexcept : m_alignment{alignment} {}
     /// This is the destructor of the 'new_allocator' class. It is a default destructor.
     ~new_allocator() = default;
 
     /// The constexpr constructor for this allocator.
     /// \tparam U The type of 'new_allocator' U.
     template <typename U>
-    [[maybe_unused]] constexpr explicit new_allocator (const new_allocator<U>& ) noexcept {}
+    [[maybe_unused]] constexpr explicit new_allocator (const new_allocator<U>& other_allocator) noexcept : m_alignment{other_allocator.get_alignment()} {}
 
     /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
     /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
@@ -52,24 +58,48 @@ public:
     /// \param object_to_destroy The address to the allocated memory, whereby you want to destroy its object.
     [[maybe_unused]] void destroy(T* object_to_destroy);
 
+    /// This method returns the minimum alignment that was given to the constructor.
+    /// \return The alignment in bytes. The allocated memory is aligned to this alignment, or to the alignment of 'T' when that is bigger.
+    [[nodiscard]] std::size_t get_alignment() const noexcept { return m_alignment; }
+
 private:
+    /// This method returns the alignment the memory is allocated with.
+    /// \return The alignment in bytes, the biggest of 'T' and the one given to the constructor.
+    [[nodiscard]] std::size_t get_storage_alignment() const noexcept { return m_alignment > alignof(T) ? m_alignment : alignof(T); }
+
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
     [[maybe_unused]] void used_memory_message(T* pointer_to_memory, std::size_t number_of_bytes, bool is_allocating = true);
+
+    std::size_t m_alignment{1}; // This field contains the minimum alignment of the allocated memory. It is kept when the allocator is rebound to another type.
 };
 
 // This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
 template<typename T>
 [[maybe_unused]] T *new_allocator<T>::allocate(std::size_t number_of_elements) {
-    return new T[number_of_elements]; // Allocate a new block of memory.
+    // Check if the number of bytes fits in a 'std::size_t'.
+    if (number_of_elements > max_size())
+        throw std::bad_array_new_length();
+
+    // Only an alignment above the default alignment of 'new' needs the aligned 'new'.
+    if (get_storage_alignment() > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return static_cast<T*>(::operator new(number_of_elements * sizeof(T), std::align_val_t{get_storage_alignment()}));
+
+    return static_cast<T*>(::operator new(number_of_elements * sizeof(T))); // Allocate raw memory, nothing is constructed.
 }
 
 // This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
 template<typename T>
-[[maybe_unused]] void new_allocator<T>::deallocate(T *allocated_memory, std::size_t) noexcept {
-    delete[] allocated_memory; // Free the allocated memory.
+[[maybe_unused]] void new_allocator<T>::deallocate(T *allocated_memory, std::size_t number_of_elements) noexcept {
+    // The same alignment goes to the same 'delete'.
+    if (get_storage_alignment() > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        ::operator delete(allocated_memory, number_of_elements * sizeof(T), std::align_val_t{get_storage_alignment()});
+        return;
+    }
+
+    ::operator delete(allocated_memory, number_of_elements * sizeof(T)); // Free the raw memory, nothing is destroyed.
 }
 
 // This method returns the maximum size that you can allocate.
@@ -101,15 +131,15 @@ template<typename T>
 /// This operator compares two 'new' allocators.
 /// \tparam T The type of this specific class.
 /// \tparam U The type of this specific class.
-/// \return This operator normally returns always true.
+/// \return True if both allocators use the same alignment, so memory of the one can be deleted by the other.
 template <typename T, typename U>
-bool operator==(const new_allocator<T>&, const new_allocator<U>&) { return true; }
+bool operator==(const new_allocator<T>& first_allocator, const new_allocator<U>& second_allocator) { return first_allocator.get_alignment() == second_allocator.get_alignment(); }
 
 /// This operator compares two 'new' allocators.
 /// \tparam T The type of this specific class.
 /// \tparam U The type of this specific class.
-/// \return This operator normally returns always false.
+/// \return True if the allocators use different alignments.
 template <typename T, typename U>
-bool operator!=(const new_allocator<T>&, const new_allocator<U>&) { return false; }
+bool operator!=(const new_allocator<T>& first_allocator, const new_allocator<U>& second_allocator) { return !(first_allocator == second_allocator); }
 
 #endif
\ No newline at end of file
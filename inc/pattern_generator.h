@@ -0,0 +1,104 @@
+#ifndef ALLOCATOR_PATTERN_GENERATOR_H
+#define ALLOCATOR_PATTERN_GENERATOR_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <random> // Include here all the 'random' facilities.
+#include <string> // Include here all the 'string' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+#include "allocation_trace.h" // Include here all the 'allocation_trace' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Allocating everything and then freeing it in the same order is the best case for a memory pool: the free list stays in address order, so the next allocations walk through memory just like the first ones.
+// Real programs free in another order. After random frees, the free list jumps between random chunks and blocks, and every allocation from it touches another cache line, or even another page.
+// The 'pattern_generator' generates such orders as an allocation trace, so that the 'trace_replayer' replays them against any allocator, in exactly the same way as a recorded trace.
+// The patterns are:
+//     fifo: allocate everything, then free it in the same order.
+//     lifo: allocate everything, then free it in the reverse order, like a stack.
+//     random_free: allocate everything and free it in a random order, twice. The second round allocates from the free list that the random frees left behind.
+//     producer_consumer: a producer allocates bursts of messages, and a consumer frees the oldest ones in bursts of its own, like a queue between two threads.
+//     sawtooth: allocate up to a peak, free a random three quarters of it, and grow again, until all the allocations are done.
+//     steady_state_churn: fill up a live set, and then replace a random object of it with a new one, for every allocation that is left.
+// The sizes come from a distribution: a fixed size, uniform between the minimum and the maximum, a power law (most objects are small, a few are huge) or bimodal (mostly small objects, and one in ten big ones).
+// The same options and the same seed always generate the same trace, so that every allocator replays exactly the same calls.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This enumeration class 'allocation_pattern' tells in which order the generated allocations are freed.
+enum class allocation_pattern {
+    fifo, // Free in the order of allocation.
+    lifo, // Free in the reverse order of allocation.
+    random_free, // Free in a random order, and allocate again from what is left.
+    producer_consumer, // Allocate and free in bursts, the oldest first, on two threads.
+    sawtooth, // Grow up to a peak, and shrink by freeing at random.
+    steady_state_churn // Keep a live set, and replace random objects of it.
+};
+
+/// This enumeration class 'size_distribution' tells how the sizes of the generated allocations are chosen.
+enum class size_distribution {
+    fixed, // Every allocation has the minimum size.
+    uniform, // Every size between the minimum and the maximum is equally likely.
+    power_law, // The chance of a size falls with its square, so small sizes dominate and the maximum is rare.
+    bimodal // Nine in ten sizes are at most twice the minimum, one in ten at least half the maximum.
+};
+
+/// This structure 'pattern_options' contains the options of a generated pattern. All the fields have a default value, so you only set what you need.
+struct pattern_options {
+    allocation_pattern m_pattern{allocation_pattern::fifo}; // This is the order of the allocations and deallocations.
+    size_distribution m_distribution{size_distribution::fixed}; // This is the distribution of the sizes.
+    std::size_t m_number_of_allocations{1000}; // This is the number of allocations. Every allocation is freed within the pattern.
+    std::size_t m_minimum_size{16}; // This is the smallest size in bytes.
+    std::size_t m_maximum_size{4096}; // This is the biggest size in bytes.
+    std::uint64_t m_seed{1}; // This is the seed of the random generator.
+};
+
+/// This is the class 'pattern_generator'. It generates allocation traces with a pattern and a distribution of sizes.
+class pattern_generator {
+public:
+    /// This is the constructor of the 'pattern_generator' class.
+    /// \param options The options of the pattern. When the minimum size is zero, or above the maximum size, an 'std::invalid_argument' is thrown.
+    explicit pattern_generator(const pattern_options& options);
+
+    /// This method generates the records of the pattern. Calling it again, generates exactly the same records.
+    /// \return All the records, in the order the replayer replays them.
+    [[nodiscard]] std::vector<trace_record> generate() const;
+
+    /// This static method returns the name of a pattern, as shown in the messages and the results.
+    /// \param pattern The pattern.
+    /// \return The name in lowercase, for instance "random_free".
+    [[nodiscard]] static std::string get_pattern_name(const allocation_pattern& pattern);
+
+    /// This static method returns the name of a distribution of sizes, as shown in the messages and the results.
+    /// \param distribution The distribution.
+    /// \return The name in lowercase, for instance "power_law".
+    [[nodiscard]] static std::string get_distribution_name(const size_distribution& distribution);
+
+private:
+    /// This structure 'generator_state' is the state while the records are generated.
+    struct generator_state {
+        std::mt19937_64 m_random_generator; // The random generator, seeded with the seed of the options.
+        std::vector<trace_record> m_records; // The records that are generated.
+        std::uint64_t m_next_identifier; // The identifier of the next allocation.
+    };
+
+    /// This method adds an allocation of a size from the distribution.
+    /// \param state The state of the generation.
+    /// \param thread The thread of the record.
+    /// \return The identifier of the allocation.
+    std::uint64_t add_allocation(generator_state& state, std::uint32_t thread) const;
+
+    /// This method adds the deallocation of an allocation.
+    /// \param state The state of the generation.
+    /// \param identifier The identifier of the allocation.
+    /// \param thread The thread of the record.
+    static void add_deallocation(generator_state& state, std::uint64_t identifier, std::uint32_t thread);
+
+    /// This method removes a random identifier from a list, and adds its deallocation.
+    /// \param state The state of the generation.
+    /// \param live_identifiers The identifiers of the allocations that are not freed yet. It may not be empty.
+    static void free_random(generator_state& state, std::vector<std::uint64_t>& live_identifiers);
+
+    pattern_options m_options; // This field contains the options of the pattern.
+};
+
+#endif
@@ -1,88 +1,490 @@
 #ifndef ALLOCATOR_POOL_ALLOCATOR_H
 #define ALLOCATOR_POOL_ALLOCATOR_H
 
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <span> // Include here all the 'span' facilities.
+#include <utility> // Include here all the 'utility' facilities.
 #include <vector> // Include here all the 'vector' facilities.
 
 #include "block_allocator.h" // Include here all the 'block_allocator' facilities.
 #include "chunk_list.h" // Include here all the 'chunk_list' facilities.
+#include "pool_options.h" // Include here all the 'pool_options' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Blocks whose chunks are all free again are called 'warm' blocks. They still use physical memory, but they are ready for the next spike of allocations.
+// Trimming gives the warm blocks above the configured number back to the operating system, either by unmapping them or by decommitting their pages.
+// A released block stays in the list of blocks. When it is needed again, it is mapped again (or its pages come back on the first access) on the next allocation.
+// Every new block costs at least one call to 'mmap'. With small blocks, a pool with millions of chunks therefore makes a system call for every few chunks.
+// With a growth factor above 1, every new block is that many times bigger than the previous one, until a block is as big as 'chunk_block_alignment'.
+// The number of blocks, and so the number of system calls, then only grows with the logarithm of the number of chunks. A small pool still starts with a small block.
+// Batches of chunks can be allocated and deallocated at once. 'allocate_bulk' checks the current block only once per block, and carves the chunks that were never used as a single run.
+// 'deallocate_bulk' links the chunks of the same block into a chain, and splices that chain into the free list of the block at once, with a single update of the bookkeeping.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// 'allocate' only hands out raw memory. The data of the chunk is not constructed, so assigning a 'T' with a constructor or destructor to it is undefined behaviour.
+// 'emplace' constructs the object within the chunk, and 'destroy' destroys it before the chunk is given back. When the constructor throws, the chunk is given back right away.
+// A 'pool_unique_ptr' destroys its object automatically. Its deleter has no state, it finds the pool of the object through the header of its block.
+// So a 'pool_unique_ptr' is exactly as big as a raw pointer, just like an 'std::unique_ptr' with the default deleter.
+// PAY ATTENTION! The headers refer to the pool itself, so a pool can not be copied or moved. All its objects must be destroyed before the pool itself.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// With the local NUMA mode, every new block is bound to the node of the thread that creates it. The blocks of every node have a current block and partial blocks of their own.
+// An allocation asks the node of the calling thread (through the vDSO, so without a system call), and only takes chunks from the blocks of that node.
+// A chunk that is deallocated goes back to its own block, so also back to its own node, whatever thread deallocates it.
+// All the blocks stay in a single list, so the index in the header of a block still finds it in O(1) time. The usage of every node can be asked with 'get_numa_node_usage'.
+// PAY ATTENTION! The pool itself is still not thread-safe. The mode helps for a pool per thread that moves between the sockets, or a pool that is shared behind a lock.
+// ---- END EXTRA INFORMATION ---- //
+
+// ---- EXTRA INFORMATION ---- //
+// With a debug mode, every deallocation is checked before the chunk touches the free list. A double free, or a chunk of another pool, is reported and then ignored, so the free list stays intact.
+// 'destroy' checks the chunk before the destructor runs, so an object that is destroyed twice, only runs its destructor once.
+// A guarded pool gives a batch back chunk by chunk, so that every chunk is checked. Batches then lose their speed-up, but single allocations stay O(1).
+// ---- END EXTRA INFORMATION ---- //
+
+/// This structure 'numa_node_usage' contains the usage of the blocks of a memory pool allocator on a single NUMA node.
+struct numa_node_usage {
+    std::size_t m_number_of_blocks{0}; // The number of blocks of this node.
+    std::size_t m_used_chunks{0}; // The number of chunks of these blocks that are in use.
+    std::size_t m_resident_bytes{0}; // The number of bytes of these blocks that are neither unmapped nor decommitted.
+};
+
+/// This structure is the deleter of a 'pool_unique_ptr'. It destroys the object, and gives its chunk back to the memory pool allocator it was allocated from.
+/// \tparam T The type of the object.
+/// \tparam Alignment The minimum alignment of the chunks of the memory pool allocator.
+template <typename T, std::size_t Alignment = alignof(T)>
+struct pool_deleter {
+    /// This operator destroys the object, and gives its chunk back to its memory pool allocator.
+    /// \param object The address of an object that is constructed with 'emplace'.
+    void operator()(T* object) const noexcept;
+};
+
+/// This is a unique pointer to an object within a memory pool allocator. It is as big as a raw pointer.
+/// \tparam T The type of the object.
+/// \tparam Alignment The minimum alignment of the chunks of the memory pool allocator.
+template <typename T, std::size_t Alignment = alignof(T)>
+using pool_unique_ptr = std::unique_ptr<T, pool_deleter<T, Alignment>>;
 
 /// This is the 'pool_allocator' class, that represents a memory pool allocator.
 /// \tparam T The type of this specific class.
-template <typename T>
+/// \tparam Alignment The minimum alignment of every chunk, for instance 64 bytes for a whole cache line. It must be a power of two.
+template <typename T, std::size_t Alignment = alignof(T)>
 class pool_allocator {
 public:
     /// This is the constructor of the 'memory_pool' allocator class.
-    /// \param chunk_per_blocks This is the number of chunks that a block of memory will contain. This is NOT in bytes!
-    explicit pool_allocator(const std::size_t& chunk_per_blocks);
+    /// \param chunk_per_blocks This is the number of chunks that the first block of memory will contain. This is NOT in bytes! The block is rounded up to whole pages.
+    /// \param options These are the options of this memory pool allocator, for instance its trimming policy and its growth factor.
+    explicit pool_allocator(const std::size_t& chunk_per_blocks, const pool_options& options = {});
 
     /// This is the destructor of the 'memory_pool' allocator class.
     ~pool_allocator();
 
+    /// A memory pool allocator can not be copied, because the headers of its blocks refer to it.
+    pool_allocator(const pool_allocator&) = delete;
+
+    /// A memory pool allocator can not be copied, because the headers of its blocks refer to it.
+    pool_allocator& operator=(const pool_allocator&) = delete;
+
     /// This method allocates memory for a new chunk.
     /// \return The address of an allocated chunk.
-    [[maybe_unused]] chunk<T>* allocate();
+    [[maybe_unused]] chunk<T, Alignment>* allocate();
 
-    /// This method releases memory for an allocated chunk.
+    /// This method releases memory for an allocated chunk. The chunk is given back to the block it was allocated from.
     /// \param release_chunk The address of the chunk that you want to deallocate.
-    [[maybe_unused]] void deallocate(chunk<T>* release_chunk) noexcept;
+    [[maybe_unused]] void deallocate(chunk<T, Alignment>* release_chunk) noexcept;
+
+    /// This method allocates memory for several chunks at once. When it throws, none of the chunks are allocated.
+    /// \param number_of_chunks The number of chunks that you want to allocate.
+    /// \param allocated_chunks The place where the addresses of the chunks are written to. It must have room for 'number_of_chunks' addresses.
+    void allocate_bulk(std::size_t number_of_chunks, chunk<T, Alignment>** allocated_chunks);
+
+    /// This method releases memory for several allocated chunks at once. Chunks of the same block that follow each other within the span are given back as a single chain.
+    /// \param release_chunks The addresses of the chunks that you want to deallocate. Their data is overwritten, so their objects must already be destroyed.
+    void deallocate_bulk(std::span<chunk<T, Alignment>* const> release_chunks) noexcept;
+
+    /// This method allocates a chunk, and constructs an object within it. When the constructor throws, the chunk is given back.
+    /// \tparam Args The types of the arguments of the constructor.
+    /// \param arguments The arguments that are passed to the constructor of 'T'.
+    /// \return The address of the constructed object.
+    template <typename... Args>
+    [[nodiscard]] T* emplace(Args&&... arguments);
+
+    /// This method destroys an object, and gives its chunk back to the block it was allocated from.
+    /// \param object The address of an object that is constructed with 'emplace'.
+    void destroy(T* object) noexcept;
+
+    /// This method allocates a chunk, and constructs an object within it, that is destroyed automatically.
+    /// \tparam Args The types of the arguments of the constructor.
+    /// \param arguments The arguments that are passed to the constructor of 'T'.
+    /// \return A unique pointer that owns the constructed object.
+    template <typename... Args>
+    [[nodiscard]] pool_unique_ptr<T, Alignment> emplace_unique(Args&&... arguments);
+
+    /// This method returns the number of blocks this allocator owns.
+    /// \return The number of blocks, also the ones without any chunks in use.
+    [[nodiscard]] std::size_t get_number_of_blocks() const noexcept;
+
+    /// This method gives the warm blocks above the number of warm blocks in the options back to the operating system.
+    /// \return The number of bytes that this trim gave back.
+    std::size_t trim() noexcept;
+
+    /// This method gives the warm blocks above the given number back to the operating system.
+    /// \param warm_blocks The number of warm blocks that you want to keep.
+    /// \return The number of bytes that this trim gave back.
+    std::size_t trim(const std::size_t& warm_blocks) noexcept;
+
+    /// This method returns the number of blocks whose chunks are all free, but that still use physical memory.
+    /// \return The number of warm blocks.
+    [[nodiscard]] std::size_t get_number_of_warm_blocks() const noexcept;
+
+    /// This method returns the total number of bytes that all the trims, also the automatic ones, gave back.
+    /// \return The number of bytes given back to the operating system.
+    [[nodiscard]] std::size_t get_reclaimed_bytes() const noexcept;
+
+    /// This method returns the number of NUMA nodes this allocator keeps blocks for.
+    /// \return The number of nodes with the local NUMA mode, otherwise 1.
+    [[nodiscard]] std::size_t get_number_of_numa_nodes() const noexcept;
+
+    /// This method returns the usage of the blocks of a single NUMA node.
+    /// \param numa_node The node, below 'get_number_of_numa_nodes'. Without the local NUMA mode, node 0 contains all the blocks.
+    /// \return The usage of the blocks of the node.
+    [[nodiscard]] numa_node_usage get_numa_node_usage(std::size_t numa_node) const noexcept;
 
 private:
+    /// This structure 'node_block_list' contains the blocks of a single NUMA node that chunks are allocated from.
+    struct node_block_list {
+        std::vector<std::size_t> m_partial_blocks{}; // The indices of the blocks of this node, other than its current block, that have free chunks again.
+        std::size_t m_current_block{no_block}; // The index of the current block of this node.
+    };
+
+    /// This method checks whether a chunk may be given back to a guarded pool. A chunk of another pool, or a chunk that is not in use, is reported.
+    /// \param release_chunk The address of the chunk that is deallocated.
+    /// \return True if the chunk is in use by this pool.
+    [[nodiscard]] bool validate_release(const chunk<T, Alignment>* release_chunk) const noexcept;
+
+    /// This method finds the list of blocks that a block belongs to.
+    /// \param numa_node The NUMA node of the block.
+    /// \return The index of the list of blocks of the node.
+    [[nodiscard]] static std::size_t find_node_list(std::size_t numa_node) noexcept;
+    /// This value indicates that there is no current block yet.
+    static constexpr std::size_t no_block = static_cast<std::size_t>(-1);
+
+    /// This method finds the block to allocate from. When the current block is full, a partial block is reused, or a new block is created.
+    /// \return A reference to the block with free chunks.
+    chunk_list<T, Alignment>& find_current_block();
+
+    /// This method gives a chain of chunks back to the block they were allocated from, and updates the bookkeeping of the blocks.
+    /// \param block_index The index of the block of all the chunks.
+    /// \param first_chunk The first chunk of the chain.
+    /// \param last_chunk The last chunk of the chain, the chunks in between must already be linked.
+    /// \param number_of_chunks The number of chunks within the chain.
+    void release_chain(std::size_t block_index, chunk<T, Alignment>* first_chunk, chunk<T, Alignment>* last_chunk, std::size_t number_of_chunks) noexcept;
+
     /// This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
     /// \param pointer_to_memory Memory address of the memory that you are allocating/deallocating.
     /// \param number_of_bytes The number of bytes you are allocating/deallocating.
     /// \param is_allocating Indication whether you want to allocate/deallocate.
     [[maybe_unused]] void used_memory(T* pointer_to_memory, const std::size_t& number_of_bytes, bool is_allocating = true); // Used for showing messages.
 
-    std::vector<chunk_list<T>, block_allocator<chunk_list<T>>> m_block_list; // This field is a vector of blocks, that uses a custom allocator. This is a design decision, so that you can allocate multiple blocks, with chunks. This is allowed within a memory pool allocator.
-    chunk_list<T>* m_current_block; // This list of chunks to your current block with not yet allocated chunks.
-    std::size_t m_current_chunk; // The number of chunks per block.
-    std::size_t m_chunks_per_block; // The number of chunks per block.
+    std::vector<chunk_list<T, Alignment>, block_allocator<chunk_list<T, Alignment>>> m_block_list; // This field is a vector of blocks, that uses a custom allocator. This is a design decision, so that you can allocate multiple blocks, with chunks. This is allowed within a memory pool allocator.
+    std::vector<node_block_list> m_node_lists; // This field contains the current block and the partial blocks of every NUMA node. Without the local NUMA mode, there is a single list.
+    std::size_t m_chunks_per_block; // The number of chunks of the next new block. It grows with the growth factor of the options.
+    std::size_t m_number_of_warm_blocks; // The number of blocks whose chunks are all free, but that still use physical memory.
+    std::size_t m_reclaimed_bytes; // The total number of bytes given back to the operating system.
+    pool_options m_options; // The options of this memory pool allocator.
 };
 
 // This is the constructor of the 'memory_pool' allocator class.
-template<typename T>
-pool_allocator<T>::pool_allocator(const std::size_t &chunk_per_blocks) :
+template<typename T, std::size_t Alignment>
+pool_allocator<T, Alignment>::pool_allocator(const std::size_t &chunk_per_blocks, const pool_options& options) :
     m_block_list{},
-    m_current_block{nullptr},
-    m_current_chunk{chunk_per_blocks},
-    m_chunks_per_block{chunk_per_blocks}
+    m_node_lists(options.m_numa_mode == numa_mode::local ? memory_mapping::get_number_of_numa_nodes() : 1),
+    m_chunks_per_block{chunk_per_blocks},
+    m_number_of_warm_blocks{0},
+    m_reclaimed_bytes{0},
+    m_options{options}
 {}
 
 // This is the destructor of the 'memory_pool' allocator class.
-template<typename T>
-pool_allocator<T>::~pool_allocator() {
+template<typename T, std::size_t Alignment>
+pool_allocator<T, Alignment>::~pool_allocator() {
     // Go through all the blocks, deallocate the memory for the list of chunks.
     for ([[maybe_unused]] auto& single_block : m_block_list)
         single_block.remove_chunk_list();
 }
 
 // This method allocates memory for a new chunk.
-template<typename T>
-[[maybe_unused]] chunk<T> *pool_allocator<T>::allocate() {
-    // Check if you have not reached the end of a block.
-    if (m_current_chunk == m_chunks_per_block) {
-        m_block_list.push_back(chunk_list<T>{m_chunks_per_block}); // Create a new block with chunks.
-        m_current_block = &m_block_list.back(); // Change your current block.
-        m_current_chunk = 0; // Your number of chunk is zero, you can allocate new memory.
+template<typename T, std::size_t Alignment>
+[[maybe_unused]] chunk<T, Alignment> *pool_allocator<T, Alignment>::allocate() {
+    return find_current_block().get_free_chunk(); // Get a free chunk.
+}
+
+// This method releases memory for an allocated chunk. The chunk is given back to the block it was allocated from.
+template<typename T, std::size_t Alignment>
+[[maybe_unused]] void pool_allocator<T, Alignment>::deallocate(chunk<T, Alignment>* release_chunk) noexcept {
+    auto block_index = chunk_list<T, Alignment>::find_block_index(release_chunk); // Find the block of this chunk in O(1) time, by reading the header of its block.
+
+    // A guarded pool only gives back a chunk that is in use. Its canaries are checked, and it is poisoned.
+    if (m_options.m_debug_mode != pool_debug_mode::none) {
+        if (!validate_release(release_chunk))
+            return;
+
+        m_block_list[block_index].guard_released_chunk(release_chunk);
+    }
+
+    release_chain(block_index, release_chunk, release_chunk, 1); // A single chunk is a chain of its own.
+}
+
+// This method allocates memory for several chunks at once. When it throws, none of the chunks are allocated.
+template<typename T, std::size_t Alignment>
+void pool_allocator<T, Alignment>::allocate_bulk(std::size_t number_of_chunks, chunk<T, Alignment> **allocated_chunks) {
+    std::size_t number_of_allocated{0}; // The number of chunks that are already written.
+
+    try {
+        // Take as many chunks as possible from every block, before the next block is needed.
+        while (number_of_allocated < number_of_chunks)
+            number_of_allocated += find_current_block().get_free_chunks(allocated_chunks + number_of_allocated, number_of_chunks - number_of_allocated);
+    }
+    catch (...) {
+        deallocate_bulk(std::span<chunk<T, Alignment>* const>{allocated_chunks, number_of_allocated}); // A new block could not be mapped, give back what was already allocated.
+        throw;
+    }
+}
+
+// This method releases memory for several allocated chunks at once. Chunks of the same block that follow each other within the span are given back as a single chain.
+template<typename T, std::size_t Alignment>
+void pool_allocator<T, Alignment>::deallocate_bulk(std::span<chunk<T, Alignment>* const> release_chunks) noexcept {
+    // Linking a chain writes to the chunks before they are checked. A guarded pool therefore checks and gives back every chunk on its own.
+    if (m_options.m_debug_mode != pool_debug_mode::none) {
+        for (auto* single_chunk : release_chunks)
+            deallocate(single_chunk);
+
+        return;
+    }
+
+    for (std::size_t chain_begin = 0; chain_begin < release_chunks.size();) {
+        auto block_begin = reinterpret_cast<std::uintptr_t>(release_chunks[chain_begin]) & ~(chunk_block_alignment - 1); // The start of the block of this chain.
+        auto chain_end = chain_begin + 1; // One past the last chunk of the chain.
+
+        // Link the next chunks into the chain, as long as they belong to the same block. Comparing the addresses is enough, the header is only read once.
+        for (; chain_end < release_chunks.size() && (reinterpret_cast<std::uintptr_t>(release_chunks[chain_end]) & ~(chunk_block_alignment - 1)) == block_begin; chain_end++)
+            release_chunks[chain_end - 1]->m_next_node = release_chunks[chain_end];
+
+        auto block_index = chunk_list<T, Alignment>::find_block_index(release_chunks[chain_begin]); // Find the block of this chain in O(1) time.
+        release_chain(block_index, release_chunks[chain_begin], release_chunks[chain_end - 1], chain_end - chain_begin);
+
+        chain_begin = chain_end; // Continue with the next chain.
+    }
+}
+
+// This method allocates a chunk, and constructs an object within it. When the constructor throws, the chunk is given back.
+template<typename T, std::size_t Alignment>
+template<typename... Args>
+T *pool_allocator<T, Alignment>::emplace(Args&&... arguments) {
+    auto* allocated_chunk = allocate(); // Get a chunk with raw memory.
+
+    try {
+        return std::construct_at(&allocated_chunk->m_data, std::forward<Args>(arguments)...); // The data becomes the active field of the chunk.
+    }
+    catch (...) {
+        deallocate(allocated_chunk); // The object was never constructed, so only the chunk is given back.
+        throw;
+    }
+}
+
+// This method destroys an object, and gives its chunk back to the block it was allocated from.
+template<typename T, std::size_t Alignment>
+void pool_allocator<T, Alignment>::destroy(T *object) noexcept {
+    // A guarded pool checks the chunk first, so that an object is never destroyed twice.
+    if (m_options.m_debug_mode != pool_debug_mode::none && !validate_release(reinterpret_cast<chunk<T, Alignment>*>(object)))
+        return;
+
+    std::destroy_at(object);
+    deallocate(reinterpret_cast<chunk<T, Alignment>*>(object)); // The chunk is a union, so the address of its data is also the address of the chunk.
+}
+
+// This method allocates a chunk, and constructs an object within it, that is destroyed automatically.
+template<typename T, std::size_t Alignment>
+template<typename... Args>
+pool_unique_ptr<T, Alignment> pool_allocator<T, Alignment>::emplace_unique(Args&&... arguments) {
+    return pool_unique_ptr<T, Alignment>{emplace(std::forward<Args>(arguments)...)};
+}
+
+// This method finds the block to allocate from. When the current block is full, a partial block is reused, or a new block is created.
+template<typename T, std::size_t Alignment>
+chunk_list<T, Alignment> &pool_allocator<T, Alignment>::find_current_block() {
+    auto numa_node = m_node_lists.size() > 1 ? memory_mapping::get_current_numa_node() : memory_mapping::any_numa_node; // Only with several lists, the node of the calling thread matters.
+    auto& node_list = m_node_lists[find_node_list(numa_node)]; // The blocks you are allocating from.
+
+    // Check if you have reached the end of your current block.
+    if (node_list.m_current_block == no_block || m_block_list[node_list.m_current_block].is_full()) {
+        // First reuse a block that got free chunks again. Only if there is none, create a new block with chunks.
+        if (!node_list.m_partial_blocks.empty()) {
+            node_list.m_current_block = node_list.m_partial_blocks.back(); // Change your current block.
+            node_list.m_partial_blocks.pop_back();
+        }
+        else {
+            m_block_list.push_back(chunk_list<T, Alignment>{m_chunks_per_block, m_block_list.size(), m_options.m_page_mode, m_options.m_fill_mode, this, numa_node, m_options.m_debug_mode, m_options.m_violation_handler}); // Create a new block with chunks. Its index and its owner are stored in its header.
+            node_list.m_current_block = m_block_list.size() - 1; // Change your current block.
+
+            // The next block grows from the real size of this block, with its rounded up pages. The block list limits the size itself, so it only has to stay below the limit here.
+            m_chunks_per_block = std::min(m_block_list.back().get_number_of_chunks() * std::max(m_options.m_growth_factor, std::size_t{1}), chunk_block_alignment / sizeof(chunk<T, Alignment>));
+        }
     }
 
-    m_current_chunk++; // Increment the number of chunks that indicates the amount of allocated memory.
-    return m_current_block->get_free_chunk(); // Get a free chunk.
+    auto& current_block = m_block_list[node_list.m_current_block]; // The block you are allocating from.
+
+    // A warm block is used again, so it is no longer warm.
+    if (current_block.is_empty() && current_block.is_resident())
+        m_number_of_warm_blocks--;
+
+    return current_block; // Return the block with free chunks.
 }
 
-// This method releases memory for an allocated chunk.
-template<typename T>
-[[maybe_unused]] void pool_allocator<T>::deallocate(chunk<T>* release_chunk) noexcept {
-    m_current_block->remove_chunk(release_chunk); // Remove a specific chunk.
-    m_current_chunk--; // You freed a chunk, decrement the number of allocated chunks for your current block.
+// This method gives a chain of chunks back to the block they were allocated from, and updates the bookkeeping of the blocks.
+template<typename T, std::size_t Alignment>
+void pool_allocator<T, Alignment>::release_chain(std::size_t block_index, chunk<T, Alignment> *first_chunk, chunk<T, Alignment> *last_chunk, std::size_t number_of_chunks) noexcept {
+    auto& owning_block = m_block_list[block_index]; // The block these chunks were allocated from.
+    auto& node_list = m_node_lists[find_node_list(owning_block.get_numa_node())]; // The blocks of the same node.
+
+    // A full block gets free chunks again. Remember it, so that it is reused before a new block is created.
+    if (owning_block.is_full() && block_index != node_list.m_current_block)
+        node_list.m_partial_blocks.push_back(block_index);
+
+    owning_block.remove_chunks(first_chunk, last_chunk, number_of_chunks); // Splice the chain into the free list.
+
+    // The last chunk of this block is freed, so the block is warm now. Trim right away when there are too many warm blocks.
+    if (owning_block.is_empty()) {
+        m_number_of_warm_blocks++;
+
+        if (m_options.m_automatic_trim && m_number_of_warm_blocks > m_options.m_warm_blocks)
+            trim();
+    }
+}
+
+// This method returns the number of blocks this allocator owns.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::get_number_of_blocks() const noexcept {
+    return m_block_list.size(); // Every element of the vector is a block.
+}
+
+// This method gives the warm blocks above the number of warm blocks in the options back to the operating system.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::trim() noexcept {
+    return trim(m_options.m_warm_blocks); // Use the number of warm blocks of the options.
+}
+
+// This method gives the warm blocks above the given number back to the operating system.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::trim(const std::size_t &warm_blocks) noexcept {
+    std::size_t reclaimed_bytes{0}; // The number of bytes this trim gives back.
+
+    // Go through the blocks from the newest to the oldest. The newest blocks are most likely created during the last spike.
+    for (auto block_index = m_block_list.size(); block_index > 0 && m_number_of_warm_blocks > warm_blocks; block_index--) {
+        auto& single_block = m_block_list[block_index - 1]; // The block you may release.
+
+        // Only a warm block can be released.
+        if (!single_block.is_empty() || !single_block.is_resident())
+            continue;
+
+        if (m_options.m_release_mode == trim_release_mode::unmap) {
+            reclaimed_bytes += single_block.get_size_block();
+            single_block.remove_chunk_list(); // The block is mapped again when it is needed.
+        }
+        else {
+            auto decommitted_bytes = single_block.decommit_chunk_list(); // The pages come back on the first access.
+
+            // A block of a single page can not be decommitted, it stays warm.
+            if (decommitted_bytes == 0)
+                continue;
+
+            reclaimed_bytes += decommitted_bytes;
+        }
+
+        m_number_of_warm_blocks--; // This block is no longer warm.
+    }
+
+    m_reclaimed_bytes += reclaimed_bytes; // Keep track of the total.
+
+    return reclaimed_bytes; // Return the number of bytes this trim gave back.
+}
+
+// This method returns the number of blocks whose chunks are all free, but that still use physical memory.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::get_number_of_warm_blocks() const noexcept {
+    return m_number_of_warm_blocks;
+}
+
+// This method returns the total number of bytes that all the trims, also the automatic ones, gave back.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::get_reclaimed_bytes() const noexcept {
+    return m_reclaimed_bytes;
+}
+
+// This method returns the number of NUMA nodes this allocator keeps blocks for.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::get_number_of_numa_nodes() const noexcept {
+    return m_node_lists.size(); // Every node has a list of its own.
+}
+
+// This method returns the usage of the blocks of a single NUMA node.
+template<typename T, std::size_t Alignment>
+numa_node_usage pool_allocator<T, Alignment>::get_numa_node_usage(std::size_t numa_node) const noexcept {
+    numa_node_usage node_usage{}; // The usage of this node.
+
+    // Go through all the blocks, and only count the blocks of the given node.
+    for (const auto& single_block : m_block_list) {
+        if (find_node_list(single_block.get_numa_node()) != numa_node)
+            continue;
+
+        node_usage.m_number_of_blocks++;
+        node_usage.m_used_chunks += single_block.get_used_chunks();
+        node_usage.m_resident_bytes += single_block.is_resident() ? single_block.get_size_block() : 0;
+    }
+
+    return node_usage; // Return the usage of this node.
+}
+
+// This method checks whether a chunk may be given back to a guarded pool. A chunk of another pool, or a chunk that is not in use, is reported.
+template<typename T, std::size_t Alignment>
+bool pool_allocator<T, Alignment>::validate_release(const chunk<T, Alignment> *release_chunk) const noexcept {
+    // The index in the header of another pool would point into the wrong list of blocks.
+    if (chunk_list<T, Alignment>::find_owner(release_chunk) != this) {
+        report_pool_violation(m_options.m_violation_handler, pool_violation::foreign_chunk, release_chunk);
+        return false;
+    }
+
+    // The bitmap of the block tells in O(1) time whether the chunk is in use.
+    if (!m_block_list[chunk_list<T, Alignment>::find_block_index(release_chunk)].is_chunk_in_use(release_chunk)) {
+        report_pool_violation(m_options.m_violation_handler, pool_violation::double_free, release_chunk);
+        return false;
+    }
+
+    return true;
+}
+
+// This method finds the list of blocks that a block belongs to.
+template<typename T, std::size_t Alignment>
+std::size_t pool_allocator<T, Alignment>::find_node_list(std::size_t numa_node) noexcept {
+    return numa_node == memory_mapping::any_numa_node ? 0 : numa_node; // A block that is not bound belongs to the single list.
 }
 
 // This method is just used for debugging purposes, it shows how much memory you just allocated, or you are going to deallocate.
-template<typename T>
-[[maybe_unused]] void pool_allocator<T>::used_memory(T *pointer_to_memory, const size_t &number_of_bytes, bool is_allocating) {
+template<typename T, std::size_t Alignment>
+[[maybe_unused]] void pool_allocator<T, Alignment>::used_memory(T *pointer_to_memory, const size_t &number_of_bytes, bool is_allocating) {
     // Show a message of allocating/deallocating.
     std::cout << "---- ALLOCATOR MESSAGE ---- \t" << (is_allocating ? "Allocated memory: " : "Deallocated memory: ")
         << sizeof(T) * number_of_bytes << " bytes at address: " << std::hex << std::showbase << reinterpret_cast<T*>(pointer_to_memory) << std::dec << std::endl;
 }
 
+// This operator destroys the object, and gives its chunk back to its memory pool allocator.
+template<typename T, std::size_t Alignment>
+void pool_deleter<T, Alignment>::operator()(T *object) const noexcept {
+    auto* owning_pool = static_cast<pool_allocator<T, Alignment>*>(chunk_list<T, Alignment>::find_owner(reinterpret_cast<chunk<T, Alignment>*>(object))); // The header of its block knows the pool.
+    owning_pool->destroy(object);
+}
+
 #endif
\ No newline at end of file
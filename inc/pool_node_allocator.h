@@ -0,0 +1,267 @@
+#ifndef ALLOCATOR_POOL_NODE_ALLOCATOR_H
+#define ALLOCATOR_POOL_NODE_ALLOCATOR_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <limits> // Include here all the 'limits' facilities.
+#include <map> // Include here all the 'map' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+
+#include "pool_allocator.h" // Include here all the 'pool_allocator' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// The 'pool_allocator' hands out chunks, and can not be used as the allocator of an STL-container. This adapter makes that possible.
+// Node-based containers (like 'std::list', 'std::map', 'std::set' and 'std::unordered_map') never allocate their value type. They rebind the allocator to their internal node type.
+// So the adapter does not own a single memory pool, but refers to a shared 'pool_node_registry'. The registry creates a memory pool for every node size (and alignment) on first use.
+// Copies and rebound copies refer to the same registry, and are therefore equal. A node allocated by the one can be deallocated by the other, because the same node type gets the same pool.
+// Allocators with different registries are not equal. So the allocator propagates on a swap, a move assignment and a copy assignment of its container, and the nodes always stay with the registry they came from.
+// A single node comes from a memory pool. An array of nodes (like the buckets of an 'std::unordered_map') is rare, and is simply allocated with 'new'.
+// PAY ATTENTION! Just like 'pool_allocator', the registry and this adapter are not thread-safe. Every thread needs its own registry.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the storage of a single node within a memory pool of the registry.
+/// \tparam Size The size of the node, in bytes.
+/// \tparam Alignment The alignment of the node, in bytes.
+template <std::size_t Size, std::size_t Alignment>
+struct alignas(Alignment) pool_node_storage {
+    std::byte m_bytes[Size]; // The raw bytes of the node.
+};
+
+/// This is the class 'pool_node_registry'. It owns a memory pool for every node size and alignment that is requested.
+class pool_node_registry {
+public:
+    /// This is the constructor of the 'pool_node_registry' class. The memory pools are created on first use.
+    /// \param chunk_per_blocks This is the number of chunks that a block of every memory pool will contain. This is NOT in bytes!
+    /// \param options These are the options of every memory pool.
+    explicit pool_node_registry(const std::size_t& chunk_per_blocks = 1024, const pool_options& options = {});
+
+    /// This method returns the memory pool for nodes of the given size and alignment. It creates the pool when it does not exist yet.
+    /// \tparam Size The size of the node, in bytes.
+    /// \tparam Alignment The alignment of the node, in bytes.
+    /// \return A reference to the memory pool. It is valid as long as this registry exists.
+    template <std::size_t Size, std::size_t Alignment>
+    pool_allocator<pool_node_storage<Size, Alignment>>& get_pool();
+
+    /// This method looks up the memory pool for nodes of the given size and alignment. It never creates a pool.
+    /// \tparam Size The size of the node, in bytes.
+    /// \tparam Alignment The alignment of the node, in bytes.
+    /// \return A pointer to the memory pool, or a 'nullptr' when no node of this size was ever allocated.
+    template <std::size_t Size, std::size_t Alignment>
+    pool_allocator<pool_node_storage<Size, Alignment>>* find_pool() const noexcept;
+
+    /// This method returns the number of memory pools within this registry.
+    /// \return The number of different node sizes (and alignments) that were allocated.
+    [[nodiscard]] std::size_t get_number_of_pools() const noexcept;
+
+private:
+    std::map<std::pair<std::size_t, std::size_t>, std::shared_ptr<void>> m_pools; // This field contains the memory pools, indexed by their node size and alignment. The shared pointer destroys the pool with its real type.
+    std::size_t m_chunks_per_block; // The number of chunks per block of every memory pool.
+    pool_options m_options; // The options of every memory pool.
+};
+
+// This is the constructor of the 'pool_node_registry' class. The memory pools are created on first use.
+inline pool_node_registry::pool_node_registry(const std::size_t &chunk_per_blocks, const pool_options &options) :
+    m_pools{},
+    m_chunks_per_block{chunk_per_blocks},
+    m_options{options}
+{}
+
+// This method returns the memory pool for nodes of the given size and alignment. It creates the pool when it does not exist yet.
+template<std::size_t Size, std::size_t Alignment>
+pool_allocator<pool_node_storage<Size, Alignment>> &pool_node_registry::get_pool() {
+    // Reuse the memory pool, when a node of this size was allocated before.
+    if (auto* existing_pool = find_pool<Size, Alignment>())
+        return *existing_pool;
+
+    auto new_pool = std::make_shared<pool_allocator<pool_node_storage<Size, Alignment>>>(m_chunks_per_block, m_options);
+    m_pools.emplace(std::make_pair(Size, Alignment), new_pool);
+
+    return *new_pool; // The map keeps the pool alive.
+}
+
+// This method looks up the memory pool for nodes of the given size and alignment. It never creates a pool.
+template<std::size_t Size, std::size_t Alignment>
+pool_allocator<pool_node_storage<Size, Alignment>> *pool_node_registry::find_pool() const noexcept {
+    auto found_pool = m_pools.find(std::make_pair(Size, Alignment));
+    return found_pool == m_pools.end() ? nullptr : static_cast<pool_allocator<pool_node_storage<Size, Alignment>>*>(found_pool->second.get());
+}
+
+// This method returns the number of memory pools within this registry.
+inline std::size_t pool_node_registry::get_number_of_pools() const noexcept {
+    return m_pools.size();
+}
+
+/// This is the class 'pool_node_allocator'. It adapts the memory pools of a 'pool_node_registry' to the allocator requirements of the STL-containers.
+/// \tparam T The type of this specific class.
+template <typename T>
+class pool_node_allocator {
+public:
+    /// You must specify this type definition within an allocator. It is an value type.
+    [[maybe_unused]] typedef T value_type;
+
+    /// A swapped container takes the allocator of the other container with it, because the nodes belong to its registry.
+    [[maybe_unused]] typedef std::true_type propagate_on_container_swap;
+
+    /// A move assigned container takes over the allocator of the other container, together with its nodes.
+    [[maybe_unused]] typedef std::true_type propagate_on_container_move_assignment;
+
+    /// A copy assigned container refers to the registry of the other container from then on.
+    [[maybe_unused]] typedef std::true_type propagate_on_container_copy_assignment;
+
+    /// This is the constructor of the 'pool_node_allocator' class. It refers to a new registry of its own.
+    pool_node_allocator();
+
+    /// This is the constructor of the 'pool_node_allocator' class. It refers to the given registry.
+    /// \param shared_registry The registry this allocator allocates its nodes from.
+    explicit pool_node_allocator(std::shared_ptr<pool_node_registry> shared_registry) noexcept;
+
+    /// The converting constructor for this allocator. It refers to the same registry as the other allocator.
+    /// \tparam U The type of 'pool_node_allocator' U.
+    template <typename U>
+    [[maybe_unused]] pool_node_allocator(const pool_node_allocator<U>& other_allocator) noexcept; // Allocators must be implicitly convertible, so this constructor is not explicit.
+
+    /// The copy constructor for this allocator. It refers to the same registry, and the same memory pool, as the other allocator.
+    /// \param other_allocator The allocator that is copied.
+    pool_node_allocator(const pool_node_allocator& other_allocator) noexcept = default;
+
+    /// The move constructor for this allocator. It copies the registry and the memory pool, because a moved-from allocator must still be equal to its old value, so that its container can be used again.
+    /// \param other_allocator The allocator that is moved. It keeps its registry and its memory pool.
+    pool_node_allocator(pool_node_allocator&& other_allocator) noexcept;
+
+    /// The copy assignment operator for this allocator. It refers to the same registry, and the same memory pool, as the other allocator.
+    /// \param other_allocator The allocator that is copied.
+    /// \return A reference to this allocator.
+    pool_node_allocator& operator=(const pool_node_allocator& other_allocator) noexcept = default;
+
+    /// The move assignment operator for this allocator. It copies the registry and the memory pool, just like the move constructor.
+    /// \param other_allocator The allocator that is moved. It keeps its registry and its memory pool.
+    /// \return A reference to this allocator.
+    pool_node_allocator& operator=(pool_node_allocator&& other_allocator) noexcept;
+
+    /// This method allocates new memory. A single element comes from a memory pool, more elements come from 'new'.
+    /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
+    /// \return The first memory address of the allocated block of memory.
+    [[maybe_unused]] [[nodiscard]] T* allocate(std::size_t number_of_elements);
+
+    /// This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    [[maybe_unused]] void deallocate(T* allocated_memory, std::size_t number_of_elements) noexcept;
+
+    /// This method returns the maximum size that you can allocate.
+    /// \return The number of the maximum amount that you can allocate.
+    [[maybe_unused]] [[nodiscard]] std::size_t max_size() const;
+
+    /// This method returns the registry this allocator refers to.
+    /// \return A shared pointer to the registry.
+    [[nodiscard]] const std::shared_ptr<pool_node_registry>& get_registry() const noexcept;
+
+private:
+    /// This type is the memory pool for the elements of this allocator.
+    using node_pool = pool_allocator<pool_node_storage<sizeof(T), alignof(T)>>;
+
+    std::shared_ptr<pool_node_registry> m_registry; // This field is the registry this allocator allocates its nodes from.
+    node_pool* m_node_pool; // This field caches the memory pool of the registry for this type, so that it is only looked up once.
+};
+
+// This is the constructor of the 'pool_node_allocator' class. It refers to a new registry of its own.
+template<typename T>
+pool_node_allocator<T>::pool_node_allocator() :
+    m_registry{std::make_shared<pool_node_registry>()},
+    m_node_pool{nullptr}
+{}
+
+// This is the constructor of the 'pool_node_allocator' class. It refers to the given registry.
+template<typename T>
+pool_node_allocator<T>::pool_node_allocator(std::shared_ptr<pool_node_registry> shared_registry) noexcept :
+    m_registry{std::move(shared_registry)},
+    m_node_pool{nullptr}
+{}
+
+// The converting constructor for this allocator. It refers to the same registry as the other allocator.
+template<typename T>
+template<typename U>
+[[maybe_unused]] pool_node_allocator<T>::pool_node_allocator(const pool_node_allocator<U> &other_allocator) noexcept :
+    m_registry{other_allocator.get_registry()},
+    m_node_pool{nullptr}
+{}
+
+// The move constructor for this allocator. It copies the registry and the memory pool, because a moved-from allocator must still be equal to its old value, so that its container can be used again.
+template<typename T>
+pool_node_allocator<T>::pool_node_allocator(pool_node_allocator &&other_allocator) noexcept :
+    m_registry{other_allocator.m_registry},
+    m_node_pool{other_allocator.m_node_pool}
+{}
+
+// The move assignment operator for this allocator. It copies the registry and the memory pool, just like the move constructor.
+template<typename T>
+pool_node_allocator<T> &pool_node_allocator<T>::operator=(pool_node_allocator &&other_allocator) noexcept {
+    m_registry = other_allocator.m_registry;
+    m_node_pool = other_allocator.m_node_pool;
+    return *this;
+}
+
+// This method allocates new memory. A single element comes from a memory pool, more elements come from 'new'.
+template<typename T>
+[[maybe_unused]] T *pool_node_allocator<T>::allocate(std::size_t number_of_elements) {
+    // An array of elements does not fit in a chunk, so it comes from 'new'.
+    if (number_of_elements != 1) {
+        // Check if the number of bytes fits in a 'std::size_t'.
+        if (number_of_elements > max_size())
+            throw std::bad_array_new_length();
+
+        return static_cast<T*>(::operator new(number_of_elements * sizeof(T), std::align_val_t{alignof(T)}));
+    }
+
+    // Look up the memory pool, when this is the first node of this allocator.
+    if (m_node_pool == nullptr)
+        m_node_pool = &m_registry->template get_pool<sizeof(T), alignof(T)>();
+
+    return reinterpret_cast<T*>(m_node_pool->allocate()); // The data of a chunk starts at its first byte.
+}
+
+// This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
+template<typename T>
+[[maybe_unused]] void pool_node_allocator<T>::deallocate(T *allocated_memory, std::size_t number_of_elements) noexcept {
+    // An array of elements was allocated with 'new'.
+    if (number_of_elements != 1) {
+        ::operator delete(allocated_memory, std::align_val_t{alignof(T)});
+        return;
+    }
+
+    // The node was allocated by an equal allocator, so the memory pool already exists. Just look it up.
+    if (m_node_pool == nullptr)
+        m_node_pool = m_registry->template find_pool<sizeof(T), alignof(T)>();
+
+    m_node_pool->deallocate(reinterpret_cast<chunk<pool_node_storage<sizeof(T), alignof(T)>>*>(allocated_memory)); // Give the chunk back to its block.
+}
+
+// This method returns the maximum size that you can allocate.
+template<typename T>
+[[maybe_unused]] std::size_t pool_node_allocator<T>::max_size() const {
+    return std::numeric_limits<std::size_t>::max() / sizeof(T); // Calculate the amount of allocating memory.
+}
+
+// This method returns the registry this allocator refers to.
+template<typename T>
+const std::shared_ptr<pool_node_registry> &pool_node_allocator<T>::get_registry() const noexcept {
+    return m_registry;
+}
+
+/// This operator compares two 'pool_node' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if both allocators refer to the same registry, so memory of the one can be deallocated by the other.
+template <typename T, typename U>
+bool operator==(const pool_node_allocator<T>& first_allocator, const pool_node_allocator<U>& second_allocator) { return first_allocator.get_registry() == second_allocator.get_registry(); }
+
+/// This operator compares two 'pool_node' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if the allocators refer to different registries.
+template <typename T, typename U>
+bool operator!=(const pool_node_allocator<T>& first_allocator, const pool_node_allocator<U>& second_allocator) { return !(first_allocator == second_allocator); }
+
+#endif
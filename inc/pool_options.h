@@ -0,0 +1,60 @@
+#ifndef ALLOCATOR_POOL_OPTIONS_H
+#define ALLOCATOR_POOL_OPTIONS_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
+/// This enumeration class 'trim_release_mode' tells how a memory pool allocator gives a fully free block back to the operating system.
+enum class trim_release_mode {
+    unmap, // The whole block is unmapped with 'munmap'. It is mapped again when it is needed.
+    decommit // The block stays mapped, but its pages are dropped with 'madvise(MADV_DONTNEED)'. The page with the header stays.
+};
+
+/// This enumeration class 'block_fill_mode' tells how a new block of a memory pool allocator is prepared, before its chunks are handed out.
+enum class block_fill_mode {
+    linked, // All the chunks are linked into the free list as soon as the block is mapped. This touches every page of the block at once.
+    lazy, // The chunks are carved out of the block one by one, by bumping an index. Only the page of the next chunk is touched.
+    prefaulted // All the pages are faulted in with a single system call when the block is mapped, and the chunks are carved out lazily.
+};
+
+/// This enumeration class 'numa_mode' tells on which NUMA node the blocks of a memory pool allocator are placed.
+enum class numa_mode {
+    none, // The blocks are placed by the operating system, on the node of the thread that touches a page first.
+    local // Every block is bound to the node of the thread that creates it, and a thread allocates from the blocks of its own node.
+};
+
+/// This enumeration class 'pool_debug_mode' tells how much a memory pool allocator checks the way its chunks are used.
+enum class pool_debug_mode {
+    none, // Nothing is checked. A chunk costs exactly its own size.
+    guarded, // Every chunk is surrounded by canaries, a free chunk is poisoned, and a bitmap per block tells which chunks are in use. Misuse is reported, instead of corrupting the free list.
+    guard_pages // Like 'guarded', and every block is followed by a page without any access rights, so that running past the end of a block faults right away. Only blocks of normal pages get one.
+};
+
+/// This enumeration class 'pool_violation' tells which misuse of a chunk a guarded memory pool allocator detected.
+enum class pool_violation {
+    double_free, // A chunk is deallocated, while it is not in use. It is freed twice, or it was never handed out.
+    foreign_chunk, // A chunk is deallocated into another memory pool allocator than the one it came from.
+    use_after_free, // A free chunk was written to, after it was deallocated.
+    buffer_overflow // A canary around a chunk was overwritten, so something was written past the data of the chunk.
+};
+
+/// This is the function that is called for every misuse that a guarded memory pool allocator detects.
+/// \param violation The misuse that is detected.
+/// \param memory The address of the chunk that is misused.
+using pool_violation_handler = void (*)(pool_violation violation, const void* memory) noexcept;
+
+/// This structure 'pool_options' contains the options of a memory pool allocator. All the fields have a default value, so you only set what you need.
+struct pool_options {
+    std::size_t m_warm_blocks{1}; // This is the number of fully free blocks that are kept, so that a new spike of allocations does not need new memory right away.
+    bool m_automatic_trim{false}; // When this is true, the blocks above 'm_warm_blocks' are released as soon as they are fully free. Otherwise only the 'trim' method releases them.
+    trim_release_mode m_release_mode{trim_release_mode::unmap}; // This is how a fully free block is given back to the operating system.
+    page_mode m_page_mode{page_mode::normal}; // These are the pages that back the blocks. With huge pages, every block is a single huge page of 2 MiB.
+    block_fill_mode m_fill_mode{block_fill_mode::linked}; // This is how a new block is prepared. Lazy carving spreads the cost of a new block, prefaulting pays it at once within the kernel.
+    std::size_t m_growth_factor{1}; // Every new block gets this many times the chunks of the previous block, up to 'chunk_block_alignment'. With 1, all the blocks are equally big.
+    numa_mode m_numa_mode{numa_mode::none}; // This is where the blocks are placed. With a single NUMA node, both modes are the same.
+    pool_debug_mode m_debug_mode{pool_debug_mode::none}; // This is how much the use of the chunks is checked. A guarded pool reports misuse, instead of silently corrupting its free list.
+    pool_violation_handler m_violation_handler{nullptr}; // This function is called for every misuse of a guarded pool. With a 'nullptr', the misuse is printed as standard error.
+};
+
+#endif
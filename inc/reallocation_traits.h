@@ -0,0 +1,58 @@
+#ifndef ALLOCATOR_REALLOCATION_TRAITS_H
+#define ALLOCATOR_REALLOCATION_TRAITS_H
+
+#include <concepts> // Include here all the 'concepts' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <type_traits> // Include here all the 'type_traits' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// The allocators of the standard library can only allocate and deallocate. A container that grows therefore always allocates a bigger block, copies (or moves) its elements, and frees the old block.
+// For a buffer of gigabytes, this copy takes a lot of time, and both blocks are in memory at the same time. So the peak memory is twice the size of the buffer.
+// Some allocators of this project can do better. 'try_expand' grows an allocation in place, without moving it. 'reallocate' moves the pages of an allocation without copying them, for instance with 'mremap'.
+// These traits tell whether an allocator has these methods, so a container can use them when they exist, and falls back on allocating and copying otherwise.
+// 'reallocate' moves the objects bytewise, so it is only used for trivially copyable types. 'try_expand' never moves anything, so it is used for every type.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the structure 'reallocation_traits'. It tells whether an allocator can grow its allocations, and calls the growing methods when they exist.
+/// \tparam Allocator The type of the allocator.
+template <typename Allocator>
+struct reallocation_traits {
+    /// The type of the elements of the allocator.
+    using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+    /// This value tells whether the allocator can grow an allocation in place.
+    static constexpr bool can_expand = requires(Allocator& allocator, value_type* allocated_memory, std::size_t number_of_elements) {
+        { allocator.try_expand(allocated_memory, number_of_elements, number_of_elements) } -> std::same_as<bool>;
+    };
+
+    /// This value tells whether the allocator can move an allocation without a copy by the caller. It is only used for trivially copyable types.
+    static constexpr bool can_reallocate = std::is_trivially_copyable_v<value_type> && requires(Allocator& allocator, value_type* allocated_memory, std::size_t number_of_elements) {
+        { allocator.reallocate(allocated_memory, number_of_elements, number_of_elements) } -> std::same_as<value_type*>;
+    };
+
+    /// This method grows an allocation in place, when the allocator can.
+    /// \param allocator The allocator of the allocation.
+    /// \param allocated_memory The first address of the allocation.
+    /// \param old_number_of_elements The number of elements of the allocation.
+    /// \param new_number_of_elements The number of elements you want the allocation to have.
+    /// \return True if the allocation has the new size now. False when it can not grow, or when the allocator has no 'try_expand' method.
+    static bool try_expand(Allocator& allocator, value_type* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) noexcept {
+        if constexpr (can_expand)
+            return allocator.try_expand(allocated_memory, old_number_of_elements, new_number_of_elements);
+        else
+            return false;
+    }
+
+    /// This method moves an allocation to a bigger one, with the 'reallocate' method of the allocator. It only exists when 'can_reallocate' is true.
+    /// \param allocator The allocator of the allocation.
+    /// \param allocated_memory The first address of the allocation.
+    /// \param old_number_of_elements The number of elements of the allocation.
+    /// \param new_number_of_elements The number of elements you want the allocation to have.
+    /// \return The first address of the resized allocation.
+    static value_type* reallocate(Allocator& allocator, value_type* allocated_memory, std::size_t old_number_of_elements, std::size_t new_number_of_elements) requires can_reallocate {
+        return allocator.reallocate(allocated_memory, old_number_of_elements, new_number_of_elements);
+    }
+};
+
+#endif
@@ -0,0 +1,150 @@
+#ifndef ALLOCATOR_SIZE_CLASS_ALLOCATOR_H
+#define ALLOCATOR_SIZE_CLASS_ALLOCATOR_H
+
+#include <limits> // Include here all the 'limits' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+
+#include "size_class_pool.h" // Include here all the 'size_class_pool' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This class can be used as an allocator for, for instance a vector. This can also operate on different STL-containers, like 'std::unordered_map' and 'std::basic_string'.
+// It hands out memory from a 'size_class_pool', so requests of mixed sizes are served by memory pools instead of 'malloc'.
+// The allocator is stateful: it refers to a shared 'size_class_pool'. Copies, also rebound copies for another type, refer to the same pool, and are therefore equal.
+// A default constructed allocator refers to the default pool. PAY ATTENTION! Just like the pool itself, this allocator is not thread-safe.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'size_class_allocator', used for allocating memory of mixed sizes from a table of memory pools.
+/// \tparam T The type of this specific class.
+template <typename T>
+class size_class_allocator {
+public:
+    /// You must specify this type definition within an allocator. It is an value type.
+    [[maybe_unused]] typedef T value_type;
+
+    /// This is the constructor of the 'size_class_allocator' class. It refers to the default pool.
+    size_class_allocator() noexcept;
+
+    /// This is the constructor of the 'size_class_allocator' class. It refers to the given pool.
+    /// \param shared_pool The pool this allocator allocates its memory from.
+    explicit size_class_allocator(std::shared_ptr<size_class_pool> shared_pool) noexcept;
+
+    /// The converting constructor for this allocator. It refers to the same pool as the other allocator.
+    /// \tparam U The type of 'size_class_allocator' U.
+    template <typename U>
+    [[maybe_unused]] size_class_allocator(const size_class_allocator<U>& other_allocator) noexcept; // Allocators must be implicitly convertible, so this constructor is not explicit.
+
+    /// The copy constructor for this allocator. It refers to the same pool as the other allocator.
+    /// \param other_allocator The allocator that is copied.
+    size_class_allocator(const size_class_allocator& other_allocator) noexcept = default;
+
+    /// The move constructor for this allocator. It copies the pool, because a moved-from allocator must still be equal to its old value, so that its container can be used again.
+    /// \param other_allocator The allocator that is moved. It keeps its pool.
+    size_class_allocator(size_class_allocator&& other_allocator) noexcept;
+
+    /// The copy assignment operator for this allocator. It refers to the same pool as the other allocator.
+    /// \param other_allocator The allocator that is copied.
+    /// \return A reference to this allocator.
+    size_class_allocator& operator=(const size_class_allocator& other_allocator) noexcept = default;
+
+    /// The move assignment operator for this allocator. It copies the pool, just like the move constructor.
+    /// \param other_allocator The allocator that is moved. It keeps its pool.
+    /// \return A reference to this allocator.
+    size_class_allocator& operator=(size_class_allocator&& other_allocator) noexcept;
+
+    /// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
+    /// \param number_of_elements The number of elements that you want to allocate memory for. This is NOT in bytes!
+    /// \return The first memory address of the allocated block of memory.
+    [[maybe_unused]] [[nodiscard]] T* allocate(std::size_t number_of_elements);
+
+    /// This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
+    /// \param allocated_memory A pointer to the memory address allocated with the 'allocate' method.
+    /// \param number_of_elements The number of elements. It must be the same as just passed to the 'allocate' method.
+    [[maybe_unused]] void deallocate(T* allocated_memory, std::size_t number_of_elements) noexcept;
+
+    /// This method returns the maximum size that you can allocate.
+    /// \return The number of the maximum amount that you can allocate.
+    [[maybe_unused]] [[nodiscard]] std::size_t max_size() const;
+
+    /// This method returns the pool this allocator refers to.
+    /// \return A shared pointer to the pool.
+    [[nodiscard]] const std::shared_ptr<size_class_pool>& get_pool() const noexcept;
+
+private:
+    std::shared_ptr<size_class_pool> m_pool; // This field is the pool this allocator allocates its memory from.
+};
+
+// This is the constructor of the 'size_class_allocator' class. It refers to the default pool.
+template<typename T>
+size_class_allocator<T>::size_class_allocator() noexcept :
+    m_pool{size_class_pool::default_pool()}
+{}
+
+// This is the constructor of the 'size_class_allocator' class. It refers to the given pool.
+template<typename T>
+size_class_allocator<T>::size_class_allocator(std::shared_ptr<size_class_pool> shared_pool) noexcept :
+    m_pool{std::move(shared_pool)}
+{}
+
+// The converting constructor for this allocator. It refers to the same pool as the other allocator.
+template<typename T>
+template<typename U>
+[[maybe_unused]] size_class_allocator<T>::size_class_allocator(const size_class_allocator<U> &other_allocator) noexcept :
+    m_pool{other_allocator.get_pool()}
+{}
+
+// The move constructor for this allocator. It copies the pool, because a moved-from allocator must still be equal to its old value, so that its container can be used again.
+template<typename T>
+size_class_allocator<T>::size_class_allocator(size_class_allocator &&other_allocator) noexcept :
+    m_pool{other_allocator.m_pool}
+{}
+
+// The move assignment operator for this allocator. It copies the pool, just like the move constructor.
+template<typename T>
+size_class_allocator<T> &size_class_allocator<T>::operator=(size_class_allocator &&other_allocator) noexcept {
+    m_pool = other_allocator.m_pool;
+    return *this;
+}
+
+// This method allocates new memory. In this case 'number_of_elements' is always the number of elements that you want to allocate. It is NOT in bytes!
+template<typename T>
+[[maybe_unused]] T *size_class_allocator<T>::allocate(std::size_t number_of_elements) {
+    // Check if the number of bytes fits in a 'std::size_t'.
+    if (number_of_elements > max_size())
+        throw std::bad_array_new_length();
+
+    return static_cast<T*>(m_pool->allocate(number_of_elements * sizeof(T), alignof(T))); // Allocate from the size class that fits.
+}
+
+// This method deallocates the allocated memory, allocated with the 'allocated' method. In this case must 'number_of_elements' be the same value as passed to the earlier called 'allocate' method.
+template<typename T>
+[[maybe_unused]] void size_class_allocator<T>::deallocate(T *allocated_memory, std::size_t number_of_elements) noexcept {
+    m_pool->deallocate(allocated_memory, number_of_elements * sizeof(T), alignof(T)); // The same size gives the same size class.
+}
+
+// This method returns the maximum size that you can allocate.
+template<typename T>
+[[maybe_unused]] std::size_t size_class_allocator<T>::max_size() const {
+    return std::numeric_limits<std::size_t>::max() / sizeof(T); // Calculate the amount of allocating memory.
+}
+
+// This method returns the pool this allocator refers to.
+template<typename T>
+const std::shared_ptr<size_class_pool> &size_class_allocator<T>::get_pool() const noexcept {
+    return m_pool;
+}
+
+/// This operator compares two 'size_class' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if both allocators refer to the same pool, so memory of the one can be deallocated by the other.
+template <typename T, typename U>
+bool operator==(const size_class_allocator<T>& first_allocator, const size_class_allocator<U>& second_allocator) { return first_allocator.get_pool() == second_allocator.get_pool(); }
+
+/// This operator compares two 'size_class' allocators.
+/// \tparam T The type of this specific class.
+/// \tparam U The type of this specific class.
+/// \return True if the allocators refer to different pools.
+template <typename T, typename U>
+bool operator!=(const size_class_allocator<T>& first_allocator, const size_class_allocator<U>& second_allocator) { return !(first_allocator == second_allocator); }
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef ALLOCATOR_SIZE_CLASS_POOL_H
+#define ALLOCATOR_SIZE_CLASS_POOL_H
+
+#include <array> // Include here all the 'array' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <memory> // Include here all the 'memory' facilities.
+#include <tuple> // Include here all the 'tuple' facilities.
+#include <utility> // Include here all the 'utility' facilities.
+
+#include "pool_allocator.h" // Include here all the 'pool_allocator' facilities.
+#include "mmap_allocator.h" // Include here all the 'mmap_allocator' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// A memory pool allocator can only hand out chunks of a single size. To serve requests of any size, a table of memory pools is used, one for every 'size class'.
+// A request is rounded up to the smallest size class that fits, and served by the memory pool of that class. Above the largest class, 'mmap_allocator' is used.
+// The large requests go through a 'mapping_cache' of this pool, so a big buffer that is freed and allocated again does not cost a system call every time.
+// Every chunk is aligned to the biggest power of two that divides its size class. An over-aligned request is rounded up to a multiple of its alignment, so that it lands in a size class that is aligned enough, and only an alignment above a page gets a mapping of its own.
+// The size classes are powers of two, with one class in between (for instance 64, 96, 128). So at most a third of a chunk is wasted.
+// Finding the size class of a request goes in O(1) time, with a small lookup table indexed by the size in steps of 8 bytes.
+// PAY ATTENTION! Just like 'pool_allocator', this class is not thread-safe. Every thread needs its own 'size_class_pool'.
+// ---- END EXTRA INFORMATION ---- //
+
+/// These are the sizes of all the size classes, in bytes.
+inline constexpr std::array<std::size_t, 17> size_class_sizes{8, 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 3072, 4096};
+
+/// This is the storage of a single request within a size class. It is aligned to the biggest power of two that divides the size, so a class of 64 bytes serves an alignment of 64 bytes.
+/// \tparam Size The size of the size class, in bytes.
+template <std::size_t Size>
+struct alignas(Size & (~Size + 1)) size_class_storage {
+    std::byte m_bytes[Size]; // The raw bytes of the request.
+};
+
+/// This is the class 'size_class_pool'. It serves requests of any size from a table of memory pools, one for every size class.
+class size_class_pool {
+public:
+    /// This is the constructor of the 'size_class_pool' class. The memory pools allocate their blocks on first use.
+    size_class_pool();
+
+    /// This method allocates memory for a request of any size.
+    /// \param number_of_bytes The number of bytes you want to allocate. This IS in bytes!
+    /// \param alignment The alignment of the memory. Up to the largest size class it is served by a memory pool, above a page by a mapping of its own.
+    /// \return The first address of the allocated memory.
+    [[nodiscard]] void* allocate(std::size_t number_of_bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /// This method deallocates memory, allocated with the 'allocate' method.
+    /// \param memory The address of the allocated memory.
+    /// \param number_of_bytes The number of bytes. It must be the same as just passed to the 'allocate' method.
+    /// \param alignment The alignment. It must be the same as just passed to the 'allocate' method.
+    void deallocate(void* memory, std::size_t number_of_bytes, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+    /// This method returns the pool that is used by default constructed allocators. It is never destroyed, so it can be used until the very end of the program.
+    /// \return A shared pointer to the default pool.
+    static const std::shared_ptr<size_class_pool>& default_pool();
+
+    /// This is the largest request that is served by a memory pool.
+    static constexpr std::size_t max_pooled_size = size_class_sizes.back();
+
+private:
+    /// This type is the tuple with a memory pool for every size class.
+    /// \tparam Indices The indices of the size classes.
+    template <std::size_t... Indices>
+    static auto make_pool_tuple_type(std::index_sequence<Indices...>) -> std::tuple<pool_allocator<size_class_storage<size_class_sizes[Indices]>>...>;
+
+    using pool_tuple = decltype(make_pool_tuple_type(std::make_index_sequence<size_class_sizes.size()>{})); // A tuple with a memory pool for every size class.
+
+    /// This is the number of bytes of the chunks within a single block of every memory pool.
+    static constexpr std::size_t bytes_per_block = 64 * 1024;
+
+    /// This method creates a memory pool for every size class.
+    /// \tparam Indices The indices of the size classes.
+    /// \return The tuple with all the memory pools.
+    template <std::size_t... Indices>
+    static pool_tuple make_pools(std::index_sequence<Indices...>);
+
+    /// This method creates a table with a function for every size class, that allocates a chunk from the memory pool of that class.
+    /// \tparam Indices The indices of the size classes.
+    /// \return The table with the functions.
+    template <std::size_t... Indices>
+    static constexpr std::array<void* (*)(pool_tuple&), sizeof...(Indices)> make_allocate_functions(std::index_sequence<Indices...>);
+
+    /// This method creates a table with a function for every size class, that deallocates a chunk to the memory pool of that class.
+    /// \tparam Indices The indices of the size classes.
+    /// \return The table with the functions.
+    template <std::size_t... Indices>
+    static constexpr std::array<void (*)(pool_tuple&, void*), sizeof...(Indices)> make_deallocate_functions(std::index_sequence<Indices...>);
+
+    /// This method rounds an over-aligned request up to a multiple of its alignment. The size class that fits it is then a multiple of the alignment as well, so its chunks are aligned enough.
+    /// \param number_of_bytes The number of bytes of the request.
+    /// \param alignment The alignment of the request. It must not be bigger than a page.
+    /// \return The number of bytes to look up the size class with. A request above the largest size class is not changed.
+    static std::size_t round_to_alignment(std::size_t number_of_bytes, std::size_t alignment) noexcept;
+
+    /// This method returns the index of the size class for a request.
+    /// \param number_of_bytes The number of bytes of the request. It must not be bigger than 'max_pooled_size'.
+    /// \param alignment The alignment of the request. Above 'std::max_align_t', the number of bytes must be a multiple of it.
+    /// \return The index of the size class.
+    static std::size_t find_size_class(std::size_t number_of_bytes, std::size_t alignment) noexcept;
+
+    pool_tuple m_pools; // This field contains a memory pool for every size class.
+    mapping_cache m_large_cache; // This field keeps the regions of the large requests that were deallocated.
+    mmap_allocator<std::byte> m_large_allocator; // This field is the allocator for the requests above the largest size class. It refers to the cache above.
+};
+
+#endif
@@ -0,0 +1,26 @@
+#ifndef ALLOCATOR_THREAD_SLOT_REGISTRY_H
+#define ALLOCATOR_THREAD_SLOT_REGISTRY_H
+
+#include <cstddef> // Include here all the 'cstddef' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Every thread that uses a concurrent allocator gets a small number, its 'slot'. An allocator can use this slot as an index in an array of per-thread caches.
+// This way, no thread ever has to look up its cache in a shared (and locked) map. When a thread exits, its slot is released and handed out to the next new thread.
+// The new thread then simply inherits the caches of the old thread, which is fine because these caches belong to the allocator and not to the thread.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This is the class 'thread_slot_registry'. It hands out a unique slot number to every living thread.
+class thread_slot_registry {
+public:
+    /// This is the maximum number of slots that can be handed out at the same time.
+    static constexpr std::size_t max_thread_slots = 256;
+
+    /// This value is returned when all slots are in use. Threads with this slot must bypass their per-thread caches.
+    static constexpr std::size_t no_thread_slot = max_thread_slots;
+
+    /// This method returns the slot of the calling thread. The first call within a thread acquires the slot.
+    /// \return The slot of the calling thread, or 'no_thread_slot' if all slots are taken.
+    static std::size_t current_slot() noexcept;
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef ALLOCATOR_TRACE_REPLAYER_H
+#define ALLOCATOR_TRACE_REPLAYER_H
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <cstddef> // Include here all the 'cstddef' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+#include "allocation_trace.h" // Include here all the 'allocation_trace' facilities.
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// Looking up the identifier of every deallocation in a hash map would cost more than many of the allocations that are replayed. So the replayer translates the trace once, when it is created.
+// Every allocation gets a slot in a plain vector, and a slot is used again as soon as its allocation is given back. Every deallocation knows its slot and the size of its allocation.
+// A trace of a real program is not always complete. A deallocation of an allocation from before the recording is skipped, an allocation that is never given back is given back at the end of the replay.
+// The calls are replayed in the order of the trace, on the calling thread. The allocators within this project are not thread-safe, so the threads of the trace are only counted.
+// Every allocation is written to once during a replay, just like a real program uses its memory. For the footprint, every allocation is written to completely, so that all its pages are resident.
+// The footprint compares the bytes that the trace has allocated at its peak, with the growth of the resident memory of the process at its peak. The rest is fragmentation, and the overhead of the allocator.
+// The resident memory is read every 'footprint_interval' calls, so a very short peak may be missed.
+// ---- END EXTRA INFORMATION ---- //
+
+/// This structure 'replay_footprint' contains the memory that a replay needed.
+struct replay_footprint {
+    std::size_t m_peak_live_bytes{0}; // The highest number of bytes that the trace had allocated at the same time.
+    std::size_t m_peak_resident_bytes{0}; // The highest growth of the resident memory of the process, during the replay.
+    double m_fragmentation{0.0}; // The part of the resident growth that was not allocated by the trace, from 0 up to 1.
+};
+
+/// This is the class 'trace_replayer'. It replays an allocation trace against any allocator of bytes, for instance the allocators and memory resources in this project.
+class trace_replayer {
+public:
+    /// This is the constructor of the 'trace_replayer' class. It translates the identifiers of the trace to slots.
+    /// \param trace The trace that is replayed. It is only read by this constructor.
+    explicit trace_replayer(const allocation_trace& trace);
+
+    /// This is the constructor of the 'trace_replayer' class, for records that are not within a file, for instance a generated pattern.
+    /// \param records The records that are replayed. They are only read by this constructor.
+    explicit trace_replayer(const std::vector<trace_record>& records);
+
+    /// This method replays all the calls of the trace, and gives back what the trace never gave back.
+    /// \tparam Allocator The type of the allocator. It must allocate bytes, with 'allocate(number_of_bytes)' and 'deallocate(memory, number_of_bytes)'.
+    /// \param allocator The allocator that the calls are replayed against.
+    template <typename Allocator>
+    void replay(Allocator& allocator) const;
+
+    /// This method replays all the calls of the trace, and measures the memory that the process needed for it.
+    /// \tparam Allocator The type of the allocator. It must allocate bytes, with 'allocate(number_of_bytes)' and 'deallocate(memory, number_of_bytes)'.
+    /// \param allocator The allocator that the calls are replayed against. It should be new, so that it holds no memory yet.
+    /// \return The peaks of the allocated bytes and of the resident memory.
+    template <typename Allocator>
+    [[nodiscard]] replay_footprint measure_footprint(Allocator& allocator) const;
+
+    /// This method returns the number of calls that are replayed, including the deallocations at the end.
+    /// \return The number of calls.
+    [[nodiscard]] std::size_t get_number_of_operations() const noexcept;
+
+    /// This method returns the number of different threads within the trace.
+    /// \return The number of threads.
+    [[nodiscard]] std::size_t get_number_of_threads() const noexcept;
+
+    /// This method returns the number of deallocations that are skipped, because their allocation is not within the trace.
+    /// \return The number of skipped deallocations.
+    [[nodiscard]] std::size_t get_number_of_skipped() const noexcept;
+
+private:
+    /// The number of calls between two readings of the resident memory, while measuring the footprint.
+    static constexpr std::size_t footprint_interval = 1024;
+
+    /// This structure 'replay_operation' is a single call of the translated trace.
+    struct replay_operation {
+        std::size_t m_size; // The number of bytes of the allocation.
+        std::uint32_t m_slot; // The slot that holds the address of the allocation.
+        bool m_is_allocation; // True for an allocation, false for a deallocation.
+    };
+
+    /// This is the constructor of the 'trace_replayer' class, that the other constructors delegate to. It translates the identifiers of the records to slots.
+    /// \param first_record The first record that is replayed.
+    /// \param last_record The end of the records that are replayed.
+    trace_replayer(const trace_record* first_record, const trace_record* last_record);
+
+    /// This method replays all the calls, and calls the observer after every call.
+    /// \tparam Allocator The type of the allocator.
+    /// \tparam Observer The type of the observer. It is called with the address and the call.
+    /// \param allocator The allocator that the calls are replayed against.
+    /// \param observer The observer, that for instance writes to the allocated memory.
+    template <typename Allocator, typename Observer>
+    void replay_operations(Allocator& allocator, Observer observer) const;
+
+    std::vector<replay_operation> m_operations; // This field contains all the calls, with the deallocations at the end.
+    std::size_t m_number_of_slots; // This field is the highest number of allocations at the same time.
+    std::size_t m_number_of_threads; // This field is the number of different threads within the trace.
+    std::size_t m_number_of_skipped; // This field is the number of deallocations that are skipped.
+};
+
+// This method replays all the calls of the trace, and gives back what the trace never gave back.
+template <typename Allocator>
+void trace_replayer::replay(Allocator& allocator) const {
+    replay_operations(allocator, [] (std::byte* memory, const replay_operation& single_operation) {
+        if (single_operation.m_is_allocation)
+            *memory = std::byte{0}; // Use the memory, like the program of the trace did.
+    });
+}
+
+// This method replays all the calls of the trace, and measures the memory that the process needed for it.
+template <typename Allocator>
+replay_footprint trace_replayer::measure_footprint(Allocator& allocator) const {
+    replay_footprint footprint{}; // The peaks of this replay.
+    auto baseline_bytes = memory_mapping::get_process_resident_bytes(); // The resident memory before the replay.
+    std::size_t live_bytes = 0; // The bytes that the trace has allocated right now.
+    std::size_t number_of_calls = 0; // The calls since the start of the replay.
+
+    replay_operations(allocator, [&] (std::byte* memory, const replay_operation& single_operation) {
+        if (single_operation.m_is_allocation) {
+            std::memset(memory, 0, single_operation.m_size); // Fault in all the pages of the allocation.
+            live_bytes += single_operation.m_size;
+        }
+        else {
+            live_bytes -= single_operation.m_size;
+        }
+
+        footprint.m_peak_live_bytes = std::max(footprint.m_peak_live_bytes, live_bytes);
+
+        // Reading the resident memory costs a system call, so it is only read now and then.
+        if (++number_of_calls % footprint_interval == 0) {
+            auto resident_bytes = memory_mapping::get_process_resident_bytes(); // The resident memory right now.
+            footprint.m_peak_resident_bytes = std::max(footprint.m_peak_resident_bytes, resident_bytes > baseline_bytes ? resident_bytes - baseline_bytes : 0);
+        }
+    });
+
+    // Less resident memory than allocated bytes means that the memory was resident already, for instance kept by 'malloc' from before.
+    if (footprint.m_peak_resident_bytes > footprint.m_peak_live_bytes)
+        footprint.m_fragmentation = 1.0 - static_cast<double>(footprint.m_peak_live_bytes) / static_cast<double>(footprint.m_peak_resident_bytes);
+
+    return footprint;
+}
+
+// This method replays all the calls, and calls the observer after every call.
+template <typename Allocator, typename Observer>
+void trace_replayer::replay_operations(Allocator& allocator, Observer observer) const {
+    static_assert(sizeof(typename Allocator::value_type) == 1, "A trace is replayed in bytes, so the allocator must allocate bytes.");
+
+    std::vector<std::byte*> slots(m_number_of_slots); // The address of the allocation of every slot.
+
+    for (const auto& single_operation : m_operations) {
+        if (single_operation.m_is_allocation) {
+            slots[single_operation.m_slot] = reinterpret_cast<std::byte*>(allocator.allocate(single_operation.m_size));
+            observer(slots[single_operation.m_slot], single_operation);
+        }
+        else {
+            observer(slots[single_operation.m_slot], single_operation);
+            allocator.deallocate(reinterpret_cast<typename Allocator::value_type*>(slots[single_operation.m_slot]), single_operation.m_size);
+        }
+    }
+}
+
+#endif
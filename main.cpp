@@ -7,15 +7,88 @@ int main() {
     allocator_tester::pool_validate_int(); // Validate the memory pool allocator with integers.
     allocator_tester::pool_validate_double(); // Validate the memory pool allocator with doubles.
     allocator_tester::pool_validate_compound(); // Validate the memory pool allocator with compound types.
+    allocator_tester::pool_validate_chunk_footprint(); // Validate the memory footprint of a single chunk.
+    allocator_tester::pool_validate_multi_block_deallocation(); // Validate deallocating chunks of multiple blocks.
+    allocator_tester::pool_validate_trim(); // Validate giving fully free blocks back to the operating system.
+    allocator_tester::pool_validate_huge_pages(); // Validate blocks on huge pages, also when no huge page is available.
+    allocator_tester::pool_validate_growth(); // Validate page-filled blocks, and blocks that grow.
+    allocator_tester::pool_validate_fill_modes(); // Validate linked, lazy and prefaulted blocks.
+    allocator_tester::pool_validate_alignment(); // Validate the alignment of pooled chunks and of the standard allocators.
+    allocator_tester::new_validate_raw_storage(); // Validate that the 'new' allocator does not construct anything itself.
+    allocator_tester::pool_validate_bulk(); // Validate allocating and deallocating batches of chunks.
+    allocator_tester::pool_validate_objects(); // Validate constructing and destroying objects within chunks.
+    allocator_tester::pool_validate_numa(); // Validate placing the blocks on the NUMA node of the allocating thread.
+    allocator_tester::pool_validate_guarded(); // Validate detecting double frees, writes after a free and overflows.
+    allocator_tester::size_class_validate_containers(); // Validate the size class allocator within STL-containers.
+    allocator_tester::pool_node_validate_containers(); // Validate the memory pool node adapter within node-based STL-containers.
+    allocator_tester::arena_validate_reset(); // Validate the monotonic arena, its alignment and its reset.
+    allocator_tester::mmap_validate_cache(); // Validate the 'mmap' allocator with a cache of mapped regions.
+    allocator_tester::growable_validate_reallocation(); // Validate growing memory in place, and the vector that uses it.
+    allocator_tester::pmr_validate_resources(); // Validate the polymorphic memory resources within STL-containers.
+    allocator_tester::concurrent_pool_validate_cross_thread(); // Validate the concurrent memory pool allocator with multiple threads.
+    allocator_tester::lock_free_stack_stress(); // Stress the lock-free free list with multiple threads.
+    allocator_tester::benchmark_validate_statistics(); // Validate the statistics and the calibration of the benchmark engine.
+    allocator_tester::benchmark_validate_histogram(); // Validate the histogram of the latencies of single calls.
+    allocator_tester::trace_validate_replay(); // Validate loading and replaying an allocation trace.
+    allocator_tester::pattern_validate_generator(); // Validate the generated allocation patterns.
+    allocator_tester::scalability_validate_sweep(); // Validate the sweep over the numbers of threads.
 
     // --- BENCHMARK SECTION --- //
     std::vector<benchmark_statistics> all_statistics{}; // This vector contains your statistics of the benchmark.
-    allocator_benchmark benchmarker{{32, 64, 128, 256, 512}, {10, 100, 1000}}; // The first list are the amount of memory elements, the second list are the number of runs.
+    benchmark_options measurement_options{}; // The options of the engine that measures the allocators.
+    measurement_options.m_use_cycle_counter = true; // Read the time stamp counter where the processor has one, so that timing a single call costs little.
+    measurement_options.m_record_latencies = true; // Also time every single call, to show the tail latencies.
+
+    allocator_benchmark benchmarker{{32, 64, 128, 256, 512}, {10, 100, 1000}, 4, measurement_options}; // The first list are the amount of memory elements, the second list are the number of runs.
 
     all_statistics.push_back(benchmarker.benchmark_memory_pool()); // Benchmark the memory pool allocator.
     all_statistics.push_back(benchmarker.benchmark_memory_malloc()); // Benchmark the 'malloc' allocator.
     all_statistics.push_back(benchmarker.benchmark_memory_mmap()); // Benchmark the 'mmap' allocator.
+    all_statistics.push_back(benchmarker.benchmark_memory_mmap_cached()); // Benchmark the 'mmap' allocator with a cache of mapped regions.
     all_statistics.push_back(benchmarker.benchmark_memory_new()); // Benchmark the 'new' allocator.
+    all_statistics.push_back(benchmarker.benchmark_memory_size_class()); // Benchmark the size class allocator.
+    all_statistics.push_back(benchmarker.benchmark_memory_arena()); // Benchmark the monotonic arena allocator.
+    all_statistics.push_back(benchmarker.benchmark_pmr_pool()); // Benchmark the polymorphic memory resource with memory pools.
+    all_statistics.push_back(benchmarker.benchmark_pmr_std_pool()); // Benchmark the pool resource of the standard library.
+    all_statistics.push_back(benchmarker.benchmark_pmr_arena()); // Benchmark the polymorphic memory resource with a monotonic arena.
+    all_statistics.push_back(benchmarker.benchmark_pmr_std_monotonic()); // Benchmark the monotonic resource of the standard library.
+    all_statistics.push_back(benchmarker.benchmark_traversal_normal_pages()); // Benchmark a random traversal over pooled objects on normal pages.
+    all_statistics.push_back(benchmarker.benchmark_traversal_huge_pages()); // Benchmark a random traversal over pooled objects on huge pages.
+    all_statistics.push_back(benchmarker.benchmark_growth_fixed()); // Benchmark a growing memory pool allocator with blocks of the same size.
+    all_statistics.push_back(benchmarker.benchmark_growth_geometric()); // Benchmark a growing memory pool allocator with blocks that double.
+    all_statistics.push_back(benchmarker.benchmark_fill_linked()); // Benchmark the latency of allocations, with new blocks that are linked at once.
+    all_statistics.push_back(benchmarker.benchmark_fill_lazy()); // Benchmark the latency of allocations, with new blocks that are carved lazily.
+    all_statistics.push_back(benchmarker.benchmark_fill_prefaulted()); // Benchmark the latency of allocations, with new blocks that are prefaulted.
+    all_statistics.push_back(benchmarker.benchmark_batch_loop()); // Benchmark batches of chunks, one chunk at a time.
+    all_statistics.push_back(benchmarker.benchmark_batch_bulk()); // Benchmark batches of chunks, a whole batch at once.
+    all_statistics.push_back(benchmarker.benchmark_map_std_allocator()); // Benchmark an 'std::map' with the standard allocator.
+    all_statistics.push_back(benchmarker.benchmark_map_pool_node()); // Benchmark an 'std::map' with the memory pool node adapter.
+    all_statistics.push_back(benchmarker.benchmark_memory_pool_mutex()); // Benchmark the memory pool allocator on multiple threads, with a mutex.
+    all_statistics.push_back(benchmarker.benchmark_memory_pool_lock_free()); // Benchmark the concurrent memory pool allocator on multiple threads, lock-free.
+    all_statistics.push_back(benchmarker.benchmark_counters_packed()); // Benchmark counters of multiple threads that share a cache line.
+    all_statistics.push_back(benchmarker.benchmark_counters_aligned()); // Benchmark counters of multiple threads, every counter on a cache line of its own.
+    all_statistics.push_back(benchmarker.benchmark_buffer_vector()); // Benchmark a growing buffer in an 'std::vector', that copies its elements.
+    all_statistics.push_back(benchmarker.benchmark_buffer_growable()); // Benchmark a growing buffer in a 'growable_vector', that grows in place.
+    all_statistics.push_back(benchmarker.benchmark_objects_new_array()); // Benchmark strings in memory of 'new[]', that are constructed twice.
+    all_statistics.push_back(benchmarker.benchmark_objects_new_raw()); // Benchmark strings in raw memory of the 'new' allocator, that are constructed once.
+    all_statistics.push_back(benchmarker.benchmark_debug_none()); // Benchmark the memory pool allocator without any checks.
+    all_statistics.push_back(benchmarker.benchmark_debug_guarded()); // Benchmark the guarded memory pool allocator.
+    all_statistics.push_back(benchmarker.benchmark_debug_guard_pages()); // Benchmark the guarded memory pool allocator with guard pages.
+    all_statistics.push_back(benchmarker.benchmark_trace_malloc()); // Replay an allocation trace against 'malloc'.
+    all_statistics.push_back(benchmarker.benchmark_trace_new()); // Replay an allocation trace against 'new'.
+    all_statistics.push_back(benchmarker.benchmark_trace_pool()); // Replay an allocation trace against the memory pools.
+    all_statistics.push_back(benchmarker.benchmark_trace_arena()); // Replay an allocation trace against the monotonic arena.
+    all_statistics.push_back(benchmarker.benchmark_trace_std_pool()); // Replay an allocation trace against the pool resource of the standard library.
+    all_statistics.push_back(benchmarker.benchmark_pattern_pool()); // Replay the generated allocation patterns against the memory pool allocator.
+    all_statistics.push_back(benchmarker.benchmark_pattern_malloc()); // Replay the generated allocation patterns against 'malloc'.
+    all_statistics.push_back(benchmarker.benchmark_pattern_new()); // Replay the generated allocation patterns against 'new'.
+    all_statistics.push_back(benchmarker.benchmark_pattern_size_class()); // Replay the generated allocation patterns against the size class allocator.
+    all_statistics.push_back(benchmarker.benchmark_pattern_std_pool()); // Replay the generated allocation patterns against the pool resource of the standard library.
+    all_statistics.push_back(benchmarker.benchmark_scalability_pool_mutex()); // Sweep the memory pool allocator behind a mutex over the numbers of threads.
+    all_statistics.push_back(benchmarker.benchmark_scalability_pool_magazines()); // Sweep the concurrent memory pool allocator with magazines over the numbers of threads.
+    all_statistics.push_back(benchmarker.benchmark_scalability_pool_lock_free()); // Sweep the lock-free concurrent memory pool allocator over the numbers of threads.
+    all_statistics.push_back(benchmarker.benchmark_scalability_malloc()); // Sweep 'malloc' over the numbers of threads.
+    all_statistics.push_back(benchmarker.benchmark_scalability_new()); // Sweep 'new' over the numbers of threads.
 
     benchmark_plot_generator plotter{all_statistics}; // Create a plotter with the statistics.
     plotter.generate_matlab_plot(); // Generate a MATLAB-script with the plot.
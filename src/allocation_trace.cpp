@@ -0,0 +1,82 @@
+#include "allocation_trace.h"
+
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <fstream> // Include here all the 'fstream' facilities.
+#include <stdexcept> // Include here all the 'stdexcept' facilities.
+#include <fcntl.h> // Include here all the 'fcntl' facilities.
+#include <sys/mman.h> // Include here all the 'sys/mman' facilities.
+#include <sys/stat.h> // Include here all the 'sys/stat' facilities.
+#include <unistd.h> // Include here all the 'unistd' facilities.
+
+// This is the constructor of the 'allocation_trace' class. It maps the trace file, and checks its header.
+allocation_trace::allocation_trace(const std::string &trace_path) :
+    m_mapped_file{nullptr},
+    m_file_size{0},
+    m_number_of_records{0}
+{
+    auto trace_file = open(trace_path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (trace_file < 0)
+        throw std::runtime_error{"Opening the trace file '" + trace_path + "' failed!"};
+
+    struct stat file_status{}; // The status of the file, for its size.
+
+    if (fstat(trace_file, &file_status) != 0 || static_cast<std::size_t>(file_status.st_size) < sizeof(trace_header)) {
+        close(trace_file);
+        throw std::runtime_error{"The trace file '" + trace_path + "' has no header!"};
+    }
+
+    m_file_size = static_cast<std::size_t>(file_status.st_size);
+    m_mapped_file = mmap(nullptr, m_file_size, PROT_READ, MAP_PRIVATE, trace_file, 0);
+    close(trace_file); // The mapping keeps the file open.
+
+    if (m_mapped_file == MAP_FAILED)
+        throw std::runtime_error{"Mapping the trace file '" + trace_path + "' failed!"};
+
+    madvise(m_mapped_file, m_file_size, MADV_SEQUENTIAL); // The records are read from the front to the back, so read ahead.
+
+    // Only a header of this version can be read.
+    trace_header expected_header{}; // The header that this version writes.
+    trace_header file_header{}; // The header of the file.
+    std::memcpy(&file_header, m_mapped_file, sizeof(trace_header));
+
+    if (std::memcmp(&file_header, &expected_header, sizeof(trace_header)) != 0) {
+        munmap(m_mapped_file, m_file_size);
+        throw std::runtime_error{"The file '" + trace_path + "' is no trace of this version!"};
+    }
+
+    m_number_of_records = (m_file_size - sizeof(trace_header)) / sizeof(trace_record); // A last record that is cut off is ignored.
+}
+
+// This is the destructor of the 'allocation_trace' class. It unmaps the trace file.
+allocation_trace::~allocation_trace() {
+    munmap(m_mapped_file, m_file_size);
+}
+
+// This method returns the first record of the trace.
+const trace_record *allocation_trace::begin() const noexcept {
+    // The header is 16 bytes, and the mapping is aligned to a page, so the records are aligned as well.
+    return reinterpret_cast<const trace_record*>(static_cast<const std::byte*>(m_mapped_file) + sizeof(trace_header));
+}
+
+// This method returns the end of the records of the trace.
+const trace_record *allocation_trace::end() const noexcept {
+    return begin() + m_number_of_records;
+}
+
+// This method returns the number of complete records of the trace.
+std::size_t allocation_trace::size() const noexcept {
+    return m_number_of_records;
+}
+
+// This static method writes a trace file, for instance a trace that is generated instead of recorded.
+void allocation_trace::write(const std::string &trace_path, const std::vector<trace_record> &records) {
+    std::ofstream trace_file{trace_path, std::ios::binary | std::ios::trunc};
+    trace_header file_header{}; // The header of this version.
+
+    trace_file.write(reinterpret_cast<const char*>(&file_header), sizeof(trace_header));
+    trace_file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(trace_record)));
+
+    if (!trace_file)
+        throw std::runtime_error{"Writing the trace file '" + trace_path + "' failed!"};
+}
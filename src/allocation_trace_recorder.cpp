@@ -0,0 +1,264 @@
+#include "allocation_trace.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <atomic> // Include here all the 'atomic' facilities.
+#include <cstdlib> // Include here all the 'cstdlib' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <ctime> // Include here all the 'ctime' facilities.
+#include <dlfcn.h> // Include here all the 'dlfcn' facilities.
+#include <fcntl.h> // Include here all the 'fcntl' facilities.
+#include <malloc.h> // Include here all the 'malloc' facilities.
+#include <sys/syscall.h> // Include here all the 'sys/syscall' facilities.
+#include <unistd.h> // Include here all the 'unistd' facilities.
+
+// ---- EXTRA INFORMATION ---- //
+// This file is not part of the benchmark. It is built as a library of its own, that records the allocations of any program:
+//     LD_PRELOAD=./libALLOCATION_TRACE_RECORDER.so ALLOCATION_TRACE_FILE=service.trace ./service
+// The library defines 'malloc', 'calloc', 'realloc', 'free', 'aligned_alloc' and 'posix_memalign'. The dynamic linker finds them before the ones of the C library, so every call of the program comes here first.
+// Every call is passed on to the C library, found with 'dlsym(RTLD_NEXT)', and then recorded. 'new' and 'delete' call 'malloc' and 'free', so they are recorded as well.
+// Recording may not allocate anything itself, otherwise it would record itself. So the records are collected in a static buffer, that is written to the file with 'write' when it is full, and when the program ends.
+// 'dlsym' itself may call 'calloc', before the real 'calloc' is known. Those few bytes come from a small static buffer, and are never given back.
+// A 'realloc' is recorded as the deallocation of the old address, before the C library can hand it out to another thread, and the allocation of the new size afterwards. A failed 'realloc' records the old address once more, with its usable size. The content is not part of the trace.
+// The buffer is shared by all the threads, behind a spin lock. Recording therefore slows down a program with many threads. A deallocation is recorded before the address is given back, and an allocation after the address is handed out, so an address is always recorded by the thread that owns it, and no other thread can record it in between.
+// PAY ATTENTION! A child after 'fork' shares the file with its parent, so its records are mixed with the ones of the parent. Record such a program with a single process only.
+// ---- END EXTRA INFORMATION ---- //
+
+namespace {
+    using malloc_function = void* (*)(std::size_t); // The type of the real 'malloc'.
+    using calloc_function = void* (*)(std::size_t, std::size_t); // The type of the real 'calloc'.
+    using realloc_function = void* (*)(void*, std::size_t); // The type of the real 'realloc'.
+    using free_function = void (*)(void*); // The type of the real 'free'.
+    using aligned_alloc_function = void* (*)(std::size_t, std::size_t); // The type of the real 'aligned_alloc'.
+    using posix_memalign_function = int (*)(void**, std::size_t, std::size_t); // The type of the real 'posix_memalign'.
+
+    constexpr std::size_t buffered_records = 4096; // The number of records that are collected before they are written to the file.
+    constexpr std::size_t bootstrap_size = 4096; // The number of bytes for 'dlsym', before the real 'calloc' is known.
+
+    malloc_function real_malloc = nullptr; // The 'malloc' of the C library.
+    calloc_function real_calloc = nullptr; // The 'calloc' of the C library.
+    realloc_function real_realloc = nullptr; // The 'realloc' of the C library.
+    free_function real_free = nullptr; // The 'free' of the C library.
+    aligned_alloc_function real_aligned_alloc = nullptr; // The 'aligned_alloc' of the C library.
+    posix_memalign_function real_posix_memalign = nullptr; // The 'posix_memalign' of the C library.
+
+    alignas(alignof(std::max_align_t)) unsigned char bootstrap_buffer[bootstrap_size]; // The memory that is handed out while the real functions are looked up.
+    std::size_t bootstrap_position = 0; // The first free byte of the bootstrap buffer.
+    bool is_resolving = false; // True while the real functions are looked up.
+
+    trace_record record_buffer[buffered_records]; // The records that are not written yet.
+    std::size_t number_of_buffered = 0; // The number of records within the buffer.
+    std::atomic_flag buffer_lock = ATOMIC_FLAG_INIT; // The spin lock of the buffer.
+    int trace_file = -1; // The file the records are written to, or -1 when nothing is recorded.
+    std::uint64_t start_time = 0; // The time the recording started, in nanoseconds.
+
+    // The thread-local fields use the static block of the thread, so that reaching them never allocates.
+    __attribute__((tls_model("initial-exec"))) thread_local bool is_recording = false; // True while this thread records, so that the recorder does not record itself.
+    __attribute__((tls_model("initial-exec"))) thread_local std::uint32_t thread_identifier = 0; // The identifier of this thread, it is looked up on its first record.
+
+    // This function reads the monotonic clock in nanoseconds.
+    std::uint64_t read_clock() noexcept {
+        timespec current_time{}; // The current time.
+        clock_gettime(CLOCK_MONOTONIC, &current_time);
+
+        return static_cast<std::uint64_t>(current_time.tv_sec) * 1'000'000'000 + static_cast<std::uint64_t>(current_time.tv_nsec);
+    }
+
+    // This function looks up the real functions of the C library.
+    void resolve_functions() noexcept {
+        if (real_malloc != nullptr || is_resolving)
+            return;
+
+        is_resolving = true;
+        real_calloc = reinterpret_cast<calloc_function>(dlsym(RTLD_NEXT, "calloc"));
+        real_malloc = reinterpret_cast<malloc_function>(dlsym(RTLD_NEXT, "malloc"));
+        real_realloc = reinterpret_cast<realloc_function>(dlsym(RTLD_NEXT, "realloc"));
+        real_free = reinterpret_cast<free_function>(dlsym(RTLD_NEXT, "free"));
+        real_aligned_alloc = reinterpret_cast<aligned_alloc_function>(dlsym(RTLD_NEXT, "aligned_alloc"));
+        real_posix_memalign = reinterpret_cast<posix_memalign_function>(dlsym(RTLD_NEXT, "posix_memalign"));
+        is_resolving = false;
+    }
+
+    // This function hands out memory of the bootstrap buffer, while the real functions are looked up.
+    void* allocate_bootstrap(std::size_t number_of_bytes) noexcept {
+        auto aligned_size = (number_of_bytes + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1); // Keep the next request aligned.
+
+        if (bootstrap_size - bootstrap_position < aligned_size)
+            return nullptr;
+
+        auto* bootstrap_memory = bootstrap_buffer + bootstrap_position; // The memory of this request, it is already zero.
+        bootstrap_position += aligned_size;
+
+        return bootstrap_memory;
+    }
+
+    // This function tells if memory comes from the bootstrap buffer.
+    bool is_bootstrap(const void* memory) noexcept {
+        auto* byte_memory = static_cast<const unsigned char*>(memory); // The address as bytes.
+        return byte_memory >= bootstrap_buffer && byte_memory < bootstrap_buffer + bootstrap_size;
+    }
+
+    // This function writes all the buffered records to the file. The lock must be held.
+    void flush_records() noexcept {
+        auto* remaining_bytes = reinterpret_cast<const char*>(record_buffer); // The bytes that are not written yet.
+        auto number_of_remaining = number_of_buffered * sizeof(trace_record); // The number of bytes that are not written yet.
+
+        while (number_of_remaining > 0) {
+            auto number_of_written = write(trace_file, remaining_bytes, number_of_remaining);
+
+            // A full disk stops the recording, but not the program.
+            if (number_of_written <= 0)
+                break;
+
+            remaining_bytes += number_of_written;
+            number_of_remaining -= static_cast<std::size_t>(number_of_written);
+        }
+
+        number_of_buffered = 0;
+    }
+
+    // This function records a single call.
+    void record_call(trace_operation operation, const void* memory, std::size_t number_of_bytes) noexcept {
+        if (trace_file < 0 || is_recording || memory == nullptr)
+            return;
+
+        is_recording = true;
+
+        if (thread_identifier == 0)
+            thread_identifier = static_cast<std::uint32_t>(syscall(SYS_gettid));
+
+        trace_record new_record{read_clock() - start_time, reinterpret_cast<std::uintptr_t>(memory), number_of_bytes, thread_identifier, operation, {}}; // The record of this call.
+
+        while (buffer_lock.test_and_set(std::memory_order_acquire)); // Wait until no other thread uses the buffer.
+
+        record_buffer[number_of_buffered++] = new_record;
+
+        if (number_of_buffered == buffered_records)
+            flush_records();
+
+        buffer_lock.clear(std::memory_order_release);
+        is_recording = false;
+    }
+
+    // This function starts the recording, when the library is loaded. The records go to the file of 'ALLOCATION_TRACE_FILE', or to 'allocation.trace'.
+    __attribute__((constructor)) void start_recording() noexcept {
+        resolve_functions();
+
+        const char* trace_path = std::getenv("ALLOCATION_TRACE_FILE"); // The path of the trace file.
+        auto new_file = open(trace_path != nullptr ? trace_path : "allocation.trace", O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+        if (new_file < 0)
+            return;
+
+        trace_header file_header{}; // The header of the trace file.
+
+        if (write(new_file, &file_header, sizeof(trace_header)) != static_cast<ssize_t>(sizeof(trace_header))) {
+            close(new_file);
+            return;
+        }
+
+        start_time = read_clock();
+        trace_file = new_file; // From now on, every call is recorded.
+    }
+
+    // This function stops the recording, when the program ends. The last records are written to the file.
+    __attribute__((destructor)) void stop_recording() noexcept {
+        if (trace_file < 0)
+            return;
+
+        while (buffer_lock.test_and_set(std::memory_order_acquire));
+
+        flush_records();
+        close(trace_file);
+        trace_file = -1; // The calls of the last destructors are not recorded anymore.
+
+        buffer_lock.clear(std::memory_order_release);
+    }
+}
+
+// This function replaces 'malloc'. It allocates with the C library, and records the allocation.
+extern "C" void* malloc(std::size_t number_of_bytes) noexcept {
+    resolve_functions();
+
+    if (real_malloc == nullptr)
+        return allocate_bootstrap(number_of_bytes);
+
+    auto* allocated_memory = real_malloc(number_of_bytes);
+    record_call(trace_operation::allocate, allocated_memory, number_of_bytes);
+
+    return allocated_memory;
+}
+
+// This function replaces 'calloc'. It allocates with the C library, and records the allocation.
+extern "C" void* calloc(std::size_t number_of_elements, std::size_t element_size) noexcept {
+    resolve_functions();
+
+    // 'dlsym' may call 'calloc' itself, before the real one is known.
+    if (real_calloc == nullptr)
+        return number_of_elements != 0 && element_size > bootstrap_size / number_of_elements ? nullptr : allocate_bootstrap(number_of_elements * element_size);
+
+    auto* allocated_memory = real_calloc(number_of_elements, element_size);
+    record_call(trace_operation::allocate, allocated_memory, number_of_elements * element_size);
+
+    return allocated_memory;
+}
+
+// This function replaces 'realloc'. It resizes with the C library, and records the old deallocation and the new allocation.
+extern "C" void* realloc(void* memory, std::size_t number_of_bytes) noexcept {
+    resolve_functions();
+
+    // Memory of the bootstrap buffer is copied to memory of the C library. Its old size is not known, so copy what can be copied.
+    if (is_bootstrap(memory)) {
+        auto* new_memory = malloc(number_of_bytes);
+
+        if (new_memory != nullptr)
+            std::memcpy(new_memory, memory, std::min(number_of_bytes, static_cast<std::size_t>(bootstrap_buffer + bootstrap_size - static_cast<unsigned char*>(memory))));
+
+        return new_memory;
+    }
+
+    record_call(trace_operation::deallocate, memory, 0); // Record it before the address can be handed out again, just like 'free'.
+    auto* new_memory = real_realloc(memory, number_of_bytes);
+
+    // A failed 'realloc' keeps the old allocation. Its old size is not known anymore, so record its usable size.
+    if (new_memory == nullptr && number_of_bytes != 0) {
+        record_call(trace_operation::allocate, memory, malloc_usable_size(memory));
+        return nullptr;
+    }
+
+    record_call(trace_operation::allocate, new_memory, number_of_bytes);
+
+    return new_memory;
+}
+
+// This function replaces 'free'. It records the deallocation, and deallocates with the C library.
+extern "C" void free(void* memory) noexcept {
+    if (memory == nullptr || is_bootstrap(memory))
+        return;
+
+    resolve_functions();
+
+    record_call(trace_operation::deallocate, memory, 0); // Record it before the address can be handed out again.
+    real_free(memory);
+}
+
+// This function replaces 'aligned_alloc'. It allocates with the C library, and records the allocation.
+extern "C" void* aligned_alloc(std::size_t alignment, std::size_t number_of_bytes) noexcept {
+    resolve_functions();
+
+    auto* allocated_memory = real_aligned_alloc(alignment, number_of_bytes);
+    record_call(trace_operation::allocate, allocated_memory, number_of_bytes);
+
+    return allocated_memory;
+}
+
+// This function replaces 'posix_memalign'. It allocates with the C library, and records the allocation.
+extern "C" int posix_memalign(void** memory, std::size_t alignment, std::size_t number_of_bytes) noexcept {
+    resolve_functions();
+
+    auto result = real_posix_memalign(memory, alignment, number_of_bytes);
+
+    if (result == 0)
+        record_call(trace_operation::allocate, *memory, number_of_bytes);
+
+    return result;
+}
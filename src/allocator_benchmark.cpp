@@ -1,45 +1,79 @@
 #include "allocator_benchmark.h"
 
+#include <cstdlib> // Include here all the 'cstdlib' facilities.
+#include <filesystem> // Include here all the 'filesystem' facilities.
+#include <pthread.h> // Include here all the 'pthread' facilities.
+
 // This is the constructor of the 'allocator_benchmark' class.
-allocator_benchmark::allocator_benchmark(const std::initializer_list<std::size_t> &elements_list, const std::initializer_list<std::size_t> &run_list) :
+allocator_benchmark::allocator_benchmark(const std::initializer_list<std::size_t> &elements_list, const std::initializer_list<std::size_t> &run_list, const std::size_t& number_of_threads, const benchmark_options& options) :
     m_number_of_runs{run_list},
-    m_number_of_elements{elements_list}
+    m_number_of_elements{elements_list},
+    m_number_of_threads{number_of_threads},
+    m_engine{options}
 {}
 
+// This method adds the summary of the samples of a single run to the statistic, and shows it. The median is the result, in microseconds.
+void allocator_benchmark::add_summary(benchmark_statistics &statistic, const std::string &result_name, std::size_t single_run, const benchmark_summary &summary) {
+    auto median_duration = summary.m_median / 1000.0; // The plots show microseconds.
+    statistic.add_result(std::make_tuple(result_name, single_run, median_duration)); // Create a new statistic for your run.
+
+    std::cout << "Elapsed time for your specified runs, is: " << median_duration << " microseconds (median)" << std::endl;
+    std::cout << "Samples: " << summary.m_number_of_samples << " x " << summary.m_iterations_per_sample << " iterations, in nanoseconds: min " << summary.m_minimum << ", median " << summary.m_median
+              << ", p90 " << summary.m_p90 << ", p99 " << summary.m_p99 << ", stddev " << summary.m_standard_deviation << ", 95% CI of the mean [" << summary.m_confidence_low << ", " << summary.m_confidence_high << "]" << std::endl;
+}
+
+// This method shows the percentiles of the latencies of single calls, if any latencies are recorded.
+void allocator_benchmark::print_latencies(const benchmark_statistics &statistic) {
+    // Show both operations the same way, the tail is what matters.
+    for (auto operation : {benchmark_statistics::latency_operation::allocate, benchmark_statistics::latency_operation::deallocate}) {
+        const auto& latencies = statistic.get_latencies(operation); // The histogram of this operation.
+
+        if (latencies.get_count() == 0)
+            continue;
+
+        std::cout << "Latency of a single " << (operation == benchmark_statistics::latency_operation::allocate ? "allocate" : "deallocate") << " (" << latencies.get_count() << " calls), in nanoseconds: p50 " << latencies.get_percentile(0.5)
+                  << ", p99 " << latencies.get_percentile(0.99) << ", p99.9 " << latencies.get_percentile(0.999) << ", p99.99 " << latencies.get_percentile(0.9999) << ", max " << latencies.get_maximum() << std::endl;
+    }
+}
+
 // This method benchmarks the memory pool allocator.
 benchmark_statistics allocator_benchmark::benchmark_memory_pool() const {
     std::cout << "---- BENCHMARK MEMORY POOL ----" << std::endl;
 
     benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_pool}; // A statistic for the memory pool allocator.
+    std::deque<pool_allocator<int>> memory_pools{}; // A memory pool allocator for every memory size, created before anything is measured and reused by all the iterations.
+
+    for (const auto& memory_size : m_number_of_elements)
+        memory_pools.emplace_back(memory_size);
 
     // Go through the list of all your specified runs.
     for (const auto& single_run : m_number_of_runs) {
-        std::vector<long> sum_durations{}; // A vector with the durations of each run.
+        std::vector<chunk<int>*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
 
-        // Go through all the memory sizes for a single specified run.
-        for (const auto& memory_size : m_number_of_elements) {
-            std::vector<chunk<int>*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
-            pool_allocator<int> memory_pool{memory_size}; // This is our memory pool allocator.
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (auto& memory_pool : memory_pools) {
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
 
-            auto begin_time = std::chrono::high_resolution_clock::now(); // The start time.
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
 
-            for (auto& get_memory_addresses : assigned_addresses)
-                get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
-
-            for (auto& free_memory_addresses : assigned_addresses)
-                memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+        add_summary(new_statistic, "pool_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
 
-            auto end_time = std::chrono::high_resolution_clock::now(); // The end time.
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                pool_allocator<int> memory_pool{memory_size}; // A new memory pool allocator, so that mapping its blocks is part of the latencies.
 
-            sum_durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end_time - begin_time).count()); // Calculate the duration of a single test.
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_pool.allocate(); }, [&] (std::size_t i) { memory_pool.deallocate(assigned_addresses[i]); });
+            }
         }
-
-        auto average_duration = (double)std::accumulate(sum_durations.begin(), sum_durations.end(), average_running_time{}); // Here, you are calculating the average running time of a singel run.
-        new_statistic.add_result(std::make_tuple("pool_" + std::to_string(single_run), single_run, average_duration)); // Create a new statistic for your run.
-
-        std::cout << "Elapsed time for your specified runs, is: " << average_duration << " microseconds" << std::endl;
     }
 
+    print_latencies(new_statistic);
     std::cout << "---- END BENCHMARK MEMORY POOL ----" << std::endl;
 
     return new_statistic; // Return the statistics.
@@ -53,32 +87,34 @@ benchmark_statistics allocator_benchmark::benchmark_memory_malloc() const {
 
     // Go through the list of all your specified runs.
     for (const auto& single_run : m_number_of_runs) {
-        std::vector<long> sum_durations{}; // A vector with the durations of each run.
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
 
-        // Go through all the memory sizes for a single specified run.
-        for (const auto& memory_size : m_number_of_elements) {
-            std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
-            malloc_allocator<int> memory_malloc{}; // This is our 'malloc' allocator.
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (const auto& memory_size : m_number_of_elements) {
+                malloc_allocator<int> memory_malloc{}; // This is our 'malloc' allocator.
 
-            auto begin_time = std::chrono::high_resolution_clock::now(); // The start time.
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_malloc.allocate(memory_size); // Allocate memory, get addresses.
 
-            for (auto& get_memory_addresses : assigned_addresses)
-                get_memory_addresses = memory_malloc.allocate(memory_size); // Allocate memory, get addresses.
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_malloc.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
 
-            for (auto& free_memory_addresses : assigned_addresses)
-                memory_malloc.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+        add_summary(new_statistic, "malloc_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
 
-            auto end_time = std::chrono::high_resolution_clock::now(); // The end time.
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                malloc_allocator<int> memory_malloc{}; // This is our 'malloc' allocator.
 
-            sum_durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end_time - begin_time).count()); // Calculate the duration of a single test.
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_malloc.allocate(memory_size); }, [&] (std::size_t i) { memory_malloc.deallocate(assigned_addresses[i], memory_size); });
+            }
         }
-
-        auto average_duration = (double)std::accumulate(sum_durations.begin(), sum_durations.end(), average_running_time{}); // Here, you are calculating the average running time of a singel run.
-        new_statistic.add_result(std::make_tuple("malloc_" + std::to_string(single_run), single_run, average_duration)); // Create a new statistic for your run.
-
-        std::cout << "Elapsed time for your specified runs, is: " << average_duration << " microseconds" << std::endl;
     }
 
+    print_latencies(new_statistic);
     std::cout << "---- END BENCHMARK MEMORY MALLOC ----" << std::endl;
 
     return new_statistic; // Return the statistics.
@@ -92,33 +128,78 @@ benchmark_statistics allocator_benchmark::benchmark_memory_mmap() const {
 
     // Go through the list of all your specified runs.
     for (const auto& single_run : m_number_of_runs) {
-        std::vector<long> sum_durations{}; // A vector with the durations of each run.
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
 
-        // Go through all the memory sizes for a single specified run.
-        for (const auto& memory_size : m_number_of_elements) {
-            std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
-            mmap_allocator<int> memory_mmap{}; // This is our 'mmap' allocator.
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (const auto& memory_size : m_number_of_elements) {
+                mmap_allocator<int> memory_mmap{}; // This is our 'mmap' allocator.
 
-            auto begin_time = std::chrono::high_resolution_clock::now(); // The start time.
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_mmap.allocate(memory_size); // Allocate memory, get addresses.
 
-            for (auto& get_memory_addresses : assigned_addresses)
-                get_memory_addresses = memory_mmap.allocate(memory_size); // Allocate memory, get addresses.
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_mmap.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
 
-            for (auto& free_memory_addresses : assigned_addresses)
-                memory_mmap.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+        add_summary(new_statistic, "malloc_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
 
-            auto end_time = std::chrono::high_resolution_clock::now(); // The end time.
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                mmap_allocator<int> memory_mmap{}; // This is our 'mmap' allocator.
 
-            sum_durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end_time - begin_time).count()); // Calculate the duration of a single test.
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_mmap.allocate(memory_size); }, [&] (std::size_t i) { memory_mmap.deallocate(assigned_addresses[i], memory_size); });
+            }
         }
+    }
+
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK MEMORY MMAP ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the 'mmap' allocator with a cache of mapped regions. It allocates the same sizes as the 'mmap' benchmark.
+benchmark_statistics allocator_benchmark::benchmark_memory_mmap_cached() const {
+    std::cout << "---- BENCHMARK MEMORY MMAP CACHED ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_mmap_cached}; // A statistic for the 'mmap' allocator with a cache.
+    mapping_cache cache{}; // The cache is shared by all the runs, so only the first run has to map its regions.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
+
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (const auto& memory_size : m_number_of_elements) {
+                mmap_allocator<int> memory_mmap{cache}; // This is our 'mmap' allocator, that refers to the cache.
+
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_mmap.allocate(memory_size); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_mmap.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
 
-        auto average_duration = (double)std::accumulate(sum_durations.begin(), sum_durations.end(), average_running_time{}); // Here, you are calculating the average running time of a singel run.
-        new_statistic.add_result(std::make_tuple("malloc_" + std::to_string(single_run), single_run, average_duration)); // Create a new statistic for your run.
+        add_summary(new_statistic, "mmap_cached_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
 
-        std::cout << "Elapsed time for your specified runs, is: " << average_duration << " microseconds" << std::endl;
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                mmap_allocator<int> memory_mmap{cache}; // This is our 'mmap' allocator, that refers to the cache.
+
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_mmap.allocate(memory_size); }, [&] (std::size_t i) { memory_mmap.deallocate(assigned_addresses[i], memory_size); });
+            }
+        }
     }
 
-    std::cout << "---- END BENCHMARK MEMORY MMAP ----" << std::endl;
+    std::cout << "Cache hits: " << cache.get_number_of_hits() << ", cache misses: " << cache.get_number_of_misses() << std::endl;
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK MEMORY MMAP CACHED ----" << std::endl;
 
     return new_statistic; // Return the statistics.
 }
@@ -131,33 +212,919 @@ benchmark_statistics allocator_benchmark::benchmark_memory_new() const {
 
     // Go through the list of all your specified runs.
     for (const auto& single_run : m_number_of_runs) {
-        std::vector<long> sum_durations{}; // A vector with the durations of each run.
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
+
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (const auto& memory_size : m_number_of_elements) {
+                new_allocator<int> memory_new{}; // This is our 'new' allocator.
+
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_new.allocate(memory_size); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_new.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
+
+        add_summary(new_statistic, "malloc_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                new_allocator<int> memory_new{}; // This is our 'new' allocator.
+
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_new.allocate(memory_size); }, [&] (std::size_t i) { memory_new.deallocate(assigned_addresses[i], memory_size); });
+            }
+        }
+    }
+
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK MEMORY NEW ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the size class allocator. It allocates the same sizes as the 'malloc' benchmark.
+benchmark_statistics allocator_benchmark::benchmark_memory_size_class() const {
+    std::cout << "---- BENCHMARK MEMORY SIZE CLASS ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_size_class}; // A statistic for the size class allocator.
+    std::vector<size_class_allocator<int>> memory_size_classes{}; // A size class allocator with its own pool for every memory size, created before anything is measured and reused by all the iterations.
+
+    for ([[maybe_unused]] const auto& memory_size : m_number_of_elements)
+        memory_size_classes.emplace_back(std::make_shared<size_class_pool>());
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
+
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (std::size_t size_index = 0; size_index < m_number_of_elements.size(); size_index++) {
+                const auto& memory_size = m_number_of_elements[size_index]; // The number of elements of every allocation.
+                auto& memory_size_class = memory_size_classes[size_index]; // This is our size class allocator, with its own pool.
+
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_size_class.allocate(memory_size); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_size_class.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+            }
+        }, m_number_of_elements.size());
+
+        add_summary(new_statistic, "size_class_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                size_class_allocator<int> memory_size_class{std::make_shared<size_class_pool>()}; // A new size class allocator, so that mapping its blocks is part of the latencies.
+
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_size_class.allocate(memory_size); }, [&] (std::size_t i) { memory_size_class.deallocate(assigned_addresses[i], memory_size); });
+            }
+        }
+    }
+
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK MEMORY SIZE CLASS ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the monotonic arena allocator. Instead of deallocating every address, the arena is reset once.
+benchmark_statistics allocator_benchmark::benchmark_memory_arena() const {
+    std::cout << "---- BENCHMARK MEMORY ARENA ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_arena}; // A statistic for the monotonic arena allocator.
+    std::deque<monotonic_arena> arenas{}; // An arena for every memory size, created before anything is measured. Its blocks are mapped in the warmup, and kept by every reset.
+
+    for ([[maybe_unused]] const auto& memory_size : m_number_of_elements)
+        arenas.emplace_back();
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
+
+        // A single iteration goes through all the memory sizes for a single specified run. The statistics are per memory size.
+        auto run_summary = m_engine.measure([&] () {
+            for (std::size_t size_index = 0; size_index < m_number_of_elements.size(); size_index++) {
+                const auto& memory_size = m_number_of_elements[size_index]; // The number of elements of every allocation.
+                auto& arena = arenas[size_index]; // This is our arena.
+                arena_allocator<int> memory_arena{arena}; // This is our arena allocator.
+
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_arena.allocate(memory_size); // Allocate memory, get addresses.
+
+                arena.reset(); // Deallocate all the memory at once.
+            }
+        }, m_number_of_elements.size());
+
+        add_summary(new_statistic, "arena_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+
+        // In the instrumentation mode, every single call is timed once more, to show the tail latencies.
+        if (m_engine.get_options().m_record_latencies) {
+            for (const auto& memory_size : m_number_of_elements) {
+                monotonic_arena arena{}; // A new arena, so that mapping its blocks is part of the latencies.
+                arena_allocator<int> memory_arena{arena}; // This is our arena allocator.
+
+                record_latencies(new_statistic, single_run, [&] (std::size_t i) { assigned_addresses[i] = memory_arena.allocate(memory_size); }, [&] (std::size_t i) { memory_arena.deallocate(assigned_addresses[i], memory_size); });
+            }
+        }
+    }
+
+    print_latencies(new_statistic);
+    std::cout << "---- END BENCHMARK MEMORY ARENA ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the polymorphic memory resource with memory pools.
+benchmark_statistics allocator_benchmark::benchmark_pmr_pool() const {
+    return benchmark_memory_resource<pool_memory_resource>(benchmark_statistics::statistics_recognition::pmr_pool, "PMR_POOL");
+}
+
+// This method benchmarks the 'std::pmr::unsynchronized_pool_resource' of the standard library.
+benchmark_statistics allocator_benchmark::benchmark_pmr_std_pool() const {
+    return benchmark_memory_resource<std::pmr::unsynchronized_pool_resource>(benchmark_statistics::statistics_recognition::pmr_std_pool, "PMR_STD_POOL");
+}
+
+// This method benchmarks the polymorphic memory resource with a monotonic arena.
+benchmark_statistics allocator_benchmark::benchmark_pmr_arena() const {
+    return benchmark_memory_resource<arena_memory_resource>(benchmark_statistics::statistics_recognition::pmr_arena, "PMR_ARENA");
+}
+
+// This method benchmarks the 'std::pmr::monotonic_buffer_resource' of the standard library.
+benchmark_statistics allocator_benchmark::benchmark_pmr_std_monotonic() const {
+    return benchmark_memory_resource<std::pmr::monotonic_buffer_resource>(benchmark_statistics::statistics_recognition::pmr_std_monotonic, "PMR_STD_MONOTONIC");
+}
+
+// This method benchmarks visiting pooled objects in a random order, with the blocks of the memory pool allocator on normal pages.
+benchmark_statistics allocator_benchmark::benchmark_traversal_normal_pages() const {
+    return benchmark_traversal(benchmark_statistics::statistics_recognition::traversal_normal_pages, page_mode::normal, "TRAVERSAL NORMAL PAGES");
+}
+
+// This method benchmarks visiting pooled objects in a random order, with the blocks of the memory pool allocator on huge pages.
+benchmark_statistics allocator_benchmark::benchmark_traversal_huge_pages() const {
+    return benchmark_traversal(benchmark_statistics::statistics_recognition::traversal_huge_pages, page_mode::explicit_huge, "TRAVERSAL HUGE PAGES");
+}
+
+// This method benchmarks a memory pool allocator that grows into the millions of chunks, whereby every block has the same size.
+benchmark_statistics allocator_benchmark::benchmark_growth_fixed() const {
+    return benchmark_growth(benchmark_statistics::statistics_recognition::growth_fixed, 1, "GROWTH FIXED");
+}
+
+// This method benchmarks a memory pool allocator that grows into the millions of chunks, whereby every block is twice as big as the one before.
+benchmark_statistics allocator_benchmark::benchmark_growth_geometric() const {
+    return benchmark_growth(benchmark_statistics::statistics_recognition::growth_geometric, 2, "GROWTH GEOMETRIC");
+}
+
+// This method benchmarks the latency of single allocations, whereby every new block of the memory pool allocator is linked at once.
+benchmark_statistics allocator_benchmark::benchmark_fill_linked() const {
+    return benchmark_fill(benchmark_statistics::statistics_recognition::fill_linked, block_fill_mode::linked, "FILL LINKED");
+}
+
+// This method benchmarks the latency of single allocations, whereby the chunks of a new block of the memory pool allocator are carved lazily.
+benchmark_statistics allocator_benchmark::benchmark_fill_lazy() const {
+    return benchmark_fill(benchmark_statistics::statistics_recognition::fill_lazy, block_fill_mode::lazy, "FILL LAZY");
+}
+
+// This method benchmarks the latency of single allocations, whereby every new block of the memory pool allocator is prefaulted.
+benchmark_statistics allocator_benchmark::benchmark_fill_prefaulted() const {
+    return benchmark_fill(benchmark_statistics::statistics_recognition::fill_prefaulted, block_fill_mode::prefaulted, "FILL PREFAULTED");
+}
+
+// This method benchmarks updating a counter per thread, whereby the counters are pooled next to each other, so that they share a cache line (false sharing).
+benchmark_statistics allocator_benchmark::benchmark_counters_packed() const {
+    return benchmark_counters<alignof(std::uint64_t)>(benchmark_statistics::statistics_recognition::counters_packed, "COUNTERS PACKED");
+}
+
+// This method benchmarks updating a counter per thread, whereby every pooled counter is aligned to a cache line of its own.
+benchmark_statistics allocator_benchmark::benchmark_counters_aligned() const {
+    return benchmark_counters<64>(benchmark_statistics::statistics_recognition::counters_aligned, "COUNTERS ALIGNED");
+}
+
+// This method benchmarks batches of chunks, whereby every chunk is allocated and deallocated on its own.
+benchmark_statistics allocator_benchmark::benchmark_batch_loop() const {
+    return benchmark_batch(benchmark_statistics::statistics_recognition::batch_loop, false, "BATCH LOOP");
+}
+
+// This method benchmarks batches of chunks, whereby every batch is allocated and deallocated at once.
+benchmark_statistics allocator_benchmark::benchmark_batch_bulk() const {
+    return benchmark_batch(benchmark_statistics::statistics_recognition::batch_bulk, true, "BATCH BULK");
+}
+
+// This method benchmarks a growing buffer of integers in an 'std::vector' with the 'mmap' allocator. Every growth copies all the elements.
+benchmark_statistics allocator_benchmark::benchmark_buffer_vector() const {
+    return benchmark_buffer(benchmark_statistics::statistics_recognition::buffer_vector, false, "BUFFER VECTOR");
+}
+
+// This method benchmarks a growing buffer of integers in a 'growable_vector' with the 'mmap' allocator. Every growth is done in place or by 'mremap'.
+benchmark_statistics allocator_benchmark::benchmark_buffer_growable() const {
+    return benchmark_buffer(benchmark_statistics::statistics_recognition::buffer_growable, true, "BUFFER GROWABLE");
+}
+
+// This method benchmarks strings in memory of 'new[]', whereby every string is default constructed first, and then assigned.
+benchmark_statistics allocator_benchmark::benchmark_objects_new_array() const {
+    return benchmark_objects(benchmark_statistics::statistics_recognition::objects_new_array, false, "OBJECTS NEW ARRAY");
+}
+
+// This method benchmarks strings in raw memory of the 'new' allocator, whereby every string is constructed only once.
+benchmark_statistics allocator_benchmark::benchmark_objects_new_raw() const {
+    return benchmark_objects(benchmark_statistics::statistics_recognition::objects_new_raw, true, "OBJECTS NEW RAW");
+}
+
+// This method benchmarks the memory pool allocator without any checks, as the reference for the debug modes.
+benchmark_statistics allocator_benchmark::benchmark_debug_none() const {
+    return benchmark_debug(benchmark_statistics::statistics_recognition::debug_none, pool_debug_mode::none, "DEBUG NONE");
+}
+
+// This method benchmarks the guarded memory pool allocator, that checks every allocation and deallocation.
+benchmark_statistics allocator_benchmark::benchmark_debug_guarded() const {
+    return benchmark_debug(benchmark_statistics::statistics_recognition::debug_guarded, pool_debug_mode::guarded, "DEBUG GUARDED");
+}
+
+// This method benchmarks the guarded memory pool allocator, whereby every block is also followed by a guard page.
+benchmark_statistics allocator_benchmark::benchmark_debug_guard_pages() const {
+    return benchmark_debug(benchmark_statistics::statistics_recognition::debug_guard_pages, pool_debug_mode::guard_pages, "DEBUG GUARD PAGES");
+}
+
+// This method replays an allocation trace against the 'malloc' memory resource.
+benchmark_statistics allocator_benchmark::benchmark_trace_malloc() const {
+    return benchmark_trace<malloc_memory_resource>(benchmark_statistics::statistics_recognition::trace_malloc, "TRACE MALLOC");
+}
+
+// This method replays an allocation trace against the 'new' memory resource.
+benchmark_statistics allocator_benchmark::benchmark_trace_new() const {
+    return benchmark_trace<new_memory_resource>(benchmark_statistics::statistics_recognition::trace_new, "TRACE NEW");
+}
+
+// This method replays an allocation trace against the memory resource with memory pools.
+benchmark_statistics allocator_benchmark::benchmark_trace_pool() const {
+    return benchmark_trace<pool_memory_resource>(benchmark_statistics::statistics_recognition::trace_pool, "TRACE POOL");
+}
+
+// This method replays an allocation trace against the memory resource with a monotonic arena.
+benchmark_statistics allocator_benchmark::benchmark_trace_arena() const {
+    return benchmark_trace<arena_memory_resource>(benchmark_statistics::statistics_recognition::trace_arena, "TRACE ARENA");
+}
+
+// This method replays an allocation trace against the pool resource of the standard library.
+benchmark_statistics allocator_benchmark::benchmark_trace_std_pool() const {
+    return benchmark_trace<std::pmr::unsynchronized_pool_resource>(benchmark_statistics::statistics_recognition::trace_std_pool, "TRACE STD POOL");
+}
+
+// This method replays all the generated patterns against the memory pool allocator. A chunk only has a single size, so only the fixed size is replayed.
+benchmark_statistics allocator_benchmark::benchmark_pattern_pool() const {
+    pool_allocator<std::array<std::byte, pattern_fixed_size>> memory_pool{1024}; // This is our memory pool allocator, with chunks of the fixed size. It is reused by all the replays.
+    pool_byte_allocator<std::array<std::byte, pattern_fixed_size>> memory_bytes{memory_pool}; // The same memory pool allocator, as an allocator of bytes.
+
+    return benchmark_pattern(benchmark_statistics::statistics_recognition::pattern_pool, "PATTERN POOL", true, [&] (const trace_replayer& replayer) {
+        replayer.replay(memory_bytes);
+    });
+}
+
+// This method replays all the generated patterns, with all the distributions of sizes, against the 'malloc' allocator.
+benchmark_statistics allocator_benchmark::benchmark_pattern_malloc() const {
+    return benchmark_pattern(benchmark_statistics::statistics_recognition::pattern_malloc, "PATTERN MALLOC", false, [] (const trace_replayer& replayer) {
+        malloc_allocator<std::byte> memory_malloc{}; // This is our 'malloc' allocator.
+        replayer.replay(memory_malloc);
+    });
+}
+
+// This method replays all the generated patterns, with all the distributions of sizes, against the 'new' allocator.
+benchmark_statistics allocator_benchmark::benchmark_pattern_new() const {
+    return benchmark_pattern(benchmark_statistics::statistics_recognition::pattern_new, "PATTERN NEW", false, [] (const trace_replayer& replayer) {
+        new_allocator<std::byte> memory_new{}; // This is our 'new' allocator.
+        replayer.replay(memory_new);
+    });
+}
+
+// This method replays all the generated patterns, with all the distributions of sizes, against the size class allocator.
+benchmark_statistics allocator_benchmark::benchmark_pattern_size_class() const {
+    size_class_allocator<std::byte> memory_size_class{std::make_shared<size_class_pool>()}; // This is our size class allocator, with a table of memory pools of its own. It is reused by all the replays.
+
+    return benchmark_pattern(benchmark_statistics::statistics_recognition::pattern_size_class, "PATTERN SIZE CLASS", false, [&] (const trace_replayer& replayer) {
+        replayer.replay(memory_size_class);
+    });
+}
+
+// This method replays all the generated patterns, with all the distributions of sizes, against the pool resource of the standard library.
+benchmark_statistics allocator_benchmark::benchmark_pattern_std_pool() const {
+    std::pmr::unsynchronized_pool_resource memory_resource{}; // This is our memory resource. It is reused by all the replays.
+    std::pmr::polymorphic_allocator<std::byte> memory_polymorphic{&memory_resource}; // This is the allocator that only knows the base class of the resource.
+
+    return benchmark_pattern(benchmark_statistics::statistics_recognition::pattern_std_pool, "PATTERN STD POOL", false, [&] (const trace_replayer& replayer) {
+        replayer.replay(memory_polymorphic);
+    });
+}
+
+// This method sweeps the memory pool allocator behind a mutex over the numbers of threads of the options.
+benchmark_statistics allocator_benchmark::benchmark_scalability_pool_mutex() const {
+    return benchmark_scalability<shared_locked_pool>(benchmark_statistics::statistics_recognition::scalability_pool_mutex, "SCALABILITY POOL MUTEX");
+}
+
+// This method sweeps the concurrent memory pool allocator with magazines over the numbers of threads of the options.
+benchmark_statistics allocator_benchmark::benchmark_scalability_pool_magazines() const {
+    return benchmark_scalability<shared_concurrent_pool<32>>(benchmark_statistics::statistics_recognition::scalability_pool_magazines, "SCALABILITY POOL MAGAZINES");
+}
+
+// This method sweeps the concurrent memory pool allocator without magazines, so only with its lock-free free list, over the numbers of threads of the options.
+benchmark_statistics allocator_benchmark::benchmark_scalability_pool_lock_free() const {
+    return benchmark_scalability<shared_concurrent_pool<0>>(benchmark_statistics::statistics_recognition::scalability_pool_lock_free, "SCALABILITY POOL LOCK-FREE");
+}
+
+// This method sweeps the 'malloc' allocator over the numbers of threads of the options.
+benchmark_statistics allocator_benchmark::benchmark_scalability_malloc() const {
+    return benchmark_scalability<shared_standard_allocator<malloc_allocator<int>>>(benchmark_statistics::statistics_recognition::scalability_malloc, "SCALABILITY MALLOC");
+}
+
+// This method sweeps the 'new' allocator over the numbers of threads of the options.
+benchmark_statistics allocator_benchmark::benchmark_scalability_new() const {
+    return benchmark_scalability<shared_standard_allocator<new_allocator<int>>>(benchmark_statistics::statistics_recognition::scalability_new, "SCALABILITY NEW");
+}
+
+// This method benchmarks inserting and erasing elements of an 'std::map' with the standard allocator.
+benchmark_statistics allocator_benchmark::benchmark_map_std_allocator() const {
+    std::cout << "---- BENCHMARK MAP STD ALLOCATOR ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::map_std_allocator}; // A statistic for the map with the standard allocator.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        // Go through all the memory sizes for a single specified run. Every memory size is a round of inserting and erasing all the keys.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            std::map<int, int> benchmark_map{}; // This is our map, every element is a node of its own.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (std::size_t i = 0; i < single_run; i++)
+                benchmark_map.emplace(static_cast<int>(i), static_cast<int>(i)); // Insert a key, this allocates a node.
+
+            for (std::size_t i = 0; i < single_run; i++)
+                benchmark_map.erase(static_cast<int>(i)); // Erase a key, this deallocates a node.
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        add_summary(new_statistic, "map_std_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK MAP STD ALLOCATOR ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks inserting and erasing elements of an 'std::map' with the memory pool node adapter.
+benchmark_statistics allocator_benchmark::benchmark_map_pool_node() const {
+    std::cout << "---- BENCHMARK MAP POOL NODE ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::map_pool_node}; // A statistic for the map with the memory pool node adapter.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        // Go through all the memory sizes for a single specified run. Every memory size is a round of inserting and erasing all the keys.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            std::map<int, int, std::less<>, pool_node_allocator<std::pair<const int, int>>> benchmark_map{}; // This is our map, every element is a node of its own.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (std::size_t i = 0; i < single_run; i++)
+                benchmark_map.emplace(static_cast<int>(i), static_cast<int>(i)); // Insert a key, this allocates a node.
+
+            for (std::size_t i = 0; i < single_run; i++)
+                benchmark_map.erase(static_cast<int>(i)); // Erase a key, this deallocates a node.
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        add_summary(new_statistic, "map_pool_node_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK MAP POOL NODE ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the memory pool allocator shared by multiple threads, whereby every call is protected by a mutex.
+benchmark_statistics allocator_benchmark::benchmark_memory_pool_mutex() const {
+    std::cout << "---- BENCHMARK MEMORY POOL MUTEX (" << m_number_of_threads << " THREADS) ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_pool_mutex}; // A statistic for the memory pool allocator with a mutex.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
 
         // Go through all the memory sizes for a single specified run.
         for (const auto& memory_size : m_number_of_elements) {
-            std::vector<int*> assigned_addresses{single_run}; // This vector will contain allocated addresses.
-            new_allocator<int> memory_new{}; // This is our 'new' allocator.
+            std::vector<std::vector<chunk<int>*>> assigned_addresses{m_number_of_threads, std::vector<chunk<int>*>{single_run}}; // For every thread, a vector that will contain allocated addresses.
+            pool_allocator<int> memory_pool{memory_size}; // This is our memory pool allocator.
+            std::mutex pool_mutex{}; // This mutex protects the memory pool allocator.
 
-            auto begin_time = std::chrono::high_resolution_clock::now(); // The start time.
+            // A single pass that is not timed maps and carves the chunks of all the threads, just like for the lock-free pool, so that only the locked calls are timed.
+            for (auto& thread_addresses : assigned_addresses)
+                for (auto& get_memory_addresses : thread_addresses)
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
 
-            for (auto& get_memory_addresses : assigned_addresses)
-                get_memory_addresses = memory_new.allocate(memory_size); // Allocate memory, get addresses.
+            for (auto& thread_addresses : assigned_addresses)
+                for (auto& free_memory_addresses : thread_addresses)
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+
+            sum_durations.push_back(run_on_threads([&] (std::size_t thread_index) {
+                for (auto& get_memory_addresses : assigned_addresses[thread_index]) {
+                    std::lock_guard<std::mutex> pool_lock{pool_mutex};
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
+                }
+
+                for (auto& free_memory_addresses : assigned_addresses[thread_index]) {
+                    std::lock_guard<std::mutex> pool_lock{pool_mutex};
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+                }
+            }));
+        }
+
+        add_summary(new_statistic, "pool_mutex_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK MEMORY POOL MUTEX ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the concurrent memory pool allocator shared by multiple threads, whereby every call goes to its lock-free free list.
+benchmark_statistics allocator_benchmark::benchmark_memory_pool_lock_free() const {
+    std::cout << "---- BENCHMARK MEMORY POOL LOCK-FREE (" << m_number_of_threads << " THREADS) ----" << std::endl;
+
+    benchmark_statistics new_statistic{benchmark_statistics::statistics_recognition::memory_pool_lock_free}; // A statistic for the concurrent memory pool allocator.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        // Go through all the memory sizes for a single specified run.
+        for (const auto& memory_size : m_number_of_elements) {
+            std::vector<std::vector<chunk<int>*>> assigned_addresses{m_number_of_threads, std::vector<chunk<int>*>{single_run}}; // For every thread, a vector that will contain allocated addresses.
+            concurrent_pool_allocator<int> memory_pool{memory_size, 0}; // This is our concurrent memory pool allocator. Without magazines, every call uses the lock-free free list.
+
+            // A single pass that is not timed carves the chunks of all the threads, so that the timed calls only use the lock-free free list, and never the mutex of new blocks.
+            for (auto& thread_addresses : assigned_addresses)
+                for (auto& get_memory_addresses : thread_addresses)
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
+
+            for (auto& thread_addresses : assigned_addresses)
+                for (auto& free_memory_addresses : thread_addresses)
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+
+            sum_durations.push_back(run_on_threads([&] (std::size_t thread_index) {
+                for (auto& get_memory_addresses : assigned_addresses[thread_index])
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses[thread_index])
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+            }));
+        }
+
+        add_summary(new_statistic, "pool_lock_free_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK MEMORY POOL LOCK-FREE ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks visiting pooled objects in a random order. The number of objects is the number of runs times 'objects_per_run', so that they span much more memory than the TLB covers.
+benchmark_statistics allocator_benchmark::benchmark_traversal(const benchmark_statistics::statistics_recognition& identifier, page_mode mode, const std::string& traversal_name) const {
+    /// This structure 'pooled_object' fills a whole cache line, so that every visit touches another line.
+    struct alignas(64) pooled_object {
+        std::uint64_t m_value; // The value that is read during the traversal.
+    };
+
+    static constexpr std::size_t objects_per_run = 256; // The number of objects for a single run.
+
+    std::cout << "---- BENCHMARK " << traversal_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for this traversal.
+    std::mt19937_64 random_generator{42}; // A fixed seed, so that both traversals visit the objects in the same order.
+    [[maybe_unused]] volatile std::uint64_t traversal_sink{0}; // The sum of the traversal is written here, so that the compiler can not skip the traversal.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        pool_options traversal_options{}; // The options of the memory pool allocator.
+        traversal_options.m_page_mode = mode; // Only the pages differ between the traversals.
+
+        pool_allocator<pooled_object> memory_pool{chunk_block_alignment / sizeof(pooled_object), traversal_options}; // This is our memory pool allocator, with blocks as big as a huge page.
+        std::vector<chunk<pooled_object>*> assigned_addresses{single_run * objects_per_run}; // This vector will contain allocated addresses.
+
+        for (std::size_t i = 0; i < assigned_addresses.size(); i++) {
+            assigned_addresses[i] = memory_pool.allocate(); // Allocate memory, get addresses.
+            assigned_addresses[i]->m_data.m_value = i; // Touch the object, so that its page is in physical memory.
+        }
+
+        std::shuffle(assigned_addresses.begin(), assigned_addresses.end(), random_generator); // Visit the objects in a random order.
+
+        // Every memory size is a repetition of the same traversal.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            std::uint64_t traversal_sum{0}; // The sum of all the visited values.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (const auto* visit_memory_address : assigned_addresses)
+                traversal_sum += visit_memory_address->m_data.m_value; // Visit the object.
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            traversal_sink = traversal_sum;
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        for (auto& free_memory_addresses : assigned_addresses)
+            memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+
+        add_summary(new_statistic, "traversal_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK " << traversal_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks a memory pool allocator that grows from a small first block to 'chunks_per_run' times the number of runs. It also shows the number of system calls it took.
+benchmark_statistics allocator_benchmark::benchmark_growth(const benchmark_statistics::statistics_recognition& identifier, std::size_t growth_factor, const std::string& growth_name) const {
+    static constexpr std::size_t chunks_per_run = 1000; // The number of chunks for a single run, so that the biggest run needs a million chunks.
+
+    std::cout << "---- BENCHMARK " << growth_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for this growth.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+        std::size_t sum_system_calls{0}; // The number of system calls of all the memory sizes.
+
+        pool_options growth_options{}; // The options of the memory pool allocator.
+        growth_options.m_growth_factor = growth_factor; // Only the growth differs between the benchmarks.
+
+        // Every memory size is a repetition with a new memory pool allocator, that grows from its first small block.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            std::vector<chunk<int>*> assigned_addresses{single_run * chunks_per_run}; // This vector will contain allocated addresses.
+            auto system_calls_before = memory_mapping::get_number_of_system_calls(); // The system calls until now.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            {
+                pool_allocator<int> memory_pool{32, growth_options}; // This is our memory pool allocator, its first block only fills a single page.
+
+                for (auto& single_address : assigned_addresses)
+                    single_address = memory_pool.allocate(); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+            } // The destructor unmaps all the blocks, this is part of the growth as well.
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_system_calls += memory_mapping::get_number_of_system_calls() - system_calls_before;
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        add_summary(new_statistic, "growth_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+        std::cout << "System calls for " << single_run * chunks_per_run << " chunks, is: " << sum_system_calls / m_number_of_elements.size() << std::endl;
+    }
+
+    std::cout << "---- END BENCHMARK " << growth_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks the latency of every single allocation from a memory pool allocator with blocks of 2 MiB. Besides the total time, it shows the 99th percentile and the worst latency.
+benchmark_statistics allocator_benchmark::benchmark_fill(const benchmark_statistics::statistics_recognition& identifier, block_fill_mode fill_mode, const std::string& fill_name) const {
+    static constexpr std::size_t chunks_per_run = 1000; // The number of chunks for a single run, so that the biggest run needs several blocks.
+
+    std::cout << "---- BENCHMARK " << fill_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for this fill mode.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+        std::vector<double> allocation_latencies{}; // The latency of every single allocation, of all the memory sizes, in nanoseconds.
+        allocation_latencies.reserve(single_run * chunks_per_run * m_number_of_elements.size()); // Growing this vector may not disturb the measurements.
+
+        pool_options fill_options{}; // The options of the memory pool allocator.
+        fill_options.m_fill_mode = fill_mode; // Only the fill mode differs between the benchmarks.
+
+        // Every memory size is a repetition with a new memory pool allocator, so that every repetition maps its blocks again.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            pool_allocator<int> memory_pool{chunk_block_alignment / sizeof(chunk<int>), fill_options}; // This is our memory pool allocator, with blocks of 2 MiB.
+            std::vector<chunk<int>*> assigned_addresses{single_run * chunks_per_run}; // This vector will contain allocated addresses.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (auto& single_address : assigned_addresses) {
+                auto allocation_begin = m_engine.get_clock().now(); // The start time of this allocation.
+                single_address = memory_pool.allocate(); // Allocate memory, get addresses.
+                single_address->m_data = 0; // Use the chunk, so that the page fault of a lazy chunk is part of the latency.
+                auto allocation_end = m_engine.get_clock().now(); // The end time of this allocation.
+
+                allocation_latencies.push_back(m_engine.get_clock().to_nanoseconds(allocation_end - allocation_begin));
+            }
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
 
             for (auto& free_memory_addresses : assigned_addresses)
-                memory_new.deallocate(free_memory_addresses, memory_size); // Deallocate memory.
+                memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        // Only the 99th percentile and the worst latency are needed, so a partial sort is enough.
+        auto percentile_position = allocation_latencies.begin() + static_cast<long>(allocation_latencies.size() * 99 / 100);
+        std::nth_element(allocation_latencies.begin(), percentile_position, allocation_latencies.end());
+        auto worst_latency = *std::max_element(percentile_position, allocation_latencies.end());
+
+        add_summary(new_statistic, "fill_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+        std::cout << "Latency of a single allocation, 99th percentile: " << *percentile_position << " nanoseconds, worst: " << worst_latency << " nanoseconds" << std::endl;
+    }
+
+    std::cout << "---- END BENCHMARK " << fill_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks batches of 'chunks_per_run' times the number of runs chunks, from a warm memory pool allocator. Besides the total time, it shows the time per chunk.
+benchmark_statistics allocator_benchmark::benchmark_batch(const benchmark_statistics::statistics_recognition& identifier, bool is_bulk, const std::string& batch_name) const {
+    static constexpr std::size_t chunks_per_run = 1000; // The number of chunks for a single run.
 
-            auto end_time = std::chrono::high_resolution_clock::now(); // The end time.
+    std::cout << "---- BENCHMARK " << batch_name << " ----" << std::endl;
 
-            sum_durations.push_back(std::chrono::duration_cast<std::chrono::microseconds>(end_time - begin_time).count()); // Calculate the duration of a single test.
+    benchmark_statistics new_statistic{identifier}; // A statistic for this batch mode.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+        std::vector<chunk<int>*> assigned_addresses(single_run * chunks_per_run); // This vector will contain allocated addresses.
+        pool_allocator<int> memory_pool{chunk_block_alignment / sizeof(chunk<int>)}; // This is our memory pool allocator, with blocks of 2 MiB.
+
+        // Map and touch all the blocks first, so that only the batches themselves are measured.
+        memory_pool.allocate_bulk(assigned_addresses.size(), assigned_addresses.data());
+        memory_pool.deallocate_bulk(assigned_addresses);
+
+        // Every memory size is a repetition of the same batch.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            if (is_bulk) {
+                memory_pool.allocate_bulk(assigned_addresses.size(), assigned_addresses.data()); // Allocate the whole batch.
+                memory_pool.deallocate_bulk(assigned_addresses); // Deallocate the whole batch.
+            }
+            else {
+                for (auto& get_memory_addresses : assigned_addresses)
+                    get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
+
+                for (auto& free_memory_addresses : assigned_addresses)
+                    memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+            }
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        auto run_summary = benchmark_engine::summarize(sum_durations); // The statistics of the durations of this run.
+        add_summary(new_statistic, "batch_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+        std::cout << "Time per chunk, allocating and deallocating, is: " << run_summary.m_median / static_cast<double>(assigned_addresses.size()) << " nanoseconds" << std::endl;
+    }
+
+    std::cout << "---- END BENCHMARK " << batch_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks a buffer that grows one element at a time, to 'elements_per_run' times the number of runs integers (32 MiB at most). It also shows how the buffer grew.
+benchmark_statistics allocator_benchmark::benchmark_buffer(const benchmark_statistics::statistics_recognition& identifier, bool is_growable, const std::string& buffer_name) const {
+    static constexpr std::size_t elements_per_run = 4096; // The number of integers for a single run.
+
+    std::cout << "---- BENCHMARK " << buffer_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for this buffer.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+        std::size_t number_of_expansions{0}; // The number of times the growable buffer grew in place.
+        std::size_t number_of_reallocations{0}; // The number of times the growable buffer was moved by 'mremap'.
+
+        // Every memory size is a repetition of the same growth.
+        for ([[maybe_unused]] const auto& memory_size : m_number_of_elements) {
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            if (is_growable) {
+                growable_vector<std::uint64_t, mmap_allocator<std::uint64_t>> buffer{}; // The buffer that lets the allocator grow it.
+
+                for (std::uint64_t i = 0; i < single_run * elements_per_run; i++)
+                    buffer.push_back(i); // Add an integer, the buffer grows when it is full.
+
+                number_of_expansions = buffer.get_number_of_expansions();
+                number_of_reallocations = buffer.get_number_of_reallocations();
+            }
+            else {
+                std::vector<std::uint64_t, mmap_allocator<std::uint64_t>> buffer{}; // The buffer that copies its elements on every growth.
+
+                for (std::uint64_t i = 0; i < single_run * elements_per_run; i++)
+                    buffer.push_back(i); // Add an integer, the buffer grows when it is full.
+            }
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
         }
 
-        auto average_duration = (double)std::accumulate(sum_durations.begin(), sum_durations.end(), average_running_time{}); // Here, you are calculating the average running time of a singel run.
-        new_statistic.add_result(std::make_tuple("malloc_" + std::to_string(single_run), single_run, average_duration)); // Create a new statistic for your run.
+        add_summary(new_statistic, "buffer_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
 
-        std::cout << "Elapsed time for your specified runs, is: " << average_duration << " microseconds" << std::endl;
+        if (is_growable)
+            std::cout << "Growths in place: " << number_of_expansions << ", growths by 'mremap': " << number_of_reallocations << std::endl;
     }
 
-    std::cout << "---- END BENCHMARK MEMORY NEW ----" << std::endl;
+    std::cout << "---- END BENCHMARK " << buffer_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks creating and destroying arrays of strings that do not fit in the small buffer of a string, so that constructing one costs an allocation.
+benchmark_statistics allocator_benchmark::benchmark_objects(const benchmark_statistics::statistics_recognition& identifier, bool is_raw, const std::string& objects_name) const {
+    std::cout << "---- BENCHMARK " << objects_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for these objects.
+    const std::string object_value(64, 'x'); // The value of every string, too long for the small buffer.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+
+        // Go through all the memory sizes for a single specified run.
+        for (const auto& memory_size : m_number_of_elements) {
+            new_allocator<std::string> memory_new{}; // This is our 'new' allocator, it only hands out raw memory.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (std::size_t i = 0; i < single_run; i++) {
+                if (is_raw) {
+                    auto* objects = memory_new.allocate(memory_size); // Raw memory, nothing is constructed yet.
+                    std::uninitialized_fill_n(objects, memory_size, object_value); // Construct every string once.
+
+                    std::destroy_n(objects, memory_size); // Destroy every string once.
+                    memory_new.deallocate(objects, memory_size);
+                }
+                else {
+                    auto* objects = new std::string[memory_size]; // Every string is default constructed here.
+                    std::fill_n(objects, memory_size, object_value); // And every string is assigned afterwards.
+
+                    delete[] objects;
+                }
+            }
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        add_summary(new_statistic, "objects_" + std::to_string(single_run), single_run, benchmark_engine::summarize(sum_durations)); // Create a new statistic for your run, from the statistics of its durations.
+    }
+
+    std::cout << "---- END BENCHMARK " << objects_name << " ----" << std::endl;
+
+    return new_statistic; // Return the statistics.
+}
+
+// This method benchmarks allocating and deallocating 'chunks_per_run' times the number of runs chunks of 32 bytes, with a debug mode. Every run starts with a new pool, so the blocks are created as well.
+benchmark_statistics allocator_benchmark::benchmark_debug(const benchmark_statistics::statistics_recognition& identifier, pool_debug_mode debug_mode, const std::string& debug_name) const {
+    static constexpr std::size_t chunks_per_run = 100; // The number of chunks for a single run.
+    using small_object = std::array<std::uint64_t, 4>; // An object of 32 bytes, so that the poison of a free chunk is checked as well.
+
+    std::cout << "---- BENCHMARK " << debug_name << " ----" << std::endl;
+
+    benchmark_statistics new_statistic{identifier}; // A statistic for this debug mode.
+
+    // Go through the list of all your specified runs.
+    for (const auto& single_run : m_number_of_runs) {
+        std::vector<double> sum_durations{}; // A vector with the durations of each run, in nanoseconds.
+        std::vector<chunk<small_object>*> assigned_addresses(single_run * chunks_per_run); // This vector will contain allocated addresses.
+
+        // Go through all the memory sizes for a single specified run.
+        for (const auto& memory_size : m_number_of_elements) {
+            pool_options debug_options{}; // The options of the memory pool allocator.
+            debug_options.m_debug_mode = debug_mode;
+
+            pool_allocator<small_object> memory_pool{memory_size, debug_options}; // This is our memory pool allocator, with the debug mode.
+
+            auto begin_time = m_engine.get_clock().now(); // The start time.
+
+            for (auto& get_memory_addresses : assigned_addresses)
+                get_memory_addresses = memory_pool.allocate(); // Allocate memory, get addresses.
+
+            for (auto& free_memory_addresses : assigned_addresses)
+                memory_pool.deallocate(free_memory_addresses); // Deallocate memory.
+
+            // Allocate all the chunks once more, now they come from the free lists.
+            for (auto& get_memory_addresses : assigned_addresses)
+                get_memory_addresses = memory_pool.allocate();
+
+            for (auto& free_memory_addresses : assigned_addresses)
+                memory_pool.deallocate(free_memory_addresses);
+
+            auto end_time = m_engine.get_clock().now(); // The end time.
+
+            sum_durations.push_back(m_engine.get_clock().to_nanoseconds(end_time - begin_time)); // Calculate the duration of a single test.
+        }
+
+        auto run_summary = benchmark_engine::summarize(sum_durations); // The statistics of the durations of this run.
+        add_summary(new_statistic, "debug_" + std::to_string(single_run), single_run, run_summary); // Create a new statistic for your run.
+        std::cout << "Time per chunk, allocating and deallocating twice, is: " << run_summary.m_median / static_cast<double>(assigned_addresses.size()) << " nanoseconds" << std::endl;
+    }
+
+    std::cout << "---- END BENCHMARK " << debug_name << " ----" << std::endl;
 
     return new_statistic; // Return the statistics.
-}
\ No newline at end of file
+}
+
+// This method loads the allocation trace of a run. This is the trace file of 'ALLOCATION_TRACE' when it is set, otherwise a trace of a service is generated.
+trace_replayer allocator_benchmark::load_trace(std::size_t single_run) {
+    // A recorded trace is replayed for every run, only the name of the result differs.
+    if (const char* recorded_path = std::getenv("ALLOCATION_TRACE"))
+        return trace_replayer{allocation_trace{recorded_path}};
+
+    // Every request of the service allocates a few objects of a size between 16 bytes and 4 KiB, and frees them in any order at its end.
+    // About one object in sixteen lives on, for instance in a cache, until it is evicted by a later request. The last ones are never freed.
+    std::mt19937_64 random_generator{single_run}; // The same run always generates the same trace.
+    std::vector<trace_record> service_records{}; // The records of the generated trace.
+    std::vector<std::uint64_t> request_objects{}; // The objects of the current request.
+    std::vector<std::uint64_t> cached_objects{}; // The objects that outlive their request.
+    std::uint64_t next_identifier = 1; // The identifier of the next object.
+
+    // This adds a single call to the trace. Every request runs on one of four threads.
+    auto add_record = [&] (trace_operation operation, std::uint64_t identifier, std::uint64_t number_of_bytes, std::size_t request) {
+        service_records.push_back(trace_record{service_records.size(), identifier, number_of_bytes, static_cast<std::uint32_t>(request % 4), operation, {}});
+    };
+
+    for (std::size_t request = 0; request < single_run * 10; request++) {
+        for (std::size_t i = 0; i < 1 + random_generator() % 8; i++) {
+            auto number_of_bytes = (std::uint64_t{16} << random_generator() % 8) + random_generator() % 16 * 8; // Mostly small, now and then a few KiB.
+            add_record(trace_operation::allocate, next_identifier, number_of_bytes, request);
+            (random_generator() % 16 == 0 ? cached_objects : request_objects).push_back(next_identifier++);
+        }
+
+        std::shuffle(request_objects.begin(), request_objects.end(), random_generator);
+
+        for (const auto& single_object : request_objects)
+            add_record(trace_operation::deallocate, single_object, 0, request);
+
+        request_objects.clear();
+
+        // A full cache evicts a random object.
+        if (cached_objects.size() > 64) {
+            std::swap(cached_objects[random_generator() % cached_objects.size()], cached_objects.back());
+            add_record(trace_operation::deallocate, cached_objects.back(), 0, request);
+            cached_objects.pop_back();
+        }
+    }
+
+    // The trace goes through a file, just like a recorded trace.
+    auto trace_path = (std::filesystem::temp_directory_path() / ("allocator_benchmark_" + std::to_string(single_run) + ".trace")).string(); // A file of this run only.
+    allocation_trace::write(trace_path, service_records);
+
+    trace_replayer service_replayer{allocation_trace{trace_path}}; // The replayer no longer needs the file.
+    std::filesystem::remove(trace_path);
+
+    return service_replayer;
+}
+
+// This method pins a thread to a single core. The threads go round robin over the cores of the machine.
+void allocator_benchmark::pin_thread(std::thread &worker_thread, std::size_t thread_index) {
+    cpu_set_t core_set; // The set with the single core of this thread.
+    CPU_ZERO(&core_set);
+    CPU_SET(thread_index % std::max(std::thread::hardware_concurrency(), 1u), &core_set);
+
+    pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set_t), &core_set); // Without the permission to pin, the thread just keeps running unpinned.
+}
+
+// This method allocates a chunk, under the lock.
+void *allocator_benchmark::shared_locked_pool::allocate() {
+    std::lock_guard<std::mutex> pool_lock{m_pool_mutex};
+    return m_pool.allocate();
+}
+
+// This method gives a chunk back, under the lock.
+void allocator_benchmark::shared_locked_pool::deallocate(void *memory) noexcept {
+    std::lock_guard<std::mutex> pool_lock{m_pool_mutex};
+    m_pool.deallocate(static_cast<chunk<int>*>(memory));
+}
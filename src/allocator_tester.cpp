@@ -1,5 +1,21 @@
 #include "allocator_tester.h"
 
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <array> // Include here all the 'array' facilities.
+#include <atomic> // Include here all the 'atomic' facilities.
+#include <cmath> // Include here all the 'cmath' facilities.
+#include <filesystem> // Include here all the 'filesystem' facilities.
+#include <fstream> // Include here all the 'fstream' facilities.
+#include <list> // Include here all the 'list' facilities.
+#include <map> // Include here all the 'map' facilities.
+#include <memory_resource> // Include here all the 'memory_resource' facilities.
+#include <numeric> // Include here all the 'numeric' facilities.
+#include <set> // Include here all the 'set' facilities.
+#include <stdexcept> // Include here all the 'stdexcept' facilities.
+#include <string> // Include here all the 'string' facilities.
+#include <unordered_map> // Include here all the 'unordered_map' facilities.
+#include <thread> // Include here all the 'thread' facilities.
+
 // This static method validates the memory pool with integers.
 void allocator_tester::pool_validate_int() {
     std::cout << "---- MEMORY POOL VALIDATOR INTEGERS ----" << std::endl;
@@ -108,58 +124,1766 @@ void allocator_tester::pool_validate_compound() {
     std::cout << "Initializing... Creating a 'memory pool' with 3 chunks (compound types - 'task_compound')..." << std::endl;
 
     pool_allocator<task_compound> allocator{3}; // The allocator with initially three chunks per block.
-    std::vector<chunk<task_compound>*> task_vec_allocated{}; // A vector that will contain addresses.
+    std::vector<task_compound*> task_vec_allocated{}; // A vector that will contain the addresses of the objects.
 
-    // Assign these values to the allocated memory.
+    // Construct these values within the allocated memory.
     for (const auto& single_task : {task_compound{1, "Alice"}, task_compound{4, "Bob"}, task_compound{1, "Eve"}, task_compound{7, "Sam"}, task_compound{9, "Robert"}}) {
-        auto chunk_of_data = allocator.allocate(); // Get memory.
-        chunk_of_data->m_data = single_task; // Assign the value.
-        task_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'task_vec_allocated' vector.
+        auto* constructed_task = allocator.emplace(single_task); // Construct a copy within a chunk. The memory of a chunk is raw, so a string can not be assigned to it.
+        task_vec_allocated.push_back(constructed_task); // Add the allocated address to the 'task_vec_allocated' vector.
     }
 
     // This is a few assertions to test our memory pool allocator.
-    ASSERT_EQ("Alice", task_vec_allocated[0]->m_data.m_person_to_task, "The expected value is 'Alice'!")
-    ASSERT_EQ("Bob", task_vec_allocated[1]->m_data.m_person_to_task, "The expected value is 'Bob'!")
-    ASSERT_EQ("Eve", task_vec_allocated[2]->m_data.m_person_to_task, "The expected value is 'Eve'!")
-    ASSERT_EQ("Sam", task_vec_allocated[3]->m_data.m_person_to_task, "The expected value is 'Sam'!")
-    ASSERT_EQ("Robert", task_vec_allocated[4]->m_data.m_person_to_task, "The expected value is 'Robert'!")
-
-    ASSERT_EQ(1, task_vec_allocated[0]->m_data.m_priority, "The expected value is 1!")
-    ASSERT_EQ(4, task_vec_allocated[1]->m_data.m_priority, "The expected value is 4!")
-    ASSERT_EQ(1, task_vec_allocated[2]->m_data.m_priority, "The expected value is 1!")
-    ASSERT_EQ(7, task_vec_allocated[3]->m_data.m_priority, "The expected value is 7!")
-    ASSERT_EQ(9, task_vec_allocated[4]->m_data.m_priority, "The expected value is 9!")
-
-    allocator.deallocate(task_vec_allocated.back()); // Deallocate some memory.
+    ASSERT_EQ("Alice", task_vec_allocated[0]->m_person_to_task, "The expected value is 'Alice'!")
+    ASSERT_EQ("Bob", task_vec_allocated[1]->m_person_to_task, "The expected value is 'Bob'!")
+    ASSERT_EQ("Eve", task_vec_allocated[2]->m_person_to_task, "The expected value is 'Eve'!")
+    ASSERT_EQ("Sam", task_vec_allocated[3]->m_person_to_task, "The expected value is 'Sam'!")
+    ASSERT_EQ("Robert", task_vec_allocated[4]->m_person_to_task, "The expected value is 'Robert'!")
+
+    ASSERT_EQ(1, task_vec_allocated[0]->m_priority, "The expected value is 1!")
+    ASSERT_EQ(4, task_vec_allocated[1]->m_priority, "The expected value is 4!")
+    ASSERT_EQ(1, task_vec_allocated[2]->m_priority, "The expected value is 1!")
+    ASSERT_EQ(7, task_vec_allocated[3]->m_priority, "The expected value is 7!")
+    ASSERT_EQ(9, task_vec_allocated[4]->m_priority, "The expected value is 9!")
+
+    allocator.destroy(task_vec_allocated.back()); // Destroy the object, and deallocate its memory.
     task_vec_allocated.pop_back(); // Remove the address from the vector.
 
-    allocator.deallocate(task_vec_allocated.back()); // Deallocate some memory.
+    allocator.destroy(task_vec_allocated.back()); // Destroy the object, and deallocate its memory.
     task_vec_allocated.pop_back(); // Remove the address from the vector.
 
     // This is a few assertions to test our memory pool allocator.
-    ASSERT_EQ("Alice", task_vec_allocated[0]->m_data.m_person_to_task, "The expected value is 'Alice'!")
-    ASSERT_EQ("Bob", task_vec_allocated[1]->m_data.m_person_to_task, "The expected value is 'Bob'!")
-    ASSERT_EQ("Eve", task_vec_allocated[2]->m_data.m_person_to_task, "The expected value is 'Eve'!")
+    ASSERT_EQ("Alice", task_vec_allocated[0]->m_person_to_task, "The expected value is 'Alice'!")
+    ASSERT_EQ("Bob", task_vec_allocated[1]->m_person_to_task, "The expected value is 'Bob'!")
+    ASSERT_EQ("Eve", task_vec_allocated[2]->m_person_to_task, "The expected value is 'Eve'!")
 
-    ASSERT_EQ(1, task_vec_allocated[0]->m_data.m_priority, "The expected value is 1!")
-    ASSERT_EQ(4, task_vec_allocated[1]->m_data.m_priority, "The expected value is 4!")
-    ASSERT_EQ(1, task_vec_allocated[2]->m_data.m_priority, "The expected value is 1!")
+    ASSERT_EQ(1, task_vec_allocated[0]->m_priority, "The expected value is 1!")
+    ASSERT_EQ(4, task_vec_allocated[1]->m_priority, "The expected value is 4!")
+    ASSERT_EQ(1, task_vec_allocated[2]->m_priority, "The expected value is 1!")
 
-    // Assign these values to the allocated memory.
+    // Construct these values within the allocated memory.
     for (const auto& single_task : {task_compound{11, "John"}, task_compound{44, "Gina"}, task_compound{11, "Jade"}}) {
-        auto chunk_of_data = allocator.allocate(); // Get memory.
-        chunk_of_data->m_data = single_task; // Assign the value.
-        task_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'task_vec_allocated' vector.
+        auto* constructed_task = allocator.emplace(single_task); // Construct a copy within a chunk. The memory of a chunk is raw, so a string can not be assigned to it.
+        task_vec_allocated.push_back(constructed_task); // Add the allocated address to the 'task_vec_allocated' vector.
     }
 
     // This is a few assertions to test our memory pool allocator.
-    ASSERT_EQ("John", task_vec_allocated[3]->m_data.m_person_to_task, "The expected value is 'John'!")
-    ASSERT_EQ("Gina", task_vec_allocated[4]->m_data.m_person_to_task, "The expected value is 'Gina'!")
-    ASSERT_EQ("Jade", task_vec_allocated[5]->m_data.m_person_to_task, "The expected value is 'Jade'!")
+    ASSERT_EQ("John", task_vec_allocated[3]->m_person_to_task, "The expected value is 'John'!")
+    ASSERT_EQ("Gina", task_vec_allocated[4]->m_person_to_task, "The expected value is 'Gina'!")
+    ASSERT_EQ("Jade", task_vec_allocated[5]->m_person_to_task, "The expected value is 'Jade'!")
+
+    ASSERT_EQ(11, task_vec_allocated[3]->m_priority, "The expected value is 11!")
+    ASSERT_EQ(44, task_vec_allocated[4]->m_priority, "The expected value is 44!")
+    ASSERT_EQ(11, task_vec_allocated[5]->m_priority, "The expected value is 11!")
 
-    ASSERT_EQ(11, task_vec_allocated[3]->m_data.m_priority, "The expected value is 11!")
-    ASSERT_EQ(44, task_vec_allocated[4]->m_data.m_priority, "The expected value is 44!")
-    ASSERT_EQ(11, task_vec_allocated[5]->m_data.m_priority, "The expected value is 11!")
+    // Destroy the rest of the objects, so that their strings are freed as well.
+    for (auto* single_task : task_vec_allocated)
+        allocator.destroy(single_task);
 
     std::cout << "---- END MEMORY POOL VALIDATOR COMPOUND TYPE ----" << std::endl;
-}
\ No newline at end of file
+}
+
+// This static method validates that a chunk does not need more memory than its data, or the address to the next chunk.
+void allocator_tester::pool_validate_chunk_footprint() {
+    // A data type that is bigger than an address, but with an odd size.
+    struct odd_compound {
+        char m_characters[13];
+    };
+
+    std::cout << "---- MEMORY POOL VALIDATOR CHUNK FOOTPRINT ----" << std::endl;
+    std::cout << "Initializing... Checking the size of chunks with 'char', 'int', 'double', 'odd_compound' and 'std::string'..." << std::endl;
+
+    // The size of a chunk is the biggest of the data and the address, rounded up to the alignment.
+    ASSERT_EQ(sizeof(void*), sizeof(chunk<char>), "A chunk with a 'char' must have the size of an address!")
+    ASSERT_EQ(sizeof(void*), sizeof(chunk<int>), "A chunk with an 'int' must have the size of an address!")
+    ASSERT_EQ(sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*), sizeof(chunk<double>), "A chunk with a 'double' must not be bigger than its data or an address!")
+    ASSERT_EQ(std::size_t{16}, sizeof(chunk<odd_compound>), "A chunk with 13 characters must be rounded up to 16 bytes!")
+    ASSERT_EQ(sizeof(std::string), sizeof(chunk<std::string>), "A chunk with a 'std::string' must have the size of the string!")
+
+    pool_allocator<int> allocator{4}; // The allocator with four chunks per block.
+    std::vector<chunk<int>*> integer_vec_allocated{}; // A vector that will contain addresses.
+
+    // The chunks of a single block must be right next to each other, without any extra memory for the address of the next chunk.
+    for (const auto& single_number : {1, 2, 3, 4}) {
+        auto chunk_of_data = allocator.allocate(); // Get memory.
+        chunk_of_data->m_data = single_number; // Assign the value.
+        integer_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'integer_vec_allocated' vector.
+    }
+
+    for (std::size_t i = 1; i < integer_vec_allocated.size(); i++)
+        ASSERT_EQ(sizeof(void*), static_cast<std::size_t>(reinterpret_cast<char*>(integer_vec_allocated[i]) - reinterpret_cast<char*>(integer_vec_allocated[i - 1])), "The chunks of a block must be next to each other!")
+
+    allocator.deallocate(integer_vec_allocated[1]); // Deallocate a chunk in the middle, its data is overwritten by the address to the next chunk.
+
+    // The other chunks may not be touched by deallocating.
+    ASSERT_EQ(1, integer_vec_allocated[0]->m_data, "The expected value is 1!")
+    ASSERT_EQ(3, integer_vec_allocated[2]->m_data, "The expected value is 3!")
+    ASSERT_EQ(4, integer_vec_allocated[3]->m_data, "The expected value is 4!")
+
+    std::cout << "---- END MEMORY POOL VALIDATOR CHUNK FOOTPRINT ----" << std::endl;
+}
+
+// This static method validates that chunks are given back to the block they were allocated from, also when there are multiple blocks.
+void allocator_tester::pool_validate_multi_block_deallocation() {
+    std::cout << "---- MEMORY POOL VALIDATOR MULTI BLOCK DEALLOCATION ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with 4 chunks (integers, rounded up to a page), filling 3 blocks..." << std::endl;
+
+    pool_allocator<int> allocator{4}; // The allocator with four chunks per block, rounded up to fill a whole page.
+    std::vector<chunk<int>*> integer_vec_allocated{}; // A vector that will contain addresses.
+    auto chunks_per_block = chunk_list<int>{4}.get_number_of_chunks(); // The real number of chunks of a block.
+
+    // Fill three whole blocks.
+    for (int i = 0; i < 3 * static_cast<int>(chunks_per_block); i++) {
+        auto chunk_of_data = allocator.allocate(); // Get memory.
+        chunk_of_data->m_data = i; // Assign the value.
+        integer_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'integer_vec_allocated' vector.
+    }
+
+    ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "The expected number of blocks is 3!")
+
+    // Every chunk must know its own block. The chunks are handed out block by block.
+    for (std::size_t i = 0; i < integer_vec_allocated.size(); i++)
+        ASSERT_EQ(i / chunks_per_block, chunk_list<int>::find_block_index(integer_vec_allocated[i]), "A chunk does not know its own block!")
+
+    // Free the whole first block, in a mixed order (first the even chunks, then the odd ones). The current block is the last one, so these chunks must not end up in there.
+    std::set<chunk<int>*> first_block_addresses{}; // The addresses of the first block.
+
+    for (std::size_t i = 0; i < chunks_per_block; i++) {
+        auto mixed_index = i < (chunks_per_block + 1) / 2 ? 2 * i : 2 * (i - (chunks_per_block + 1) / 2) + 1;
+        first_block_addresses.insert(integer_vec_allocated[mixed_index]);
+        allocator.deallocate(integer_vec_allocated[mixed_index]); // Deallocate some memory.
+    }
+
+    ASSERT_EQ(chunks_per_block, first_block_addresses.size(), "The whole first block must be freed!")
+
+    // The chunks of the other blocks may not be touched.
+    for (std::size_t i = chunks_per_block; i < integer_vec_allocated.size(); i++)
+        ASSERT_EQ(static_cast<int>(i), integer_vec_allocated[i]->m_data, "A chunk of another block was overwritten!")
+
+    // Allocating again must reuse exactly the chunks of the first block, without creating a new block.
+    for (std::size_t i = 0; i < chunks_per_block; i++)
+        ASSERT_TRUE(first_block_addresses.count(allocator.allocate()) == 1, "A chunk of the first block was not reused!")
+
+    ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "No new block may be created while there are free chunks!")
+
+    // Churn: free and allocate chunks of all the blocks many times. The number of blocks must stay the same.
+    for (int round = 0; round < 100; round++) {
+        for (std::size_t i = round % 3; i < integer_vec_allocated.size(); i += 3)
+            allocator.deallocate(integer_vec_allocated[i]); // Deallocate some memory.
+
+        for (std::size_t i = round % 3; i < integer_vec_allocated.size(); i += 3)
+            integer_vec_allocated[i] = allocator.allocate(); // Get memory.
+    }
+
+    ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "The number of blocks may not grow under churn!")
+
+    std::cout << "---- END MEMORY POOL VALIDATOR MULTI BLOCK DEALLOCATION ----" << std::endl;
+}
+
+// This static method validates that fully free blocks are given back to the operating system, both explicitly and automatically.
+void allocator_tester::pool_validate_trim() {
+    std::cout << "---- MEMORY POOL VALIDATOR TRIM ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with 1024 chunks (integers, rounded up to a page), filling 8 blocks..." << std::endl;
+
+    pool_allocator<int> allocator{1024}; // The allocator with 1024 chunks per block, by default it keeps a single warm block.
+    std::vector<chunk<int>*> integer_vec_allocated{}; // A vector that will contain addresses.
+    auto chunks_per_block = static_cast<int>(chunk_list<int>{1024}.get_number_of_chunks()); // The real number of chunks of a block, rounded up to fill its last page.
+
+    // Fill eight whole blocks.
+    for (int i = 0; i < 8 * chunks_per_block; i++)
+        integer_vec_allocated.push_back(allocator.allocate()); // Get memory.
+
+    ASSERT_EQ(std::size_t{0}, allocator.get_number_of_warm_blocks(), "There may not be any warm block while all the chunks are in use!")
+
+    for (auto* free_memory_addresses : integer_vec_allocated)
+        allocator.deallocate(free_memory_addresses); // Deallocate memory.
+
+    ASSERT_EQ(std::size_t{8}, allocator.get_number_of_warm_blocks(), "Without automatic trimming, all the free blocks must stay warm!")
+
+    auto block_size = memory_mapping::round_to_pages(sizeof(std::size_t) + 1024 * sizeof(chunk<int>)); // The size of a single block, with its header.
+    auto reclaimed_bytes = allocator.trim(); // Give all the blocks but one back.
+
+    ASSERT_EQ(7 * block_size, reclaimed_bytes, "Trimming must give back seven whole blocks!")
+    ASSERT_EQ(std::size_t{1}, allocator.get_number_of_warm_blocks(), "Trimming must keep a single warm block!")
+    ASSERT_EQ(std::size_t{0}, allocator.trim(), "A second trim has nothing left to give back!")
+
+    // The released blocks must be usable again.
+    integer_vec_allocated.clear();
+
+    for (int i = 0; i < 8 * chunks_per_block; i++) {
+        auto chunk_of_data = allocator.allocate(); // Get memory.
+        chunk_of_data->m_data = i; // Assign the value.
+        integer_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'integer_vec_allocated' vector.
+    }
+
+    for (int i = 0; i < 8 * chunks_per_block; i++)
+        ASSERT_EQ(i, integer_vec_allocated[i]->m_data, "A released block was not usable again!")
+
+    ASSERT_EQ(std::size_t{8}, allocator.get_number_of_blocks(), "Released blocks must be reused, instead of creating new ones!")
+
+    for (auto* free_memory_addresses : integer_vec_allocated)
+        allocator.deallocate(free_memory_addresses); // Deallocate memory.
+
+    std::cout << "Initializing... Creating a 'memory pool' with 1024 chunks (integers), that automatically decommits above 2 warm blocks..." << std::endl;
+
+    pool_allocator<int> automatic_allocator{1024, {.m_warm_blocks = 2, .m_automatic_trim = true, .m_release_mode = trim_release_mode::decommit}}; // The allocator that trims by itself.
+    integer_vec_allocated.clear();
+
+    for (int i = 0; i < 8 * chunks_per_block; i++)
+        integer_vec_allocated.push_back(automatic_allocator.allocate()); // Get memory.
+
+    for (auto* free_memory_addresses : integer_vec_allocated)
+        automatic_allocator.deallocate(free_memory_addresses); // Deallocate memory.
+
+    ASSERT_EQ(std::size_t{2}, automatic_allocator.get_number_of_warm_blocks(), "Automatic trimming must keep exactly two warm blocks!")
+    ASSERT_EQ(6 * (block_size - memory_mapping::page_size()), automatic_allocator.get_reclaimed_bytes(), "Decommitting must give back all the pages but the header page of six blocks!")
+
+    // The decommitted blocks must be usable again.
+    integer_vec_allocated.clear();
+
+    for (int i = 0; i < 8 * chunks_per_block; i++) {
+        auto chunk_of_data = automatic_allocator.allocate(); // Get memory.
+        chunk_of_data->m_data = i; // Assign the value.
+        integer_vec_allocated.push_back(chunk_of_data); // Add the allocated address to the 'integer_vec_allocated' vector.
+    }
+
+    for (int i = 0; i < 8 * chunks_per_block; i++)
+        ASSERT_EQ(i, integer_vec_allocated[i]->m_data, "A decommitted block was not usable again!")
+
+    ASSERT_EQ(std::size_t{8}, automatic_allocator.get_number_of_blocks(), "Decommitted blocks must be reused, instead of creating new ones!")
+
+    std::cout << "---- END MEMORY POOL VALIDATOR TRIM ----" << std::endl;
+}
+
+// This static method validates the memory pool allocator, the block allocator and the 'mmap' allocator on huge pages. It also passes when the system has no huge pages at all.
+void allocator_tester::pool_validate_huge_pages() {
+    std::cout << "---- MEMORY POOL VALIDATOR HUGE PAGES ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' on transparent and on explicit huge pages, with 1000 chunks (integers)..." << std::endl;
+
+    // Both huge page modes must work, also when they fall back on normal pages.
+    for (const auto& single_mode : {page_mode::transparent_huge, page_mode::explicit_huge}) {
+        pool_options huge_options{}; // The options with huge pages.
+        huge_options.m_page_mode = single_mode;
+
+        pool_allocator<int> allocator{1000, huge_options}; // The allocator with blocks of a single huge page.
+        std::vector<chunk<int>*> integer_vec_allocated{}; // A vector that will contain addresses.
+        auto chunks_per_block = static_cast<int>(chunk_list<int>{1000, 0, single_mode}.get_number_of_chunks()); // The chunks fill the whole huge page.
+
+        for (int i = 0; i < 3 * chunks_per_block; i++) {
+            integer_vec_allocated.push_back(allocator.allocate());
+            integer_vec_allocated.back()->m_data = i;
+        }
+
+        for (int i = 0; i < 3 * chunks_per_block; i++)
+            ASSERT_EQ(i, integer_vec_allocated[i]->m_data, "A chunk on a huge page lost its value!")
+
+        for (auto& single_chunk : integer_vec_allocated)
+            allocator.deallocate(single_chunk);
+
+        ASSERT_EQ(std::size_t{2} * memory_mapping::huge_page_size(), allocator.trim(1), "Every block on huge pages must be a whole huge page!")
+
+        mmap_allocator<int> huge_mmap{single_mode}; // The 'mmap' allocator on huge pages.
+        auto* huge_memory = huge_mmap.allocate(1000);
+
+        ASSERT_EQ(std::uintptr_t{0}, reinterpret_cast<std::uintptr_t>(huge_memory) % memory_mapping::huge_page_size(), "Memory on huge pages must be aligned to a huge page!")
+        ASSERT_TRUE(huge_mmap != mmap_allocator<int>{} && huge_mmap == mmap_allocator<double>{huge_mmap}, "Only allocators with the same pages must be equal!")
+
+        huge_memory[999] = 42;
+        huge_mmap.deallocate(huge_memory, 1000);
+
+        block_allocator<double> huge_blocks{single_mode}; // The block allocator on huge pages.
+        auto* huge_block = huge_blocks.allocate(100);
+
+        ASSERT_EQ(std::uintptr_t{0}, reinterpret_cast<std::uintptr_t>(huge_block) % memory_mapping::huge_page_size(), "A block on huge pages must be aligned to a huge page!")
+        huge_blocks.deallocate(huge_block, 100);
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR HUGE PAGES ----" << std::endl;
+}
+
+// This static method validates that blocks fill their last page, and that the blocks grow when a growth factor is given.
+void allocator_tester::pool_validate_growth() {
+    std::cout << "---- MEMORY POOL VALIDATOR GROWTH ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with 32 chunks (integers) that stays fixed, and one that doubles every block..." << std::endl;
+
+    // A block of 32 chunks only uses a part of its page, so it must be filled up to the whole page.
+    ASSERT_EQ(memory_mapping::page_size(), chunk_list<int>{32}.get_size_block(), "A block must fill its last page!")
+    ASSERT_EQ(chunk_block_alignment, chunk_list<int>{chunk_block_alignment}.get_size_block(), "A block may never be bigger than its alignment!")
+
+    static constexpr std::size_t number_of_chunks = 100000; // The number of chunks that both allocators allocate.
+
+    pool_options geometric_options{}; // The options with a growth factor.
+    geometric_options.m_growth_factor = 2;
+
+    pool_allocator<int> fixed_allocator{32}; // The allocator whereby every block has the same size.
+    pool_allocator<int> geometric_allocator{32, geometric_options}; // The allocator whereby every block is twice as big as the one before.
+    std::vector<chunk<int>*> fixed_vec_allocated{}; // A vector that will contain the addresses of the fixed allocator.
+    std::vector<chunk<int>*> geometric_vec_allocated{}; // A vector that will contain the addresses of the geometric allocator.
+
+    auto system_calls_before = memory_mapping::get_number_of_system_calls(); // The system calls until now.
+
+    for (std::size_t i = 0; i < number_of_chunks; i++) {
+        geometric_vec_allocated.push_back(geometric_allocator.allocate());
+        geometric_vec_allocated.back()->m_data = static_cast<int>(i);
+    }
+
+    ASSERT_TRUE(memory_mapping::get_number_of_system_calls() > system_calls_before, "Mapping new blocks must be counted as system calls!")
+
+    for (std::size_t i = 0; i < number_of_chunks; i++)
+        fixed_vec_allocated.push_back(fixed_allocator.allocate());
+
+    auto chunks_per_block = chunk_list<int>{32}.get_number_of_chunks(); // The number of chunks of a single page.
+
+    ASSERT_EQ((number_of_chunks + chunks_per_block - 1) / chunks_per_block, fixed_allocator.get_number_of_blocks(), "Without a growth factor every block must have the same size!")
+    ASSERT_TRUE(geometric_allocator.get_number_of_blocks() <= 8, "With a growth factor the number of blocks must grow logarithmically!")
+
+    for (std::size_t i = 0; i < number_of_chunks; i++)
+        ASSERT_EQ(static_cast<int>(i), geometric_vec_allocated[i]->m_data, "A chunk of a growing block lost its value!")
+
+    for (std::size_t i = 0; i < number_of_chunks; i++) {
+        fixed_allocator.deallocate(fixed_vec_allocated[i]);
+        geometric_allocator.deallocate(geometric_vec_allocated[i]);
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR GROWTH ----" << std::endl;
+}
+
+// This static method validates linked, lazy and prefaulted blocks, also when their chunks are reused after a decommit.
+void allocator_tester::pool_validate_fill_modes() {
+    std::cout << "---- MEMORY POOL VALIDATOR FILL MODES ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with linked, lazy and prefaulted blocks of 1000 chunks (integers), filling 3 blocks..." << std::endl;
+
+    auto chunks_per_block = static_cast<int>(chunk_list<int>{1000}.get_number_of_chunks()); // The real number of chunks of a block, that fill two pages.
+    auto block_size = chunk_list<int>{1000}.get_size_block(); // The number of bytes of a block.
+
+    for (const auto& single_mode : {block_fill_mode::linked, block_fill_mode::lazy, block_fill_mode::prefaulted}) {
+        pool_options fill_options{}; // The options with the fill mode, whereby the blocks are decommitted instead of unmapped.
+        fill_options.m_fill_mode = single_mode;
+        fill_options.m_release_mode = trim_release_mode::decommit;
+
+        pool_allocator<int> allocator{1000, fill_options}; // The allocator with blocks of two pages.
+        std::vector<chunk<int>*> integer_vec_allocated{allocator.allocate()}; // A vector that will contain addresses.
+
+        // Only a lazy block leaves the pages after the first chunk alone.
+        auto* first_block = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(integer_vec_allocated.front()) & ~(chunk_block_alignment - 1));
+        auto expected_resident = single_mode == block_fill_mode::lazy ? memory_mapping::page_size() : block_size; // The bytes that must be in physical memory.
+
+        ASSERT_EQ(expected_resident, memory_mapping::get_resident_bytes(first_block, block_size), "A new block faulted in the wrong number of pages!")
+
+        for (int i = 1; i < 3 * chunks_per_block; i++)
+            integer_vec_allocated.push_back(allocator.allocate());
+
+        for (int i = 0; i < 3 * chunks_per_block; i++)
+            integer_vec_allocated[i]->m_data = i;
+
+        for (int i = 0; i < 3 * chunks_per_block; i++)
+            ASSERT_EQ(i, integer_vec_allocated[i]->m_data, "A chunk overlaps with another chunk!")
+
+        ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "Every block must hand out all its chunks before a new block is mapped!")
+
+        // Give everything back, in reverse order, and decommit the blocks. Their chunks must be prepared again when they are reused.
+        for (auto it = integer_vec_allocated.rbegin(); it != integer_vec_allocated.rend(); ++it)
+            allocator.deallocate(*it);
+
+        allocator.trim(0);
+
+        std::set<chunk<int>*> reused_addresses{}; // The addresses after the decommit.
+
+        for (int i = 0; i < 3 * chunks_per_block; i++)
+            reused_addresses.insert(allocator.allocate());
+
+        ASSERT_EQ(static_cast<std::size_t>(3 * chunks_per_block), reused_addresses.size(), "A chunk was handed out twice after a decommit!")
+        ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "The decommitted blocks must be reused!")
+
+        for (auto* single_chunk : reused_addresses)
+            allocator.deallocate(single_chunk);
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR FILL MODES ----" << std::endl;
+}
+
+// This static method validates the alignment of every pointer returned by the memory pool allocator and the 'malloc', 'mmap' and 'new' allocators, for over-aligned types and for a given alignment.
+void allocator_tester::pool_validate_alignment() {
+    // A data type for SIMD instructions, that must be aligned to 32 bytes.
+    struct alignas(32) simd_vector {
+        float m_lanes[8];
+    };
+
+    std::cout << "---- MEMORY POOL VALIDATOR ALIGNMENT ----" << std::endl;
+    std::cout << "Initializing... Creating 'memory pools' and standard allocators with 32, 64 and 128 bytes of alignment..." << std::endl;
+
+    // Check whether an address is a multiple of the alignment.
+    auto is_aligned = [](const void* memory_address, std::size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(memory_address) % alignment == 0;
+    };
+
+    // A chunk is aligned like its data, and its size is rounded up to this alignment.
+    ASSERT_EQ(std::size_t{32}, alignof(chunk<simd_vector>), "A chunk must be aligned like its over-aligned data!")
+    ASSERT_EQ(std::size_t{64}, alignof(chunk<std::uint64_t, 64>), "A chunk must be aligned like its alignment parameter!")
+    ASSERT_EQ(std::size_t{64}, sizeof(chunk<std::uint64_t, 64>), "A chunk must fill a whole cache line with an alignment of 64 bytes!")
+    ASSERT_EQ(sizeof(void*), sizeof(chunk<int, 1>), "A smaller alignment may never weaken the alignment of a chunk!")
+
+    // Fill several blocks, and check every chunk and its data.
+    auto validate_pool = [&](auto& allocator, std::size_t alignment) {
+        std::vector<decltype(allocator.allocate())> vec_allocated{}; // A vector that will contain addresses.
+
+        for (int i = 0; i < 3000; i++) {
+            vec_allocated.push_back(allocator.allocate());
+            ASSERT_TRUE(is_aligned(vec_allocated.back(), alignment) && is_aligned(&vec_allocated.back()->m_data, alignment), "A chunk of a 'memory pool' is not aligned!")
+        }
+
+        for (auto* single_chunk : vec_allocated)
+            allocator.deallocate(single_chunk);
+    };
+
+    pool_allocator<simd_vector> simd_pool{100}; // The over-aligned type aligns its chunks itself.
+    pool_allocator<std::uint64_t, 64> counter_pool{100}; // Counters, every counter on a cache line of its own.
+    pool_allocator<char, 128> char_pool{100}; // The alignment is much bigger than the data.
+
+    validate_pool(simd_pool, 32);
+    validate_pool(counter_pool, 64);
+    validate_pool(char_pool, 128);
+
+    // Allocate several sizes with a standard allocator, and check every returned pointer.
+    auto validate_allocator = [&](auto allocator, std::size_t alignment) {
+        for (std::size_t number_of_elements : {1, 3, 100, 5000}) {
+            auto* allocated_memory = allocator.allocate(number_of_elements);
+            ASSERT_TRUE(is_aligned(allocated_memory, alignment), "A standard allocator returned memory that is not aligned!")
+            allocator.deallocate(allocated_memory, number_of_elements);
+        }
+    };
+
+    validate_allocator(malloc_allocator<simd_vector>{}, 32);
+    validate_allocator(malloc_allocator<int>{64}, 64);
+    validate_allocator(mmap_allocator<int>{std::size_t{64 * 1024}}, 64 * 1024);
+    validate_allocator(new_allocator<simd_vector>{}, 32);
+    validate_allocator(new_allocator<int>{128}, 128);
+
+    // A rebound allocator keeps its alignment.
+    ASSERT_EQ(std::size_t{64}, malloc_allocator<double>{malloc_allocator<int>{64}}.get_alignment(), "A rebound allocator must keep its alignment!")
+
+    // A size that wraps around when it is rounded up to the alignment, must fail instead of handing out a tiny block.
+    bool overflow_rejected = false; // True when the huge request is rejected.
+
+    try {
+        [[maybe_unused]] auto* wrapped_memory = malloc_allocator<int>{64}.allocate(std::numeric_limits<std::size_t>::max() / sizeof(int));
+    }
+    catch (const std::bad_alloc&) {
+        overflow_rejected = true;
+    }
+
+    ASSERT_TRUE(overflow_rejected, "A size that overflows with its alignment must be rejected!")
+    ASSERT_TRUE(new_allocator<double>{new_allocator<int>{64}} == new_allocator<int>{64}, "A rebound allocator must be equal to the original one!")
+    ASSERT_TRUE(new_allocator<int>{64} != new_allocator<int>{}, "Allocators with another alignment must not be equal!")
+
+    std::vector<int, malloc_allocator<int>> aligned_vec{malloc_allocator<int>{64}}; // A vector whose buffer starts at a cache line.
+
+    for (int i = 0; i < 1000; i++) {
+        aligned_vec.push_back(i);
+        ASSERT_TRUE(is_aligned(aligned_vec.data(), 64), "The buffer of a vector is not aligned!")
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR ALIGNMENT ----" << std::endl;
+}
+
+// This static method validates that the 'new' allocator only hands out raw memory, so that a container constructs and destroys every element exactly once.
+void allocator_tester::new_validate_raw_storage() {
+    static int constructed_elements{0}; // The number of elements that were constructed, in every way.
+    static int destroyed_elements{0}; // The number of elements that were destroyed.
+
+    // A data type that counts its constructors and its destructor.
+    struct counted_element {
+        counted_element() { constructed_elements++; }
+        counted_element(const counted_element&) { constructed_elements++; }
+        counted_element(counted_element&&) noexcept { constructed_elements++; }
+        ~counted_element() { destroyed_elements++; }
+    };
+
+    std::cout << "---- NEW ALLOCATOR VALIDATOR RAW STORAGE ----" << std::endl;
+    std::cout << "Initializing... Creating a vector with a 'new' allocator (compound types - 'counted_element')..." << std::endl;
+
+    new_allocator<counted_element> allocator{}; // The allocator that hands out raw memory.
+    auto* raw_memory = allocator.allocate(100);
+
+    ASSERT_EQ(0, constructed_elements, "Allocating may not construct any element!")
+
+    allocator.deallocate(raw_memory, 100);
+    ASSERT_EQ(0, destroyed_elements, "Deallocating may not destroy any element!")
+
+    // The vector reserves its memory first, so that its elements are never moved.
+    {
+        std::vector<counted_element, new_allocator<counted_element>> element_vec{allocator}; // The vector with counted elements.
+        element_vec.reserve(50);
+
+        for (int i = 0; i < 50; i++)
+            element_vec.emplace_back();
+
+        ASSERT_EQ(50, constructed_elements, "Every element must be constructed exactly once!")
+    }
+
+    ASSERT_EQ(50, destroyed_elements, "Every element must be destroyed exactly once!")
+
+    // The memory of an over-aligned allocator is also raw, and goes to the aligned 'delete' with its size.
+    new_allocator<counted_element> aligned_allocator{256}; // The allocator that uses the aligned 'new'.
+    auto* aligned_memory = aligned_allocator.allocate(10);
+
+    ASSERT_EQ(std::uintptr_t{0}, reinterpret_cast<std::uintptr_t>(aligned_memory) % 256, "The aligned 'new' must respect the alignment!")
+    ASSERT_EQ(50, constructed_elements, "Allocating aligned memory may not construct any element!")
+
+    aligned_allocator.deallocate(aligned_memory, 10);
+
+    std::cout << "---- END NEW ALLOCATOR VALIDATOR RAW STORAGE ----" << std::endl;
+}
+
+// This static method validates allocating and deallocating batches of chunks at once, also mixed with single chunks.
+void allocator_tester::pool_validate_bulk() {
+    std::cout << "---- MEMORY POOL VALIDATOR BULK ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with 1000 chunks (integers), allocating batches of 3 whole blocks..." << std::endl;
+
+    // Both a linked block and a lazy block must hand out batches.
+    for (const auto& single_mode : {block_fill_mode::linked, block_fill_mode::lazy}) {
+        pool_options bulk_options{}; // The options with the fill mode.
+        bulk_options.m_fill_mode = single_mode;
+
+        pool_allocator<int> allocator{1000, bulk_options}; // The allocator with blocks of two pages.
+        auto chunks_per_block = chunk_list<int>{1000}.get_number_of_chunks(); // The real number of chunks of a block.
+        std::vector<chunk<int>*> integer_vec_allocated(3 * chunks_per_block); // A vector that will contain addresses. The blocks are full, so a new block has no fresh chunks to hand out first.
+
+        allocator.allocate_bulk(integer_vec_allocated.size(), integer_vec_allocated.data());
+
+        for (std::size_t i = 0; i < integer_vec_allocated.size(); i++)
+            integer_vec_allocated[i]->m_data = static_cast<int>(i);
+
+        for (std::size_t i = 0; i < integer_vec_allocated.size(); i++)
+            ASSERT_EQ(static_cast<int>(i), integer_vec_allocated[i]->m_data, "A chunk of a batch overlaps with another chunk!")
+
+        ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "A batch must fill every block before a new block is created!")
+
+        // Give back every other chunk, so that the chains are short and switch between the blocks.
+        std::vector<chunk<int>*> odd_chunks{}; // The chunks that are given back.
+        std::set<chunk<int>*> odd_addresses{}; // The addresses of these chunks.
+
+        for (std::size_t i = 1; i < integer_vec_allocated.size(); i += 2) {
+            odd_chunks.push_back(integer_vec_allocated[i]);
+            odd_addresses.insert(integer_vec_allocated[i]);
+        }
+
+        std::reverse(odd_chunks.begin(), odd_chunks.end()); // The order within a batch does not matter.
+        allocator.deallocate_bulk(odd_chunks);
+
+        // A single allocation and a new batch must reuse exactly these chunks, without a new block.
+        std::vector<chunk<int>*> reused_chunks(odd_chunks.size() - 1); // The chunks of the new batch.
+        odd_addresses.erase(allocator.allocate());
+        allocator.allocate_bulk(reused_chunks.size(), reused_chunks.data());
+
+        for (auto* single_chunk : reused_chunks)
+            ASSERT_TRUE(odd_addresses.erase(single_chunk) == 1, "A batch must reuse the chunks that were given back!")
+
+        ASSERT_TRUE(odd_addresses.empty(), "All the chunks that were given back must be reused!")
+        ASSERT_EQ(std::size_t{3}, allocator.get_number_of_blocks(), "Reusing chunks may not create a new block!")
+
+        // Give everything back at once, single chunks and batches mixed. All the blocks must be warm afterwards.
+        for (std::size_t i = 0; i < integer_vec_allocated.size(); i += 2)
+            allocator.deallocate(integer_vec_allocated[i]);
+
+        allocator.deallocate_bulk(odd_chunks);
+        ASSERT_EQ(allocator.get_number_of_blocks(), allocator.get_number_of_warm_blocks(), "All the blocks must be fully free after the batches are given back!")
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR BULK ----" << std::endl;
+}
+
+// This static method validates constructing and destroying objects within the memory pool allocator, also with a 'pool_unique_ptr' and a throwing constructor.
+void allocator_tester::pool_validate_objects() {
+    // A data type that counts its living objects. Its constructor throws on request.
+    struct counted_object {
+        counted_object(int& live_objects, const std::string& name, bool must_throw = false) : m_live_objects{live_objects}, m_name{name} {
+            if (must_throw)
+                throw std::runtime_error{"The constructor of 'counted_object' failed!"};
+
+            m_live_objects++;
+        }
+
+        ~counted_object() { m_live_objects--; }
+
+        int& m_live_objects; // The number of living objects.
+        std::string m_name; // A field with memory of its own.
+    };
+
+    std::cout << "---- MEMORY POOL VALIDATOR OBJECTS ----" << std::endl;
+    std::cout << "Initializing... Creating two 'memory pools' with 16 chunks (compound types - 'counted_object')..." << std::endl;
+
+    ASSERT_EQ(sizeof(counted_object*), sizeof(pool_unique_ptr<counted_object>), "A 'pool_unique_ptr' must be as big as a raw pointer!")
+
+    int live_objects{0}; // The number of living objects of both pools.
+    pool_allocator<counted_object> first_allocator{16}; // The first allocator.
+    pool_allocator<counted_object> second_allocator{16}; // The second allocator, its objects must find their way back to it.
+
+    std::vector<counted_object*> raw_objects{}; // The objects that are destroyed by hand.
+    std::vector<pool_unique_ptr<counted_object>> unique_objects{}; // The objects that are destroyed automatically.
+
+    // Construct objects in both pools, with names that do not fit in the string itself.
+    for (int i = 0; i < 10; i++) {
+        raw_objects.push_back(first_allocator.emplace(live_objects, "A raw object that is constructed in a chunk " + std::to_string(i)));
+        unique_objects.push_back((i % 2 == 0 ? first_allocator : second_allocator).emplace_unique(live_objects, "A unique object that is constructed in a chunk " + std::to_string(i)));
+    }
+
+    ASSERT_EQ(20, live_objects, "Every object must be constructed exactly once!")
+    ASSERT_EQ("A raw object that is constructed in a chunk 9", raw_objects.back()->m_name, "The expected value is 'A raw object that is constructed in a chunk 9'!")
+    ASSERT_EQ("A unique object that is constructed in a chunk 9", unique_objects.back()->m_name, "The expected value is 'A unique object that is constructed in a chunk 9'!")
+
+    // Destroy everything. Every unique pointer gives its chunk back to its own pool.
+    for (auto* single_object : raw_objects)
+        first_allocator.destroy(single_object);
+
+    unique_objects.clear();
+
+    ASSERT_EQ(0, live_objects, "Every object must be destroyed exactly once!")
+    ASSERT_EQ(first_allocator.get_number_of_blocks(), first_allocator.get_number_of_warm_blocks(), "All the chunks of the first pool must be given back!")
+    ASSERT_EQ(second_allocator.get_number_of_blocks(), second_allocator.get_number_of_warm_blocks(), "All the chunks of the second pool must be given back!")
+
+    // A throwing constructor may not leave a chunk in use.
+    bool has_thrown{false}; // Indication whether the constructor threw.
+
+    try {
+        [[maybe_unused]] auto failed_object = second_allocator.emplace_unique(live_objects, "A failing object", true);
+    }
+    catch (const std::runtime_error&) {
+        has_thrown = true;
+    }
+
+    ASSERT_TRUE(has_thrown, "The exception of the constructor must reach the caller!")
+    ASSERT_EQ(0, live_objects, "An object whose constructor threw must not be counted!")
+    ASSERT_EQ(second_allocator.get_number_of_blocks(), second_allocator.get_number_of_warm_blocks(), "The chunk of a failed constructor must be given back!")
+
+    std::cout << "---- END MEMORY POOL VALIDATOR OBJECTS ----" << std::endl;
+}
+
+// This static method validates the local NUMA mode. On a machine with a single node, it validates that everything degrades to that node.
+void allocator_tester::pool_validate_numa() {
+    auto number_of_numa_nodes = memory_mapping::get_number_of_numa_nodes(); // The number of nodes of this machine.
+
+    std::cout << "---- MEMORY POOL VALIDATOR NUMA ----" << std::endl;
+    std::cout << "Initializing... Creating a 'memory pool' with 1000 chunks (integers) for every mode, on a machine with " << number_of_numa_nodes << " NUMA node(s)..." << std::endl;
+
+    ASSERT_TRUE(memory_mapping::get_current_numa_node() < number_of_numa_nodes, "The node of the calling thread must be an online node!")
+
+    // Without NUMA, all the blocks belong to a single list. With the local mode, every node has a list of its own.
+    for (const auto& single_mode : {numa_mode::none, numa_mode::local}) {
+        pool_options numa_options{}; // The options with the NUMA mode.
+        numa_options.m_numa_mode = single_mode;
+
+        pool_allocator<int> allocator{1000, numa_options}; // The allocator with blocks of two pages.
+        auto number_of_lists = single_mode == numa_mode::local ? number_of_numa_nodes : 1; // The expected number of lists.
+        std::vector<chunk<int>*> integer_vec_allocated(3 * chunk_list<int>{1000}.get_number_of_chunks()); // Exactly three blocks on a single node.
+
+        ASSERT_EQ(number_of_lists, allocator.get_number_of_numa_nodes(), "The allocator must keep a list for every node in the local mode, and a single list otherwise!")
+
+        for (auto& single_chunk : integer_vec_allocated) {
+            single_chunk = allocator.allocate();
+            single_chunk->m_data = 42; // Touch the page, so that it is placed.
+        }
+
+        std::vector<std::size_t> placed_chunks(number_of_lists); // The number of chunks on every node, as told by the operating system.
+        std::size_t unknown_chunks{0}; // The number of chunks the operating system can not place, for instance without NUMA support.
+
+        for (auto* single_chunk : integer_vec_allocated) {
+            auto numa_node = memory_mapping::find_numa_node(single_chunk);
+
+            if (numa_node == memory_mapping::any_numa_node)
+                unknown_chunks++;
+            else
+                placed_chunks[single_mode == numa_mode::local ? numa_node : 0]++;
+        }
+
+        numa_node_usage total_usage{}; // The usage of all the nodes together.
+
+        for (std::size_t numa_node = 0; numa_node < allocator.get_number_of_numa_nodes(); numa_node++) {
+            auto node_usage = allocator.get_numa_node_usage(numa_node);
+
+            // A bound block must be backed by its own node, so the operating system must agree with the bookkeeping.
+            if (unknown_chunks == 0)
+                ASSERT_EQ(placed_chunks[numa_node], node_usage.m_used_chunks, "The chunks of a node must be backed by the memory of that node!")
+
+            total_usage.m_number_of_blocks += node_usage.m_number_of_blocks;
+            total_usage.m_used_chunks += node_usage.m_used_chunks;
+            total_usage.m_resident_bytes += node_usage.m_resident_bytes;
+        }
+
+        ASSERT_EQ(allocator.get_number_of_blocks(), total_usage.m_number_of_blocks, "Every block must belong to exactly one node!")
+        ASSERT_EQ(integer_vec_allocated.size(), total_usage.m_used_chunks, "Every used chunk must be counted on exactly one node!")
+        ASSERT_TRUE(total_usage.m_resident_bytes >= allocator.get_number_of_blocks() * memory_mapping::page_size(), "Every used block must be resident!")
+
+        // Give everything back. The chunks go back to the blocks of their own node.
+        for (auto* single_chunk : integer_vec_allocated)
+            allocator.deallocate(single_chunk);
+
+        for (std::size_t numa_node = 0; numa_node < allocator.get_number_of_numa_nodes(); numa_node++)
+            ASSERT_EQ(std::size_t{0}, allocator.get_numa_node_usage(numa_node).m_used_chunks, "All the chunks of every node must be free again!")
+    }
+
+    std::cout << "---- END MEMORY POOL VALIDATOR NUMA ----" << std::endl;
+}
+
+// This static method validates the guarded memory pool allocator. Every misuse must be reported, and must leave the free list intact.
+void allocator_tester::pool_validate_guarded() {
+    using small_object = std::array<std::uint64_t, 4>; // An object with room for poison after the address to the next chunk.
+
+    static std::size_t detected_violations[4]{}; // The number of detected misuses, for every kind of misuse.
+    auto count_violation = [](pool_violation violation, [[maybe_unused]] const void* memory) noexcept { detected_violations[static_cast<std::size_t>(violation)]++; }; // Count instead of printing.
+    auto number_of_violations = [](pool_violation violation) { return detected_violations[static_cast<std::size_t>(violation)]; };
+
+    std::cout << "---- MEMORY POOL VALIDATOR GUARDED ----" << std::endl;
+
+    // Run all the checks with both fill modes, and with guard pages.
+    for (auto single_mode : {pool_debug_mode::guarded, pool_debug_mode::guard_pages}) {
+        for (auto fill_mode : {block_fill_mode::linked, block_fill_mode::lazy}) {
+            std::cout << "Initializing... Creating two guarded 'memory pools' with 64 chunks (compound types - 'small_object')..." << std::endl;
+
+            std::fill(std::begin(detected_violations), std::end(detected_violations), 0);
+
+            pool_options guarded_options{}; // The options that check every chunk.
+            guarded_options.m_debug_mode = single_mode;
+            guarded_options.m_fill_mode = fill_mode;
+            guarded_options.m_violation_handler = count_violation;
+
+            pool_allocator<small_object> allocator{64, guarded_options}; // The allocator that is misused.
+            pool_allocator<small_object> other_allocator{64, guarded_options}; // The allocator that gets a chunk of the first one.
+
+            // Fill several blocks, and write every byte of the data. Writing within the data is never a misuse.
+            std::vector<chunk<small_object>*> vec_allocated{}; // A vector that will contain addresses.
+
+            for (std::uint64_t i = 0; i < 500; i++) {
+                vec_allocated.push_back(allocator.allocate());
+                vec_allocated.back()->m_data.fill(i);
+            }
+
+            std::sort(vec_allocated.begin(), vec_allocated.end());
+            ASSERT_TRUE(std::adjacent_find(vec_allocated.begin(), vec_allocated.end()) == vec_allocated.end(), "A guarded pool handed out the same chunk twice!")
+
+            for (auto* single_chunk : vec_allocated)
+                allocator.deallocate(single_chunk);
+
+            // The chunks come back from the free lists, still poisoned.
+            for (auto& single_chunk : vec_allocated)
+                single_chunk = allocator.allocate();
+
+            allocator.deallocate_bulk(vec_allocated);
+
+            ASSERT_EQ(std::size_t{0}, std::accumulate(std::begin(detected_violations), std::end(detected_violations), std::size_t{0}), "Using a guarded pool correctly may not report anything!")
+
+            // A double free is reported, and ignored. The chunk is not handed out twice afterwards.
+            auto* freed_chunk = allocator.allocate();
+            allocator.deallocate(freed_chunk);
+            allocator.deallocate(freed_chunk);
+
+            ASSERT_EQ(std::size_t{1}, number_of_violations(pool_violation::double_free), "A double free must be reported!")
+            ASSERT_TRUE(allocator.allocate() != allocator.allocate(), "A double free may not corrupt the free list!")
+
+            // A chunk of another pool is reported, and ignored.
+            auto* foreign_chunk = allocator.allocate();
+            other_allocator.deallocate(foreign_chunk);
+
+            ASSERT_EQ(std::size_t{1}, number_of_violations(pool_violation::foreign_chunk), "A chunk of another pool must be reported!")
+
+            // Writing past the data overwrites the canary after the chunk.
+            auto* overflowing_chunk = allocator.allocate();
+            reinterpret_cast<unsigned char*>(overflowing_chunk)[sizeof(chunk<small_object>)] = 0;
+            allocator.deallocate(overflowing_chunk);
+
+            ASSERT_EQ(std::size_t{1}, number_of_violations(pool_violation::buffer_overflow), "An overflow must be reported!")
+
+            // Writing to a freed chunk changes its poison, this is found when it is handed out again.
+            auto* dangling_chunk = allocator.allocate();
+            allocator.deallocate(dangling_chunk);
+            dangling_chunk->m_data[3] = 42;
+
+            ASSERT_EQ(dangling_chunk, allocator.allocate(), "The last freed chunk must be handed out first!")
+            ASSERT_EQ(std::size_t{1}, number_of_violations(pool_violation::use_after_free), "A write after a free must be reported!")
+
+            // Overwriting the address to the next chunk is reported as well, and the free list is rebuilt. All the chunks must still be handed out only once.
+            auto* first_chunk = allocator.allocate();
+            auto* second_chunk = allocator.allocate();
+            allocator.deallocate(second_chunk);
+            allocator.deallocate(first_chunk);
+            first_chunk->m_next_node = first_chunk;
+
+            std::vector<chunk<small_object>*> vec_rebuilt{}; // The chunks after the rebuild.
+
+            for (int i = 0; i < 100; i++)
+                vec_rebuilt.push_back(allocator.allocate());
+
+            std::sort(vec_rebuilt.begin(), vec_rebuilt.end());
+
+            ASSERT_EQ(std::size_t{2}, number_of_violations(pool_violation::use_after_free), "An overwritten free list must be reported!")
+            ASSERT_TRUE(std::adjacent_find(vec_rebuilt.begin(), vec_rebuilt.end()) == vec_rebuilt.end(), "A rebuilt free list handed out the same chunk twice!")
+        }
+    }
+
+    // An object that is destroyed twice only runs its destructor once.
+    std::fill(std::begin(detected_violations), std::end(detected_violations), 0);
+
+    pool_options guarded_options{}; // The options that check every chunk.
+    guarded_options.m_debug_mode = pool_debug_mode::guarded;
+    guarded_options.m_violation_handler = count_violation;
+
+    pool_allocator<std::string> string_allocator{16, guarded_options}; // The allocator with objects that own memory.
+    auto* string_object = string_allocator.emplace("A string that is too long for the small buffer of a string");
+
+    string_allocator.destroy(string_object);
+    string_allocator.destroy(string_object);
+
+    ASSERT_EQ(std::size_t{1}, number_of_violations(pool_violation::double_free), "Destroying an object twice must be reported!")
+
+    std::cout << "---- END MEMORY POOL VALIDATOR GUARDED ----" << std::endl;
+}
+
+// This static method validates the size class allocator within a vector, a string and an unordered map.
+void allocator_tester::size_class_validate_containers() {
+    using pool_string = std::basic_string<char, std::char_traits<char>, size_class_allocator<char>>; // A string with the size class allocator.
+
+    std::cout << "---- SIZE CLASS VALIDATOR CONTAINERS ----" << std::endl;
+    std::cout << "Initializing... Creating a 'size class pool', shared by a vector, strings and an unordered map..." << std::endl;
+
+    auto shared_pool = std::make_shared<size_class_pool>(); // The pool that all the containers share.
+    size_class_allocator<int> allocator{shared_pool}; // The allocator that refers to the pool.
+
+    // A rebound allocator refers to the same pool, so it must be equal.
+    ASSERT_TRUE(size_class_allocator<double>{allocator} == allocator, "A rebound allocator must be equal to the original one!")
+    ASSERT_TRUE(size_class_allocator<int>{} != allocator, "An allocator with another pool must not be equal!")
+
+    std::vector<int, size_class_allocator<int>> integer_vec{allocator}; // The vector grows through all the size classes, and above the largest one.
+
+    for (int i = 0; i < 10000; i++)
+        integer_vec.push_back(i);
+
+    for (int i = 0; i < 10000; i++)
+        ASSERT_EQ(i, integer_vec[i], "The vector lost a value while it was growing!")
+
+    std::vector<pool_string, size_class_allocator<pool_string>> string_vec{allocator}; // Strings of mixed lengths, so of mixed size classes.
+
+    for (std::size_t i = 0; i < 200; i++)
+        string_vec.emplace_back(i * 7, static_cast<char>('a' + i % 26), size_class_allocator<char>{allocator});
+
+    for (std::size_t i = 0; i < 200; i++)
+        ASSERT_TRUE(string_vec[i].size() == i * 7 && string_vec[i].find_first_not_of(static_cast<char>('a' + i % 26)) == pool_string::npos, "A string lost its characters!")
+
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<>, size_class_allocator<std::pair<const int, int>>> integer_map{0, std::hash<int>{}, std::equal_to<>{}, allocator}; // The nodes and the buckets come from the pool.
+
+    for (int i = 0; i < 5000; i++)
+        integer_map[i] = i * i;
+
+    for (int i = 0; i < 5000; i += 2)
+        integer_map.erase(i);
+
+    ASSERT_EQ(std::size_t{2500}, integer_map.size(), "The map must contain only the odd keys!")
+
+    for (int i = 1; i < 5000; i += 2)
+        ASSERT_EQ(i * i, integer_map.at(i), "The map lost a value!")
+
+    // Memory of the one allocator can be deallocated by an equal one, also for a large request above the largest size class.
+    auto* large_memory = allocator.allocate(10000);
+    large_memory[9999] = 42;
+    size_class_allocator<int>{size_class_allocator<char>{allocator}}.deallocate(large_memory, 10000);
+
+    std::cout << "Initializing... Using a vector again, after it is moved..." << std::endl;
+
+    // A moved-from allocator keeps its pool, so the moved-from vector can grow again.
+    std::vector<int, size_class_allocator<int>> moved_vec{allocator}; // The vector that is moved.
+    moved_vec.push_back(1);
+
+    auto target_vec = std::move(moved_vec); // The vector that takes over the memory.
+    moved_vec.clear(); // A moved-from vector is only valid, so bring it into a known state.
+    moved_vec.push_back(3);
+
+    ASSERT_TRUE(moved_vec.get_allocator() == allocator, "A moved-from allocator must still be equal to its old value!")
+    ASSERT_TRUE(moved_vec.size() == 1 && moved_vec[0] == 3 && target_vec.size() == 1 && target_vec[0] == 1, "Both vectors must keep their own values!")
+
+    std::cout << "Initializing... Allocating over-aligned requests, up to an alignment above a page..." << std::endl;
+
+    for (auto alignment : {std::size_t{32}, std::size_t{64}, std::size_t{256}, std::size_t{4096}, 2 * memory_mapping::page_size()}) {
+        for (auto number_of_bytes : {std::size_t{1}, std::size_t{8}, std::size_t{100}, alignment + 1}) {
+            auto* aligned_memory = shared_pool->allocate(number_of_bytes, alignment); // The over-aligned request.
+
+            ASSERT_EQ(std::uintptr_t{0}, reinterpret_cast<std::uintptr_t>(aligned_memory) % alignment, "An over-aligned request must be aligned!")
+            std::memset(aligned_memory, 0xAB, number_of_bytes);
+            shared_pool->deallocate(aligned_memory, number_of_bytes, alignment);
+        }
+    }
+
+    // A small over-aligned object must come from a memory pool, instead of costing a page of its own.
+    shared_pool->deallocate(shared_pool->allocate(8, 64), 8, 64);
+    auto system_calls = memory_mapping::get_number_of_system_calls(); // The number of system calls, after the memory pool has its block.
+    std::vector<void*> aligned_objects{}; // The small over-aligned objects.
+
+    for (int i = 0; i < 100; i++)
+        aligned_objects.push_back(shared_pool->allocate(8, 64));
+
+    ASSERT_EQ(system_calls, memory_mapping::get_number_of_system_calls(), "A small over-aligned request must come from a memory pool!")
+
+    for (auto* single_object : aligned_objects)
+        shared_pool->deallocate(single_object, 8, 64);
+
+    std::cout << "---- END SIZE CLASS VALIDATOR CONTAINERS ----" << std::endl;
+}
+
+// This static method validates the memory pool node adapter within a list, a map, a set and an unordered map.
+void allocator_tester::pool_node_validate_containers() {
+    std::cout << "---- MEMORY POOL NODE VALIDATOR CONTAINERS ----" << std::endl;
+    std::cout << "Initializing... Creating a 'pool node registry', shared by a list, a map, a set and an unordered map..." << std::endl;
+
+    auto shared_registry = std::make_shared<pool_node_registry>(64); // The registry that all the containers share, with small blocks.
+    pool_node_allocator<int> allocator{shared_registry}; // The allocator that refers to the registry.
+
+    // A rebound allocator refers to the same registry, so it must be equal.
+    ASSERT_TRUE(pool_node_allocator<double>{allocator} == allocator, "A rebound allocator must be equal to the original one!")
+    ASSERT_TRUE(pool_node_allocator<int>{} != allocator, "An allocator with another registry must not be equal!")
+
+    std::list<int, pool_node_allocator<int>> integer_list{allocator}; // Every element of the list is a node.
+
+    for (int i = 0; i < 1000; i++)
+        integer_list.push_back(i);
+
+    integer_list.remove_if([] (const int& value) { return value % 3 == 0; });
+
+    ASSERT_EQ(std::size_t{666}, integer_list.size(), "The list must not contain the multiples of three anymore!")
+
+    std::map<int, int, std::less<>, pool_node_allocator<std::pair<const int, int>>> integer_map{allocator}; // Every element of the map is a node.
+
+    for (int i = 0; i < 1000; i++)
+        integer_map[i] = i * i;
+
+    for (int i = 0; i < 1000; i += 2)
+        integer_map.erase(i);
+
+    for (int i = 1; i < 1000; i += 2)
+        ASSERT_EQ(i * i, integer_map.at(i), "The map lost a value!")
+
+    std::set<int, std::less<>, pool_node_allocator<int>> integer_set{allocator}; // Every element of the set is a node.
+
+    for (int i = 0; i < 1000; i++)
+        integer_set.insert(999 - i);
+
+    ASSERT_TRUE(integer_set.size() == 1000 && std::is_sorted(integer_set.begin(), integer_set.end()), "The set must contain all the keys, sorted!")
+
+    std::unordered_map<int, int, std::hash<int>, std::equal_to<>, pool_node_allocator<std::pair<const int, int>>> integer_unordered_map{0, std::hash<int>{}, std::equal_to<>{}, allocator}; // The nodes come from a memory pool, the buckets come from 'new'.
+
+    for (int i = 0; i < 1000; i++)
+        integer_unordered_map[i] = -i;
+
+    for (int i = 0; i < 1000; i++)
+        ASSERT_EQ(-i, integer_unordered_map.at(i), "The unordered map lost a value!")
+
+    // A node allocated by the one container can be deallocated by the other, because the allocators are equal.
+    auto moved_map = std::move(integer_map);
+    moved_map.clear();
+
+    // A moved-from allocator keeps its registry, so the moved-from map can be filled again.
+    integer_map.clear(); // A moved-from map is only valid, so bring it into a known state.
+    integer_map[2] = 2;
+
+    ASSERT_TRUE(integer_map.get_allocator().get_registry() == shared_registry, "A moved-from allocator must still refer to its registry!")
+    ASSERT_TRUE(integer_map.size() == 1 && integer_map.at(2) == 2, "A moved-from map must be usable again!")
+    integer_map.clear();
+
+    // Default constructed allocators have registries of their own, so a swap must take the allocators with the nodes.
+    std::map<int, int, std::less<>, pool_node_allocator<std::pair<const int, int>>> swapped_map{}; // The map that gets the nodes of the other map.
+
+    {
+        std::map<int, int, std::less<>, pool_node_allocator<std::pair<const int, int>>> default_map{}; // The map that is destroyed after the swap.
+
+        for (int i = 0; i < 100; i++)
+            default_map[i] = i;
+
+        default_map.swap(swapped_map);
+    }
+
+    for (int i = 100; i < 200; i++)
+        swapped_map[i] = i;
+
+    ASSERT_TRUE(swapped_map.size() == 200 && swapped_map.at(42) == 42 && swapped_map.at(142) == 142, "A swapped map must keep its nodes after the other map is destroyed!")
+
+    auto list_copy = integer_list; // The copy refers to the same registry.
+    list_copy.splice(list_copy.end(), integer_list);
+
+    ASSERT_EQ(std::size_t{1332}, list_copy.size(), "Splicing between equal allocators must move the nodes!")
+    ASSERT_TRUE(shared_registry->get_number_of_pools() >= 3, "The different node types must have their own memory pools!")
+
+    std::cout << "---- END MEMORY POOL NODE VALIDATOR CONTAINERS ----" << std::endl;
+}
+
+// This static method validates the monotonic arena. It checks the initial buffer, the alignment, big requests and the reuse of the blocks after a reset.
+void allocator_tester::arena_validate_reset() {
+    std::cout << "---- MONOTONIC ARENA VALIDATOR RESET ----" << std::endl;
+    std::cout << "Initializing... Creating a 'monotonic arena' with a buffer of 256 bytes on the stack, and blocks of 4096 bytes..." << std::endl;
+
+    alignas(std::max_align_t) std::byte stack_buffer[256]; // The buffer the arena starts with.
+    monotonic_arena arena{stack_buffer, sizeof(stack_buffer), 4096}; // The arena with small blocks, so that it needs multiple blocks.
+
+    auto* first_memory = static_cast<std::byte*>(arena.allocate(100));
+
+    ASSERT_TRUE(first_memory == stack_buffer, "The first request must come from the buffer on the stack!")
+    ASSERT_EQ(std::size_t{0}, arena.get_number_of_blocks(), "No block may be mapped while the buffer still has room!")
+
+    // Every alignment must be respected, also the ones bigger than a page.
+    for (std::size_t alignment = 1; alignment <= 8192; alignment *= 2) {
+        auto memory_address = reinterpret_cast<std::uintptr_t>(arena.allocate(24, alignment));
+        ASSERT_EQ(std::uintptr_t{0}, memory_address % alignment, "The arena must respect the alignment of a request!")
+    }
+
+    auto* big_memory = static_cast<std::byte*>(arena.allocate(3 * 4096)); // This request is bigger than a block, it gets a block of its own.
+    big_memory[3 * 4096 - 1] = std::byte{42};
+
+    std::vector<int, arena_allocator<int>> integer_vec{arena_allocator<int>{arena}}; // The vector leaves its old arrays behind, until the reset.
+
+    for (int i = 0; i < 2000; i++)
+        integer_vec.push_back(i);
+
+    for (int i = 0; i < 2000; i++)
+        ASSERT_EQ(i, integer_vec[i], "The vector lost a value while it was growing!")
+
+    auto number_of_blocks = arena.get_number_of_blocks(); // The number of blocks of the first round.
+
+    integer_vec = std::vector<int, arena_allocator<int>>{arena_allocator<int>{arena}}; // Forget the memory, before the arena is reset.
+    arena.reset();
+
+    ASSERT_EQ(std::size_t{0}, arena.get_allocated_bytes(), "A reset must free all the memory at once!")
+    ASSERT_TRUE(arena.allocate(100) == stack_buffer, "After a reset, the arena must start within the buffer again!")
+
+    // A second round of the same requests must reuse the kept blocks, without mapping new ones.
+    for (int i = 0; i < 2000; i++)
+        integer_vec.push_back(i);
+
+    ASSERT_TRUE(arena.get_number_of_blocks() <= number_of_blocks, "The second round must reuse the blocks kept by the reset!")
+
+    integer_vec = std::vector<int, arena_allocator<int>>{arena_allocator<int>{arena}};
+    arena.release();
+
+    ASSERT_EQ(std::size_t{0}, arena.get_number_of_blocks(), "A release must unmap all the blocks!")
+
+    // A size that wraps around with its alignment, must fail instead of handing out nothing.
+    bool overflow_rejected = false; // True when the huge request is rejected.
+
+    try {
+        [[maybe_unused]] auto* wrapped_memory = monotonic_arena{}.allocate(std::numeric_limits<std::size_t>::max() - 8, 16);
+    }
+    catch (const std::bad_alloc&) {
+        overflow_rejected = true;
+    }
+
+    ASSERT_TRUE(overflow_rejected, "A size that overflows with its alignment must be rejected!")
+
+    std::cout << "---- END MONOTONIC ARENA VALIDATOR RESET ----" << std::endl;
+}
+
+// This static method validates the cache of mapped regions. It checks the reuse without system calls, the merging of regions, the growth and the high-water mark.
+void allocator_tester::mmap_validate_cache() {
+    constexpr std::size_t kilobyte = 1024; // A single kilobyte, so that the sizes below are readable.
+
+    std::cout << "---- MMAP CACHE VALIDATOR ----" << std::endl;
+    std::cout << "Initializing... Creating a 'mapping cache' with a high-water mark of 1 MiB, used by an 'mmap' allocator..." << std::endl;
+
+    mapping_cache cache{1024 * kilobyte}; // The cache, it keeps at most 1 MiB.
+    mmap_allocator<char> allocator{cache}; // The allocator that uses the cache.
+
+    ASSERT_TRUE(mmap_allocator<int>{allocator} == allocator, "A rebound allocator must refer to the same cache!")
+    ASSERT_TRUE(mmap_allocator<char>{} != allocator, "An allocator without a cache must not be equal!")
+
+    // A region that is given back is reused by the next allocation that fits, without any system call.
+    auto* first_region = allocator.allocate(192 * kilobyte);
+    allocator.deallocate(first_region, 192 * kilobyte);
+
+    auto system_calls = memory_mapping::get_number_of_system_calls(); // The number of system calls before the reuse.
+    auto* reused_region = allocator.allocate(192 * kilobyte);
+
+    ASSERT_EQ(first_region, reused_region, "A cached region must be reused!")
+    ASSERT_EQ(system_calls, memory_mapping::get_number_of_system_calls(), "Reusing a cached region may not make a system call!")
+    ASSERT_EQ(std::size_t{1}, cache.get_number_of_hits(), "The reuse must count as a hit!")
+
+    // Split the region into three parts, and give them back in a different order. They must be merged into a single region again.
+    allocator.deallocate(reused_region, 192 * kilobyte);
+
+    std::vector<char*> split_regions{}; // The three parts.
+
+    for (int i = 0; i < 3; i++)
+        split_regions.push_back(allocator.allocate(64 * kilobyte));
+
+    ASSERT_EQ(first_region + 64 * kilobyte, split_regions[1], "The parts of a split region must follow each other!")
+    ASSERT_EQ(first_region + 128 * kilobyte, split_regions[2], "The parts of a split region must follow each other!")
+
+    allocator.deallocate(split_regions[0], 64 * kilobyte);
+    allocator.deallocate(split_regions[2], 64 * kilobyte);
+    allocator.deallocate(split_regions[1], 64 * kilobyte);
+
+    ASSERT_EQ(std::size_t{1}, cache.get_number_of_cached_regions(), "Regions next to each other must be merged!")
+    ASSERT_EQ(192 * kilobyte, cache.get_cached_bytes(), "The merged region must contain all the parts!")
+
+    // A number of elements that wraps around in bytes, must fail instead of taking a small cached region.
+    bool overflow_rejected = false; // True when the huge request is rejected.
+
+    try {
+        [[maybe_unused]] auto* wrapped_memory = mmap_allocator<int>{allocator}.allocate(std::numeric_limits<std::size_t>::max() / 2);
+    }
+    catch (const std::bad_array_new_length&) {
+        overflow_rejected = true;
+    }
+
+    ASSERT_TRUE(overflow_rejected, "A size that overflows in bytes must be rejected!")
+
+    // A region grows in place, when the region right after it is cached.
+    auto* growing_region = allocator.allocate(64 * kilobyte);
+
+    for (std::size_t i = 0; i < 64 * kilobyte; i++)
+        growing_region[i] = static_cast<char>(i % 251);
+
+    system_calls = memory_mapping::get_number_of_system_calls();
+    auto* grown_region = allocator.reallocate(growing_region, 64 * kilobyte, 128 * kilobyte);
+
+    ASSERT_EQ(growing_region, grown_region, "A region must grow into the cached region right after it!")
+    ASSERT_EQ(system_calls, memory_mapping::get_number_of_system_calls(), "Growing in place may not make a system call!")
+
+    // Growing far beyond the cache moves the pages with 'mremap'. The content must be kept.
+    grown_region = allocator.reallocate(grown_region, 128 * kilobyte, 4096 * kilobyte);
+    bool is_content_kept{true}; // Indication whether all the bytes survived both resizes.
+
+    for (std::size_t i = 0; i < 64 * kilobyte; i++)
+        is_content_kept = is_content_kept && grown_region[i] == static_cast<char>(i % 251);
+
+    ASSERT_TRUE(is_content_kept, "Resizing a region must keep its content!")
+
+    // A region above the high-water mark is unmapped right away, and the cache never holds more than the mark.
+    allocator.deallocate(grown_region, 4096 * kilobyte);
+    ASSERT_TRUE(cache.get_cached_bytes() <= 1024 * kilobyte, "The cache may not hold more than its high-water mark!")
+
+    std::vector<char*> big_regions{}; // Regions that are together above the high-water mark.
+
+    for (int i = 0; i < 3; i++)
+        big_regions.push_back(allocator.allocate(512 * kilobyte));
+
+    for (auto* single_region : big_regions)
+        allocator.deallocate(single_region, 512 * kilobyte);
+
+    ASSERT_TRUE(cache.get_cached_bytes() <= 1024 * kilobyte, "The cache may not hold more than its high-water mark!")
+    ASSERT_TRUE(cache.get_cached_bytes() > 0, "The cache must keep regions below its high-water mark!")
+
+    cache.release();
+    ASSERT_EQ(std::size_t{0}, cache.get_cached_bytes(), "Releasing must unmap all the cached regions!")
+
+    std::cout << "---- END MMAP CACHE VALIDATOR ----" << std::endl;
+}
+
+// This static method validates growing memory in place with every allocator, and the 'growable_vector' that uses it, also with objects that are not trivially copyable.
+void allocator_tester::growable_validate_reallocation() {
+    std::cout << "---- GROWABLE VALIDATOR REALLOCATION ----" << std::endl;
+    std::cout << "Initializing... Growing memory of the 'malloc', 'mmap' and arena allocators, and 'growable vectors' on top of them..." << std::endl;
+
+    // The 'malloc' allocator keeps the content when it reallocates, and grows in place within the usable size.
+    malloc_allocator<int> malloc_memory{}; // The allocator that uses 'realloc'.
+    auto* malloc_integers = malloc_memory.allocate(16);
+
+    for (int i = 0; i < 16; i++)
+        malloc_integers[i] = i;
+
+    ASSERT_TRUE(malloc_memory.try_expand(malloc_integers, 16, 16), "Memory must always have room for its own size!")
+
+    malloc_integers = malloc_memory.reallocate(malloc_integers, 16, 100000);
+    malloc_integers[99999] = 42;
+
+    for (int i = 0; i < 16; i++)
+        ASSERT_EQ(i, malloc_integers[i], "Reallocating must keep the content!")
+
+    malloc_memory.deallocate(malloc_integers, 100000);
+
+    // The 'mmap' allocator grows within its last page, and moves its pages with 'mremap' otherwise.
+    mmap_allocator<int> mmap_memory{}; // The allocator that uses 'mremap'.
+    auto integers_per_page = memory_mapping::page_size() / sizeof(int); // The number of integers on a single page.
+    auto* mmap_integers = mmap_memory.allocate(10);
+
+    ASSERT_TRUE(mmap_memory.try_expand(mmap_integers, 10, integers_per_page), "A mapping must grow within its last page!")
+
+    for (std::size_t i = 0; i < integers_per_page; i++)
+        mmap_integers[i] = static_cast<int>(i);
+
+    mmap_integers = mmap_memory.reallocate(mmap_integers, integers_per_page, 64 * integers_per_page);
+    mmap_integers[64 * integers_per_page - 1] = 42;
+
+    for (std::size_t i = 0; i < integers_per_page; i++)
+        ASSERT_EQ(static_cast<int>(i), mmap_integers[i], "Remapping must keep the content!")
+
+    mmap_memory.deallocate(mmap_integers, 64 * integers_per_page);
+
+    // The arena only grows its last allocation.
+    monotonic_arena arena{}; // The arena with blocks of 64 KiB.
+    arena_allocator<int> arena_memory{arena}; // The allocator that bumps the pointer further.
+
+    auto* first_integers = arena_memory.allocate(10);
+    ASSERT_TRUE(arena_memory.try_expand(first_integers, 10, 100), "The last allocation of the arena must grow in place!")
+
+    auto* second_integers = arena_memory.allocate(10);
+    ASSERT_TRUE(!arena_memory.try_expand(first_integers, 100, 200), "An allocation that is not the last one may not grow!")
+    ASSERT_TRUE(!arena_memory.try_expand(second_integers, 10, 1000000), "An allocation may not grow beyond its block!")
+
+    // The traits know which allocator can grow memory, and which one can not.
+    ASSERT_TRUE(reallocation_traits<malloc_allocator<int>>::can_reallocate, "The 'malloc' allocator must be able to reallocate!")
+    ASSERT_TRUE(!reallocation_traits<new_allocator<int>>::can_expand, "The 'new' allocator can not grow memory in place!")
+    ASSERT_TRUE(!reallocation_traits<malloc_allocator<std::string>>::can_reallocate, "A string may not be moved bytewise!")
+
+    // A vector on the arena grows in place, while nothing else is allocated.
+    growable_vector<int, arena_allocator<int>> arena_vec{arena_allocator<int>{arena}}; // The vector that grows within the arena.
+
+    for (int i = 0; i < 5000; i++)
+        arena_vec.push_back(i);
+
+    for (int i = 0; i < 5000; i++)
+        ASSERT_EQ(i, arena_vec[i], "The vector lost a value while it was growing!")
+
+    ASSERT_TRUE(arena_vec.get_number_of_expansions() > 0, "The vector on the arena must grow in place!")
+
+    // A vector with 'malloc' lets 'realloc' move its buffer, it never copies the elements itself.
+    growable_vector<int> malloc_vec{}; // The vector that grows with 'realloc'.
+    malloc_vec.resize(100000);
+
+    for (int i = 0; i < 100000; i++)
+        malloc_vec.push_back(i);
+
+    ASSERT_EQ(std::size_t{200000}, malloc_vec.size(), "The vector must contain all the values!")
+    ASSERT_EQ(0, malloc_vec[99999], "A resized vector must contain value initialized elements!")
+    ASSERT_EQ(99999, malloc_vec[199999], "The vector lost a value while it was growing!")
+    ASSERT_EQ(std::size_t{0}, malloc_vec.get_number_of_copies(), "A vector with 'malloc' may not copy its elements!")
+
+    // The 'new' allocator can not grow anything, so the vector falls back to moving every element.
+    growable_vector<int, new_allocator<int>> new_vec{}; // The vector that must copy.
+
+    for (int i = 0; i < 1000; i++)
+        new_vec.push_back(i);
+
+    ASSERT_EQ(999, new_vec[999], "The vector lost a value while it was growing!")
+    ASSERT_TRUE(new_vec.get_number_of_copies() > 0, "A vector with the 'new' allocator must copy its elements!")
+
+    // Strings are not trivially copyable. They may only grow in place, or be moved one by one.
+    growable_vector<std::string> string_vec{}; // The vector with objects that own memory.
+
+    for (int i = 0; i < 1000; i++)
+        string_vec.emplace_back("a string that is too long for the small buffer " + std::to_string(i));
+
+    string_vec.push_back(string_vec[0]); // The new element refers to an element of the vector itself.
+
+    ASSERT_EQ(std::string{"a string that is too long for the small buffer 999"}, string_vec[999], "The vector lost a string while it was growing!")
+    ASSERT_EQ(string_vec[0], string_vec[1000], "Adding an element of the vector itself must copy it before the buffer moves!")
+    ASSERT_EQ(std::size_t{0}, string_vec.get_number_of_reallocations(), "Strings may not be moved bytewise!")
+
+    string_vec.pop_back();
+    string_vec.clear();
+    ASSERT_TRUE(string_vec.empty(), "A cleared vector must be empty!")
+
+    std::cout << "---- END GROWABLE VALIDATOR REALLOCATION ----" << std::endl;
+}
+
+// This static method validates all the polymorphic memory resources, by using them for the same containers, chosen at runtime.
+void allocator_tester::pmr_validate_resources() {
+    std::cout << "---- POLYMORPHIC MEMORY RESOURCE VALIDATOR ----" << std::endl;
+    std::cout << "Initializing... Creating a resource for 'malloc', 'mmap', 'new', memory pools and an arena..." << std::endl;
+
+    malloc_memory_resource malloc_resource{}; // The resource with 'malloc'.
+    mmap_memory_resource mmap_resource{}; // The resource with 'mmap'.
+    new_memory_resource new_resource{}; // The resource with 'new'.
+    pool_memory_resource pool_resource{}; // The resource with memory pools.
+    arena_memory_resource arena_resource{}; // The resource with a monotonic arena.
+
+    // The containers have the same type for every resource. Only the resource differs, at runtime.
+    for (std::pmr::memory_resource* single_resource : std::initializer_list<std::pmr::memory_resource*>{&malloc_resource, &mmap_resource, &new_resource, &pool_resource, &arena_resource}) {
+        std::pmr::vector<int> integer_vec{single_resource}; // A vector, that grows through all kinds of sizes.
+
+        for (int i = 0; i < 2000; i++)
+            integer_vec.push_back(i);
+
+        for (int i = 0; i < 2000; i++)
+            ASSERT_EQ(i, integer_vec[i], "The vector lost a value while it was growing!")
+
+        std::pmr::map<int, std::pmr::string> string_map{single_resource}; // A map with strings, the strings get the resource of the map.
+
+        for (int i = 0; i < 100; i++)
+            string_map.emplace(i, std::pmr::string(static_cast<std::size_t>(i), 'x'));
+
+        ASSERT_TRUE(string_map.at(99).size() == 99 && string_map.at(99).get_allocator().resource() == single_resource, "A string within the map must use the same resource!")
+
+        // Every alignment must be respected, also the ones bigger than a page.
+        for (std::size_t alignment = 1; alignment <= 8192; alignment *= 2) {
+            auto* aligned_memory = single_resource->allocate(40, alignment);
+            ASSERT_EQ(std::uintptr_t{0}, reinterpret_cast<std::uintptr_t>(aligned_memory) % alignment, "A resource must respect the alignment of a request!")
+            single_resource->deallocate(aligned_memory, 40, alignment);
+        }
+    }
+
+    // The stateless resources are equal to every instance of their own kind. The resources that own their memory are only equal to themselves.
+    ASSERT_TRUE(malloc_resource.is_equal(malloc_memory_resource{}) && !malloc_resource.is_equal(mmap_resource), "All the 'malloc' resources must be equal, and only them!")
+    ASSERT_TRUE(mmap_resource.is_equal(mmap_memory_resource{}) && new_resource.is_equal(new_memory_resource{}), "All the 'mmap' and 'new' resources must be equal!")
+    ASSERT_TRUE(pool_resource.is_equal(pool_resource) && !pool_resource.is_equal(pool_memory_resource{}), "A pool resource must only be equal to itself!")
+
+    std::cout << "---- END POLYMORPHIC MEMORY RESOURCE VALIDATOR ----" << std::endl;
+}
+
+// This static method validates the concurrent memory pool, whereby chunks are freed by another thread than the allocating one.
+void allocator_tester::concurrent_pool_validate_cross_thread() {
+    std::cout << "---- CONCURRENT MEMORY POOL VALIDATOR CROSS THREAD ----" << std::endl;
+    std::cout << "Initializing... Creating a 'concurrent memory pool' with 16 chunks, used by 4 threads (integers)..." << std::endl;
+
+    constexpr std::size_t number_of_threads = 4; // The number of threads that share the allocator.
+    constexpr std::size_t chunks_per_thread = 1000; // The number of chunks every thread allocates.
+
+    concurrent_pool_allocator<int> allocator{16, 8}; // The allocator with 16 chunks per block, and magazines of 8 chunks.
+    std::vector<std::vector<chunk<int>*>> thread_vec_allocated{number_of_threads}; // For every thread, a vector that will contain addresses.
+
+    // Let every thread allocate its own chunks, and assign a value that is unique for all the threads.
+    auto allocate_chunks = [&] (std::size_t thread_index) {
+        for (std::size_t i = 0; i < chunks_per_thread; i++) {
+            auto chunk_of_data = allocator.allocate(); // Get memory.
+            chunk_of_data->m_data = static_cast<int>(thread_index * chunks_per_thread + i); // Assign the value.
+            thread_vec_allocated[thread_index].push_back(chunk_of_data); // Add the allocated address to the vector of this thread.
+        }
+    };
+
+    std::vector<std::thread> worker_threads{}; // The threads that are using the allocator.
+
+    for (std::size_t i = 0; i < number_of_threads; i++)
+        worker_threads.emplace_back(allocate_chunks, i);
+
+    for (auto& single_thread : worker_threads)
+        single_thread.join();
+
+    worker_threads.clear();
+
+    std::set<chunk<int>*> unique_addresses{}; // A set with all the addresses. If two threads got the same chunk, this set is smaller.
+
+    // Check if every chunk still contains the value that its own thread assigned.
+    for (std::size_t i = 0; i < number_of_threads; i++) {
+        for (std::size_t j = 0; j < chunks_per_thread; j++) {
+            ASSERT_EQ(static_cast<int>(i * chunks_per_thread + j), thread_vec_allocated[i][j]->m_data, "A chunk was overwritten by another thread!")
+            unique_addresses.insert(thread_vec_allocated[i][j]);
+        }
+    }
+
+    ASSERT_EQ(number_of_threads * chunks_per_thread, unique_addresses.size(), "The same chunk was handed out twice!")
+
+    // Every thread frees the chunks of its neighbour. So every chunk is freed by another thread than the allocating one.
+    for (std::size_t i = 0; i < number_of_threads; i++) {
+        worker_threads.emplace_back([&, i] () {
+            for (auto* free_memory_addresses : thread_vec_allocated[(i + 1) % number_of_threads])
+                allocator.deallocate(free_memory_addresses); // Deallocate memory.
+        });
+    }
+
+    for (auto& single_thread : worker_threads)
+        single_thread.join();
+
+    worker_threads.clear();
+
+    for (auto& single_vector : thread_vec_allocated)
+        single_vector.clear();
+
+    // Allocate again. The freed chunks must be reused. Only the chunks that are still waiting in the magazines of other threads may be new.
+    for (std::size_t i = 0; i < number_of_threads; i++)
+        worker_threads.emplace_back(allocate_chunks, i);
+
+    for (auto& single_thread : worker_threads)
+        single_thread.join();
+
+    std::set<chunk<int>*> reused_addresses{}; // A set with all the addresses of the second round.
+    std::size_t number_of_new_addresses{0}; // The number of addresses that were not handed out in the first round.
+
+    for (const auto& single_vector : thread_vec_allocated) {
+        for (auto* single_address : single_vector) {
+            number_of_new_addresses += unique_addresses.count(single_address) == 0;
+            reused_addresses.insert(single_address);
+        }
+    }
+
+    ASSERT_TRUE(number_of_new_addresses <= number_of_threads * 2 * 8, "The freed chunks were not reused!")
+
+    ASSERT_EQ(number_of_threads * chunks_per_thread, reused_addresses.size(), "The same chunk was handed out twice after freeing!")
+
+    std::cout << "---- END CONCURRENT MEMORY POOL VALIDATOR CROSS THREAD ----" << std::endl;
+}
+
+// This static method stresses the lock-free free list, whereby multiple threads push and pop the same chunks at the same time.
+void allocator_tester::lock_free_stack_stress() {
+    std::cout << "---- LOCK-FREE FREE LIST STRESS TEST ----" << std::endl;
+    std::cout << "Initializing... Creating a lock-free free list with 64 chunks, shared by 8 threads (integers)..." << std::endl;
+
+    constexpr std::size_t number_of_chunks = 64; // The number of chunks on the free list. Less than the threads can hold, so there is a lot of contention.
+    constexpr std::size_t number_of_threads = 8; // The number of threads that push and pop at the same time.
+    constexpr std::size_t number_of_rounds = 20000; // The number of times every thread pops and pushes.
+
+    ASSERT_TRUE(lock_free_chunk_stack<int>{}.is_lock_free(), "The free list is not lock-free on this platform!")
+
+    chunk_list<int> single_block{number_of_chunks}; // The block that contains all the chunks.
+    lock_free_chunk_stack<int> free_list{}; // The shared free list.
+
+    for (std::size_t i = 0; i < number_of_chunks; i++)
+        free_list.push(single_block.get_free_chunk()); // Put all the chunks on the free list.
+
+    std::atomic<std::size_t> number_of_corruptions{0}; // The number of times a chunk was owned by two threads at the same time.
+    std::vector<std::thread> worker_threads{}; // The threads that are using the free list.
+
+    for (std::size_t i = 0; i < number_of_threads; i++) {
+        worker_threads.emplace_back([&, i] () {
+            std::vector<chunk<int>*> owned_chunks{}; // The chunks this thread popped, but did not push back yet.
+
+            for (std::size_t j = 0; j < number_of_rounds; j++) {
+                // Pop a few chunks, and mark them as owned by this thread.
+                for (std::size_t k = 0; k < 1 + j % 3; k++) {
+                    if (auto* popped_chunk = free_list.pop()) {
+                        popped_chunk->m_data = static_cast<int>(i);
+                        owned_chunks.push_back(popped_chunk);
+                    }
+                }
+
+                // If another thread got the same chunk, it has overwritten the mark.
+                for (auto* owned_chunk : owned_chunks)
+                    number_of_corruptions += owned_chunk->m_data != static_cast<int>(i);
+
+                // Push all the chunks back, for them to be stolen by the other threads.
+                for (auto* owned_chunk : owned_chunks)
+                    free_list.push(owned_chunk);
+
+                owned_chunks.clear();
+            }
+        });
+    }
+
+    for (auto& single_thread : worker_threads)
+        single_thread.join();
+
+    ASSERT_EQ(std::size_t{0}, number_of_corruptions.load(), "A chunk was popped by two threads at the same time!")
+
+    std::set<chunk<int>*> unique_addresses{}; // All the chunks that are left on the free list. No chunk may be lost or duplicated.
+
+    while (auto* popped_chunk = free_list.pop())
+        unique_addresses.insert(popped_chunk);
+
+    ASSERT_EQ(number_of_chunks, unique_addresses.size(), "The free list lost or duplicated a chunk!")
+
+    single_block.remove_chunk_list(); // Deallocate the block.
+
+    std::cout << "---- END LOCK-FREE FREE LIST STRESS TEST ----" << std::endl;
+}
+
+// This static method validates the statistics of the benchmark engine on known samples, and a measurement with its calibrated iterations.
+void allocator_tester::benchmark_validate_statistics() {
+    std::cout << "---- BENCHMARK ENGINE VALIDATOR STATISTICS ----" << std::endl;
+    std::cout << "Initializing... Summarising the samples 1 up to 100, in a shuffled order, and an outlier..." << std::endl;
+
+    std::vector<double> known_samples(100); // The samples 1 up to 100. Their statistics are known exactly.
+    std::iota(known_samples.begin(), known_samples.end(), 1.0);
+    std::rotate(known_samples.begin(), known_samples.begin() + 37, known_samples.end()); // The engine must sort the samples itself.
+
+    auto known_summary = benchmark_engine::summarize(known_samples); // The statistics of the known samples.
+
+    ASSERT_EQ(std::size_t{100}, known_summary.m_number_of_samples, "Every sample must be summarised!")
+    ASSERT_EQ(1.0, known_summary.m_minimum, "The minimum must be the fastest sample!")
+    ASSERT_EQ(100.0, known_summary.m_maximum, "The maximum must be the slowest sample!")
+    ASSERT_EQ(50.5, known_summary.m_median, "The median of an even number of samples lies between the two middle samples!")
+    ASSERT_EQ(50.5, known_summary.m_mean, "The mean must be the sum divided by the number of samples!")
+    ASSERT_TRUE(std::abs(known_summary.m_p90 - 90.1) < 1e-9, "The 90th percentile must be interpolated between the samples around it!")
+    ASSERT_TRUE(std::abs(known_summary.m_p99 - 99.01) < 1e-9, "The 99th percentile must be interpolated between the samples around it!")
+    ASSERT_TRUE(std::abs(known_summary.m_standard_deviation - 29.011491975882016) < 1e-9, "The standard deviation must divide by the number of samples minus one!")
+    ASSERT_TRUE(known_summary.m_confidence_low < known_summary.m_mean && known_summary.m_mean < known_summary.m_confidence_high, "The confidence interval must surround the mean!")
+    ASSERT_TRUE(std::abs((known_summary.m_confidence_high - known_summary.m_mean) - 1.960 * 29.011491975882016 / 10.0) < 1e-9, "The confidence interval of many samples must be 1.96 standard errors wide!")
+
+    // A single outlier drags the mean along, but hardly moves the median.
+    *std::max_element(known_samples.begin(), known_samples.end()) = 1'000'000.0; // The slowest sample becomes an outlier.
+    auto outlier_summary = benchmark_engine::summarize(known_samples); // The statistics with an outlier.
+
+    ASSERT_EQ(known_summary.m_median, outlier_summary.m_median, "A single outlier may not move the median!")
+    ASSERT_TRUE(outlier_summary.m_mean > 1000.0 * known_summary.m_mean / 100.0, "A single outlier must drag the mean along!")
+
+    auto single_summary = benchmark_engine::summarize({42.0}); // A single sample has no spread at all.
+    ASSERT_TRUE(single_summary.m_median == 42.0 && single_summary.m_p99 == 42.0 && single_summary.m_standard_deviation == 0.0, "A single sample must be every percentile, without any spread!")
+    ASSERT_EQ(std::size_t{0}, benchmark_engine::summarize({}).m_number_of_samples, "Without samples, the summary must stay empty!")
+
+    std::cout << "Initializing... Measuring an empty workload with 3 warmup iterations and 5 samples of at least 100 microseconds..." << std::endl;
+
+    benchmark_options calibrated_options{}; // The options of a short measurement.
+    calibrated_options.m_warmup_iterations = 3;
+    calibrated_options.m_number_of_samples = 5;
+    calibrated_options.m_minimum_sample_time = std::chrono::microseconds{100};
+
+    // Measure with the steady clock, and with the time stamp counter where the processor has one.
+    for (auto use_cycle_counter : {false, true}) {
+        calibrated_options.m_use_cycle_counter = use_cycle_counter;
+        benchmark_engine engine{calibrated_options}; // The engine that measures the workload.
+
+        std::size_t number_of_calls = 0; // The number of times the workload ran.
+        auto calibrated_summary = engine.measure([&] () { number_of_calls++; }); // An iteration takes far less than a microsecond.
+
+        ASSERT_EQ(std::size_t{5}, calibrated_summary.m_number_of_samples, "The engine must take the specified number of samples!")
+        ASSERT_TRUE(calibrated_summary.m_iterations_per_sample > 1, "A sample of a short workload must be calibrated to many iterations!")
+        ASSERT_TRUE(number_of_calls >= 3 + 5 * calibrated_summary.m_iterations_per_sample, "The engine must run the warmup iterations and all the iterations of every sample!")
+        ASSERT_TRUE(calibrated_summary.m_minimum <= calibrated_summary.m_median && calibrated_summary.m_median <= calibrated_summary.m_p99, "The percentiles must be in order!")
+    }
+
+    std::cout << "---- END BENCHMARK ENGINE VALIDATOR STATISTICS ----" << std::endl;
+}
+
+// This static method validates the latency histogram: its relative error, its percentiles, merging, and the queries of the benchmark statistics.
+void allocator_tester::benchmark_validate_histogram() {
+    std::cout << "---- BENCHMARK VALIDATOR LATENCY HISTOGRAM ----" << std::endl;
+    std::cout << "Initializing... Recording the latencies 1 up to 10000 nanoseconds, and a single spike of 5 milliseconds..." << std::endl;
+
+    latency_histogram latencies{}; // The histogram under test.
+
+    ASSERT_EQ(std::uint64_t{0}, latencies.get_percentile(0.99), "An empty histogram must report zero!")
+
+    for (std::uint64_t single_latency = 1; single_latency <= 10'000; single_latency++)
+        latencies.record(single_latency);
+
+    ASSERT_EQ(std::uint64_t{10'000}, latencies.get_count(), "Every latency must be counted!")
+    ASSERT_EQ(std::uint64_t{1}, latencies.get_minimum(), "The minimum must be exact!")
+    ASSERT_EQ(std::uint64_t{10'000}, latencies.get_maximum(), "The maximum must be exact!")
+    ASSERT_TRUE(std::abs(latencies.get_mean() - 5000.5) < 1e-9, "The mean must be exact!")
+    ASSERT_EQ(std::uint64_t{50}, latencies.get_percentile(0.005), "Small latencies must have a bucket of their own!")
+
+    // Every percentile is at least the exact value, and at most 1/32 above it.
+    for (auto fraction : {0.5, 0.9, 0.99, 0.999}) {
+        auto exact_latency = fraction * 10'000.0; // The exact percentile of the latencies 1 up to 10000.
+        auto reported_latency = static_cast<double>(latencies.get_percentile(fraction)); // The percentile of the histogram.
+
+        ASSERT_TRUE(reported_latency >= exact_latency && reported_latency <= exact_latency * (1.0 + 1.0 / 32.0), "A percentile must be within the relative error of the buckets!")
+    }
+
+    ASSERT_EQ(std::uint64_t{10'000}, latencies.get_percentile(1.0), "The highest percentile may not exceed the maximum!")
+
+    // A single spike only shows in the highest percentile, the mean would hide it.
+    latency_histogram spike_latencies{}; // The histogram of another run, with a single spike.
+    spike_latencies.record(5'000'000);
+    latencies.merge(spike_latencies);
+
+    ASSERT_EQ(std::uint64_t{10'001}, latencies.get_count(), "Merging must add the counts!")
+    ASSERT_EQ(std::uint64_t{5'000'000}, latencies.get_maximum(), "Merging must keep the highest maximum!")
+    ASSERT_EQ(std::uint64_t{5'000'000}, latencies.get_percentile(1.0), "The spike must be the highest percentile!")
+    ASSERT_TRUE(latencies.get_percentile(0.999) <= 10'000 * 33 / 32, "A single spike in 10001 latencies may not move the 99.9th percentile!")
+
+    std::cout << "Initializing... Adding the latencies to the statistics of a benchmark..." << std::endl;
+
+    benchmark_statistics statistic{benchmark_statistics::statistics_recognition::memory_pool}; // The statistics that expose the percentiles.
+    statistic.add_latencies(benchmark_statistics::latency_operation::allocate, latencies);
+    statistic.add_latencies(benchmark_statistics::latency_operation::allocate, spike_latencies);
+
+    ASSERT_EQ(std::uint64_t{10'002}, statistic.get_latencies(benchmark_statistics::latency_operation::allocate).get_count(), "The latencies of all the runs must be merged!")
+    ASSERT_EQ(latencies.get_percentile(0.5), statistic.get_latency_percentile(benchmark_statistics::latency_operation::allocate, 0.5), "The statistics must answer the same percentile as the histogram!")
+    ASSERT_EQ(std::uint64_t{0}, statistic.get_latency_percentile(benchmark_statistics::latency_operation::deallocate, 0.999), "The deallocations must have a histogram of their own!")
+
+    std::cout << "---- END BENCHMARK VALIDATOR LATENCY HISTOGRAM ----" << std::endl;
+}
+
+// This static method validates the allocation traces: writing and mapping a trace file, a broken file, and replaying an incomplete trace against several allocators.
+void allocator_tester::trace_validate_replay() {
+    std::cout << "---- TRACE VALIDATOR REPLAY ----" << std::endl;
+    std::cout << "Initializing... Writing a trace with a deallocation from before the recording, a reused address and a leak..." << std::endl;
+
+    auto trace_path = (std::filesystem::temp_directory_path() / "allocator_tester.trace").string(); // The trace file under test.
+
+    // Address 1 is freed and handed out again, address 2 was handed out again without a free, address 3 never existed, and address 4 leaks.
+    std::vector<trace_record> known_records{
+        {0, 1, 100, 0, trace_operation::allocate, {}},
+        {1, 2, 5000, 1, trace_operation::allocate, {}},
+        {2, 3, 0, 1, trace_operation::deallocate, {}},
+        {3, 1, 0, 0, trace_operation::deallocate, {}},
+        {4, 1, 0, 0, trace_operation::allocate, {}},
+        {5, 2, 24, 2, trace_operation::allocate, {}},
+        {6, 4, 64, 0, trace_operation::allocate, {}},
+        {7, 1, 0, 0, trace_operation::deallocate, {}},
+        {8, 2, 0, 2, trace_operation::deallocate, {}}
+    };
+
+    allocation_trace::write(trace_path, known_records);
+
+    {
+        allocation_trace known_trace{trace_path}; // The mapped trace.
+
+        ASSERT_EQ(known_records.size(), known_trace.size(), "Every record must be mapped!")
+        ASSERT_TRUE(std::equal(known_trace.begin(), known_trace.end(), known_records.begin(), [] (const trace_record& mapped, const trace_record& written) { return mapped.m_identifier == written.m_identifier && mapped.m_size == written.m_size && mapped.m_operation == written.m_operation; }), "The mapped records must be the written records!")
+
+        trace_replayer known_replayer{known_trace}; // The replayer of the incomplete trace.
+
+        ASSERT_EQ(std::size_t{1}, known_replayer.get_number_of_skipped(), "A deallocation from before the recording must be skipped!")
+        ASSERT_EQ(std::size_t{3}, known_replayer.get_number_of_threads(), "Every thread must be counted once!")
+        ASSERT_EQ(std::size_t{10}, known_replayer.get_number_of_operations(), "The reused address and the leak must be given back as well!")
+
+        std::cout << "Initializing... Replaying the trace against 'malloc', the size classes and an arena..." << std::endl;
+
+        malloc_allocator<std::byte> malloc_bytes{}; // An allocator that must get back every allocation.
+        known_replayer.replay(malloc_bytes);
+
+        size_class_allocator<std::byte> size_class_bytes{}; // An allocator that needs the size of every deallocation.
+        known_replayer.replay(size_class_bytes);
+
+        monotonic_arena replay_arena{}; // The arena never gives back, but must still be replayable.
+        arena_allocator<std::byte> arena_bytes{replay_arena};
+        known_replayer.replay(arena_bytes);
+
+        // At its peak, the trace holds the 100 bytes and the 5000 bytes. The empty allocation and the 24 bytes only come after they are given back.
+        malloc_allocator<std::byte> footprint_bytes{}; // A new allocator for the footprint.
+        auto footprint = known_replayer.measure_footprint(footprint_bytes); // The footprint of the trace.
+
+        ASSERT_EQ(std::size_t{5000 + 100}, footprint.m_peak_live_bytes, "The peak must be the highest number of bytes at the same time!")
+    }
+
+    std::cout << "Initializing... Replaying a 'realloc' in place, as the recorder writes it..." << std::endl;
+
+    // A 'realloc' that shrinks address 1 in place is recorded as the deallocation of the old size, directly followed by the allocation of the new size.
+    trace_replayer realloc_replayer{std::vector<trace_record>{
+        {0, 1, 1000, 0, trace_operation::allocate, {}},
+        {1, 1, 0, 0, trace_operation::deallocate, {}},
+        {1, 1, 500, 0, trace_operation::allocate, {}},
+        {2, 1, 0, 0, trace_operation::deallocate, {}}
+    }};
+
+    ASSERT_EQ(std::size_t{0}, realloc_replayer.get_number_of_skipped(), "A 'realloc' in place must not skip a deallocation!")
+    ASSERT_EQ(std::size_t{4}, realloc_replayer.get_number_of_operations(), "A 'realloc' in place must be replayed as a deallocation and an allocation!")
+
+    malloc_allocator<std::byte> realloc_bytes{}; // A new allocator for the footprint of the 'realloc'.
+    ASSERT_EQ(std::size_t{1000}, realloc_replayer.measure_footprint(realloc_bytes).m_peak_live_bytes, "The old and the new size of a 'realloc' may not be live at the same time!")
+
+    std::cout << "Initializing... Cutting off the last record, and breaking the header..." << std::endl;
+
+    std::filesystem::resize_file(trace_path, sizeof(trace_header) + known_records.size() * sizeof(trace_record) - 7);
+    ASSERT_EQ(known_records.size() - 1, allocation_trace{trace_path}.size(), "A record that is cut off must be ignored!")
+
+    {
+        std::fstream broken_file{trace_path, std::ios::binary | std::ios::in | std::ios::out}; // The trace file, with another magic.
+        broken_file.write("NOTATRACE", 8);
+    }
+
+    bool broken_rejected = false; // True when the broken header is rejected.
+
+    try {
+        allocation_trace broken_trace{trace_path};
+    }
+    catch (const std::runtime_error&) {
+        broken_rejected = true;
+    }
+
+    ASSERT_TRUE(broken_rejected, "A file without the header of a trace must be rejected!")
+
+    std::filesystem::remove(trace_path);
+
+    std::cout << "---- END TRACE VALIDATOR REPLAY ----" << std::endl;
+}
+
+// This static method validates the pattern generator: every pattern frees every allocation exactly once, the sizes follow their distribution, and a seed always generates the same pattern.
+void allocator_tester::pattern_validate_generator() {
+    std::cout << "---- PATTERN VALIDATOR GENERATOR ----" << std::endl;
+    std::cout << "Initializing... Generating every pattern with every distribution of sizes, of 1000 allocations..." << std::endl;
+
+    for (auto pattern : {allocation_pattern::fifo, allocation_pattern::lifo, allocation_pattern::random_free, allocation_pattern::producer_consumer, allocation_pattern::sawtooth, allocation_pattern::steady_state_churn}) {
+        for (auto distribution : {size_distribution::fixed, size_distribution::uniform, size_distribution::power_law, size_distribution::bimodal}) {
+            pattern_options options{pattern, distribution, 1000, 16, 4096, 42}; // The options under test.
+            auto records = pattern_generator{options}.generate(); // The generated pattern.
+
+            std::unordered_map<std::uint64_t, std::size_t> live_sizes{}; // The size of every allocation that is not freed yet.
+            std::size_t number_of_allocations = 0; // The allocations within the pattern.
+            std::size_t peak_live = 0; // The highest number of allocations at the same time.
+            std::size_t number_of_small = 0; // The allocations of at most twice the minimum size.
+            bool is_consistent = true; // True while every deallocation belongs to a live allocation.
+
+            for (const auto& single_record : records) {
+                if (single_record.m_operation == trace_operation::allocate) {
+                    is_consistent = is_consistent && live_sizes.emplace(single_record.m_identifier, single_record.m_size).second;
+                    number_of_allocations++;
+                    number_of_small += single_record.m_size <= 32 ? 1 : 0;
+                    peak_live = std::max(peak_live, live_sizes.size());
+
+                    ASSERT_TRUE(single_record.m_size >= options.m_minimum_size && single_record.m_size <= options.m_maximum_size, "A size must be between the minimum and the maximum!")
+                    ASSERT_TRUE(distribution != size_distribution::fixed || single_record.m_size == options.m_minimum_size, "A fixed size must be the minimum size!")
+                }
+                else {
+                    is_consistent = is_consistent && live_sizes.erase(single_record.m_identifier) == 1;
+                }
+            }
+
+            ASSERT_TRUE(is_consistent, "Every deallocation must belong to an allocation that is not freed yet!")
+            ASSERT_EQ(std::size_t{1000}, number_of_allocations, "A pattern must make exactly the allocations of its options!")
+            ASSERT_TRUE(live_sizes.empty(), "A pattern must free every allocation!")
+
+            // Most sizes of a power law and of the bimodal distribution are small, far more than the 16 in 4081 of a uniform distribution.
+            if (distribution == size_distribution::power_law || distribution == size_distribution::bimodal)
+                ASSERT_TRUE(number_of_small > 400, "Most sizes of a power law or a bimodal distribution must be small!")
+
+            if (pattern == allocation_pattern::steady_state_churn)
+                ASSERT_EQ(std::size_t{125}, peak_live, "The churn must keep a live set of an eighth of the allocations!")
+
+            if (pattern == allocation_pattern::sawtooth)
+                ASSERT_EQ(std::size_t{250}, peak_live, "The sawtooth must grow up to a quarter of the allocations!")
+
+            trace_replayer pattern_replayer{records}; // The generated pattern must be replayable as it is.
+
+            ASSERT_EQ(std::size_t{0}, pattern_replayer.get_number_of_skipped(), "A generated pattern may not skip a deallocation!")
+            ASSERT_EQ(std::size_t{2000}, pattern_replayer.get_number_of_operations(), "A generated pattern must replay every call once!")
+            ASSERT_EQ(std::size_t{pattern == allocation_pattern::producer_consumer ? 2u : 1u}, pattern_replayer.get_number_of_threads(), "Only the producer and the consumer run on threads of their own!")
+
+            size_class_allocator<std::byte> size_class_bytes{}; // An allocator that needs the size of every deallocation.
+            pattern_replayer.replay(size_class_bytes);
+        }
+    }
+
+    std::cout << "Initializing... Checking the order of the deallocations, and the seeds..." << std::endl;
+
+    // The first deallocation of a FIFO pattern frees the first allocation, of a LIFO pattern the last one.
+    auto fifo_records = pattern_generator{pattern_options{allocation_pattern::fifo, size_distribution::fixed, 10, 16, 16, 1}}.generate(); // A small FIFO pattern.
+    auto lifo_records = pattern_generator{pattern_options{allocation_pattern::lifo, size_distribution::fixed, 10, 16, 16, 1}}.generate(); // A small LIFO pattern.
+
+    ASSERT_EQ(fifo_records[0].m_identifier, fifo_records[10].m_identifier, "A FIFO pattern must free the first allocation first!")
+    ASSERT_EQ(lifo_records[9].m_identifier, lifo_records[10].m_identifier, "A LIFO pattern must free the last allocation first!")
+
+    // This compares the identifiers and the sizes of two patterns.
+    auto same_records = [] (const std::vector<trace_record>& first_records, const std::vector<trace_record>& second_records) {
+        return std::equal(first_records.begin(), first_records.end(), second_records.begin(), second_records.end(), [] (const trace_record& first, const trace_record& second) { return first.m_identifier == second.m_identifier && first.m_size == second.m_size; });
+    };
+
+    pattern_options seeded_options{allocation_pattern::random_free, size_distribution::power_law, 1000, 16, 4096, 7}; // A random pattern.
+    pattern_generator seeded_generator{seeded_options}; // The generator of the random pattern.
+
+    ASSERT_TRUE(same_records(seeded_generator.generate(), pattern_generator{seeded_options}.generate()), "The same seed must generate the same pattern!")
+
+    seeded_options.m_seed = 8;
+    ASSERT_TRUE(!same_records(seeded_generator.generate(), pattern_generator{seeded_options}.generate()), "Another seed must generate another pattern!")
+
+    bool invalid_rejected = false; // True when a maximum below the minimum is rejected.
+
+    try {
+        pattern_generator invalid_generator{pattern_options{allocation_pattern::fifo, size_distribution::uniform, 10, 64, 32, 1}};
+    }
+    catch (const std::invalid_argument&) {
+        invalid_rejected = true;
+    }
+
+    ASSERT_TRUE(invalid_rejected, "A maximum size below the minimum size must be rejected!")
+
+    std::cout << "---- END PATTERN VALIDATOR GENERATOR ----" << std::endl;
+}
+
+// This static method validates the scalability mode: every number of threads of the sweep gets a result for both scenarios, also with pinned threads and a number of threads that is not a power of two.
+void allocator_tester::scalability_validate_sweep() {
+    std::cout << "---- SCALABILITY VALIDATOR SWEEP ----" << std::endl;
+    std::cout << "Initializing... Sweeping the lock-free memory pool over 1 and 3 pinned threads..." << std::endl;
+
+    benchmark_options sweep_options{}; // A small sweep. In the cross-thread scenario, 3 threads hand their chunks around a ring of an odd length.
+    sweep_options.m_thread_counts = {1, 3};
+    sweep_options.m_pin_threads = true;
+
+    allocator_benchmark sweep_benchmarker{{1}, {1}, 1, sweep_options}; // The benchmarker under test.
+    auto sweep_statistic = sweep_benchmarker.benchmark_scalability_pool_lock_free(); // The results of the sweep.
+    const auto& sweep_results = sweep_statistic.get_all_results(); // The results, first the local scenario and then the cross-thread scenario.
+
+    ASSERT_EQ(std::size_t{4}, sweep_results.size(), "Every number of threads must have a result for both scenarios!")
+
+    std::vector<std::tuple<std::string, std::size_t>> expected_results{{"local_1", 1}, {"local_3", 3}, {"cross_thread_1", 1}, {"cross_thread_3", 3}}; // The names and the numbers of threads of the results.
+
+    for (std::size_t i = 0; i < std::min(sweep_results.size(), expected_results.size()); i++) {
+        ASSERT_EQ(std::get<0>(expected_results[i]), std::get<0>(sweep_results[i]), "A result must be named after its scenario and its number of threads!")
+        ASSERT_EQ(std::get<1>(expected_results[i]), std::get<1>(sweep_results[i]), "A result must be plotted at its number of threads!")
+        ASSERT_TRUE(std::get<2>(sweep_results[i]) > 0.0, "The throughput must be positive!")
+    }
+
+    std::cout << "---- END SCALABILITY VALIDATOR SWEEP ----" << std::endl;
+}
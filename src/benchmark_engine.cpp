@@ -0,0 +1,146 @@
+#include "benchmark_engine.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <array> // Include here all the 'array' facilities.
+#include <cmath> // Include here all the 'cmath' facilities.
+#include <numeric> // Include here all the 'numeric' facilities.
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h> // Include here all the 'x86intrin' facilities, for reading the time stamp counter.
+#define ALLOCATOR_HAS_CYCLE_COUNTER 1
+#else
+#define ALLOCATOR_HAS_CYCLE_COUNTER 0
+#endif
+
+// This is the constructor of the 'benchmark_clock' class. The time stamp counter is calibrated against the steady clock right away.
+benchmark_clock::benchmark_clock(bool use_cycle_counter) :
+    m_use_cycle_counter{use_cycle_counter && ALLOCATOR_HAS_CYCLE_COUNTER},
+    m_nanoseconds_per_tick{1.0}
+{
+    if (!m_use_cycle_counter)
+        return;
+
+    // Count the cycles during 10 milliseconds of the steady clock. Waiting actively keeps the processor at its speed.
+    static constexpr std::uint64_t calibration_time = 10'000'000; // The calibration time, in nanoseconds.
+
+    auto steady_begin = read_steady_clock(); // The start time of the steady clock.
+    auto cycles_begin = read_cycle_counter(); // The start time of the time stamp counter.
+    auto steady_end = steady_begin; // The end time of the steady clock.
+
+    while (steady_end - steady_begin < calibration_time)
+        steady_end = read_steady_clock();
+
+    auto cycles_end = read_cycle_counter(); // The end time of the time stamp counter.
+
+    // A counter that does not move can not be used, then keep the steady clock.
+    if (cycles_end <= cycles_begin) {
+        m_use_cycle_counter = false;
+        return;
+    }
+
+    m_nanoseconds_per_tick = static_cast<double>(steady_end - steady_begin) / static_cast<double>(cycles_end - cycles_begin);
+}
+
+// This method reads the clock.
+std::uint64_t benchmark_clock::now() const noexcept {
+    return m_use_cycle_counter ? read_cycle_counter() : read_steady_clock();
+}
+
+// This method converts a number of ticks to nanoseconds.
+double benchmark_clock::to_nanoseconds(std::uint64_t number_of_ticks) const noexcept {
+    return static_cast<double>(number_of_ticks) * m_nanoseconds_per_tick;
+}
+
+// This method tells if this clock reads the time stamp counter.
+bool benchmark_clock::is_cycle_counter() const noexcept {
+    return m_use_cycle_counter;
+}
+
+// This method reads the steady clock in nanoseconds.
+std::uint64_t benchmark_clock::read_steady_clock() noexcept {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// This method reads the time stamp counter of the processor.
+std::uint64_t benchmark_clock::read_cycle_counter() noexcept {
+#if ALLOCATOR_HAS_CYCLE_COUNTER
+    return __rdtsc();
+#else
+    return read_steady_clock(); // Without a time stamp counter, this is never called.
+#endif
+}
+
+// This is the constructor of the 'benchmark_engine' class.
+benchmark_engine::benchmark_engine(const benchmark_options &options) :
+    m_options{options},
+    m_clock{options.m_use_cycle_counter}
+{
+    // At least a single sample is needed for any statistic.
+    m_options.m_number_of_samples = std::max(m_options.m_number_of_samples, std::size_t{1});
+}
+
+// This method summarises the samples of a measurement.
+benchmark_summary benchmark_engine::summarize(std::vector<double> samples, std::size_t iterations_per_sample) {
+    benchmark_summary summary{}; // The statistics of the samples.
+    summary.m_number_of_samples = samples.size();
+    summary.m_iterations_per_sample = iterations_per_sample;
+
+    // Without any samples, all the statistics stay zero.
+    if (samples.empty())
+        return summary;
+
+    std::sort(samples.begin(), samples.end());
+
+    summary.m_minimum = samples.front();
+    summary.m_median = percentile(samples, 0.5);
+    summary.m_p90 = percentile(samples, 0.9);
+    summary.m_p99 = percentile(samples, 0.99);
+    summary.m_maximum = samples.back();
+    summary.m_mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+
+    // The standard deviation divides by the number of samples minus one, because the mean is estimated from the same samples.
+    if (samples.size() > 1) {
+        auto sum_of_squares = std::accumulate(samples.begin(), samples.end(), 0.0, [&] (double sum, double sample) { return sum + (sample - summary.m_mean) * (sample - summary.m_mean); });
+        summary.m_standard_deviation = std::sqrt(sum_of_squares / static_cast<double>(samples.size() - 1));
+    }
+
+    auto margin = critical_value(samples.size() - 1) * summary.m_standard_deviation / std::sqrt(static_cast<double>(samples.size())); // Half the width of the confidence interval.
+    summary.m_confidence_low = summary.m_mean - margin;
+    summary.m_confidence_high = summary.m_mean + margin;
+
+    return summary;
+}
+
+// This method returns the clock that the engine measures with.
+const benchmark_clock &benchmark_engine::get_clock() const noexcept {
+    return m_clock;
+}
+
+// This method returns the options of the engine.
+const benchmark_options &benchmark_engine::get_options() const noexcept {
+    return m_options;
+}
+
+// This method returns the percentile of sorted samples, interpolated between the two samples around it.
+double benchmark_engine::percentile(const std::vector<double> &sorted_samples, double fraction) noexcept {
+    auto position = fraction * static_cast<double>(sorted_samples.size() - 1); // The position of the percentile, between two samples.
+    auto lower_index = static_cast<std::size_t>(position); // The sample at or below the percentile.
+    auto upper_index = std::min(lower_index + 1, sorted_samples.size() - 1); // The sample above the percentile.
+    auto weight = position - static_cast<double>(lower_index); // How close the percentile is to the upper sample.
+
+    return sorted_samples[lower_index] + weight * (sorted_samples[upper_index] - sorted_samples[lower_index]);
+}
+
+// This method returns the critical value of the Student t-distribution for a two-sided 95% confidence interval.
+double benchmark_engine::critical_value(std::size_t degrees_of_freedom) noexcept {
+    // The values for up to 30 degrees of freedom. Above that, the normal distribution is close enough.
+    static constexpr std::array<double, 30> critical_values{12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                                            2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                                            2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+
+    // With a single sample there is no interval at all, its standard deviation is zero.
+    if (degrees_of_freedom == 0)
+        return 0.0;
+
+    return degrees_of_freedom <= critical_values.size() ? critical_values[degrees_of_freedom - 1] : 1.960;
+}
@@ -20,7 +20,9 @@ void benchmark_plot_generator::generate_matlab_plot() const {
     auto pool_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistic) { return statistic.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_pool; })->get_all_results(); // Get all the results of the benchmark with the memory pool.
     auto malloc_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistics) { return statistics.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_malloc; })->get_all_results(); // Get all the results of the benchmark with the 'malloc' allocator.
     auto mmap_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistics) { return statistics.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_mmap; })->get_all_results(); // Get all the results of the benchmark with the 'mmap' allocator.
+    auto mmap_cached_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistics) { return statistics.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_mmap_cached; })->get_all_results(); // Get all the results of the benchmark with the cached 'mmap' allocator.
     auto new_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistics) { return statistics.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_new; })->get_all_results(); // Get all the results of the benchmark with the 'new' allocator.
+    auto arena_result_vec = std::find_if(m_statistics.begin(), m_statistics.end(), [] (const benchmark_statistics& statistics) { return statistics.get_total_identifier() == benchmark_statistics::statistics_recognition::memory_arena; })->get_all_results(); // Get all the results of the benchmark with the monotonic arena allocator.
 
     output_file_string << "%% ADVANCED_PROGRAMMING_CONCEPTS_ALLOCATOR\n\nmemory_sizes = ["; // Here, create a section within your MATLAB-script.
 
@@ -50,6 +52,13 @@ void benchmark_plot_generator::generate_matlab_plot() const {
         output_file_string << std::get<2>(single_statistic) << ((*std::prev(mmap_result_vec.end()) != single_statistic) ? "," : ""); // Write everything to your MATLAB-script.
     });
 
+    output_file_string << "];\nmmap_cached_time = ["; // Here, create a new variable within the MATLAB-script.
+
+    // Get the different average running time values for the cached 'mmap' allocator.
+    std::for_each(mmap_cached_result_vec.begin(), mmap_cached_result_vec.end(), [&] (const std::tuple<std::string, std::size_t, double>& single_statistic) {
+        output_file_string << std::get<2>(single_statistic) << ((*std::prev(mmap_cached_result_vec.end()) != single_statistic) ? "," : ""); // Write everything to your MATLAB-script.
+    });
+
     output_file_string << "];\nnew_time = ["; // Here, create a new variable within the MATLAB-script.
 
     // Get the different average running time values for the 'new' allocator.
@@ -57,8 +66,68 @@ void benchmark_plot_generator::generate_matlab_plot() const {
         output_file_string << std::get<2>(single_statistic) << ((*std::prev(new_result_vec.end()) != single_statistic) ? "," : ""); // Write everything to your MATLAB-script.
     });
 
+    output_file_string << "];\narena_time = ["; // Here, create a new variable within the MATLAB-script.
+
+    // Get the different average running time values for the monotonic arena allocator.
+    std::for_each(arena_result_vec.begin(), arena_result_vec.end(), [&] (const std::tuple<std::string, std::size_t, double>& single_statistic) {
+        output_file_string << std::get<2>(single_statistic) << ((*std::prev(arena_result_vec.end()) != single_statistic) ? "," : ""); // Write everything to your MATLAB-script.
+    });
+
     // Here, you want to create nice graphs for your MATLAB script. You are doing this for all the specified variables, whereby all the lines are in the same plot. Also provide different names for the axis, with a legend and a title for the graph.
-    output_file_string << "];\n\nplot(memory_sizes, pool_time)\nhold on\nplot(memory_sizes, malloc_time)\nplot(memory_sizes, mmap_time)\nplot(memory_sizes, new_time)\n\ntitle(\"Execution time allocating memory\")\nxlabel(\"Number of runs\")\nylabel(\"Execution time allocating (microseconds)\")\nlegend(\"MEMORY POOL\", \"MALLOC\", \"MMAP\", \"NEW\")\n"; // You see that it is just a normal string that you have to write to a file.
+    output_file_string << "];\n\nplot(memory_sizes, pool_time)\nhold on\nplot(memory_sizes, malloc_time)\nplot(memory_sizes, mmap_time)\nplot(memory_sizes, mmap_cached_time)\nplot(memory_sizes, new_time)\nplot(memory_sizes, arena_time)\n\ntitle(\"Execution time allocating memory\")\nxlabel(\"Number of runs\")\nylabel(\"Execution time allocating (microseconds)\")\nlegend(\"MEMORY POOL\", \"MALLOC\", \"MMAP\", \"MMAP CACHED\", \"NEW\", \"ARENA\")\n"; // You see that it is just a normal string that you have to write to a file.
+
+    write_scalability_plot(output_file_string); // The throughput against the number of threads gets a figure of its own.
 
     output_file_string.close(); // Close the connection with your file (in our case, the MATLAB-script).
+}
+
+// This method writes a second figure to the MATLAB-script, with the throughput against the number of threads of every scalability benchmark.
+void benchmark_plot_generator::write_scalability_plot(std::ofstream &output_file_string) const {
+    // The scalability benchmarks with the names of their curves.
+    const std::vector<std::pair<benchmark_statistics::statistics_recognition, std::string>> scalability_curves{
+        {benchmark_statistics::statistics_recognition::scalability_pool_mutex, "pool_mutex"},
+        {benchmark_statistics::statistics_recognition::scalability_pool_magazines, "pool_magazines"},
+        {benchmark_statistics::statistics_recognition::scalability_pool_lock_free, "pool_lock_free"},
+        {benchmark_statistics::statistics_recognition::scalability_malloc, "malloc"},
+        {benchmark_statistics::statistics_recognition::scalability_new, "new"}
+    };
+
+    std::stringstream string_stream_legend{}; // The names of all the curves, in the order they are plotted.
+    bool has_figure = false; // True when the figure is started.
+
+    for (const auto& [identifier, curve_name] : scalability_curves) {
+        auto found_statistic = std::find_if(m_statistics.begin(), m_statistics.end(), [&] (const benchmark_statistics& statistic) { return statistic.get_total_identifier() == identifier; }); // The statistic of this benchmark.
+
+        if (found_statistic == m_statistics.end())
+            continue;
+
+        if (!has_figure)
+            output_file_string << "\n%% SCALABILITY\n\nfigure\nhold on\n"; // A new figure, so that the plot above stays as it is.
+
+        has_figure = true;
+
+        // Every scenario is a curve of its own. Its results are named after the scenario, followed by the number of threads.
+        for (const auto& scenario_name : {std::string{"local"}, std::string{"cross_thread"}}) {
+            std::stringstream string_stream_threads{}; // The numbers of threads of this curve.
+            std::stringstream string_stream_throughput{}; // The throughput of this curve.
+
+            for (const auto& single_statistic : found_statistic->get_all_results()) {
+                if (std::get<0>(single_statistic).rfind(scenario_name + "_", 0) != 0)
+                    continue;
+
+                string_stream_threads << (string_stream_threads.tellp() > 0 ? "," : "") << std::get<1>(single_statistic);
+                string_stream_throughput << (string_stream_throughput.tellp() > 0 ? "," : "") << std::get<2>(single_statistic);
+            }
+
+            output_file_string << curve_name << "_" << scenario_name << "_threads = [" << string_stream_threads.str() << "];\n";
+            output_file_string << curve_name << "_" << scenario_name << "_throughput = [" << string_stream_throughput.str() << "];\n";
+            output_file_string << "plot(" << curve_name << "_" << scenario_name << "_threads, " << curve_name << "_" << scenario_name << "_throughput, \"-o\")\n";
+
+            string_stream_legend << (string_stream_legend.tellp() > 0 ? ", " : "") << "\"" << curve_name << " " << scenario_name << "\"";
+        }
+    }
+
+    // The numbers of threads double, so a logarithmic axis shows them evenly.
+    if (has_figure)
+        output_file_string << "\nset(gca, \"XScale\", \"log\")\ntitle(\"Throughput against the number of threads\")\nxlabel(\"Number of threads\")\nylabel(\"Throughput (million calls per second)\")\nlegend(" << string_stream_legend.str() << ")\n";
 }
\ No newline at end of file
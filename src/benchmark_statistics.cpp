@@ -3,6 +3,8 @@
 // This is the constructor of the 'benchmark_statistics' class.
 benchmark_statistics::benchmark_statistics(const statistics_recognition &identifier_benchmark_section) :
     m_total_identifier{identifier_benchmark_section},
+    m_allocate_latencies{},
+    m_deallocate_latencies{},
     m_statistic_information{}
 {}
 
@@ -16,6 +18,21 @@ const std::vector<std::tuple<std::string, std::size_t, double>> &benchmark_stati
     return m_statistic_information; // Return a constant reference to the 'm_statistics_information' vector.
 }
 
+// This method adds the latencies of single calls to the histogram of their operation.
+void benchmark_statistics::add_latencies(const latency_operation &operation, const latency_histogram &latencies) {
+    (operation == latency_operation::allocate ? m_allocate_latencies : m_deallocate_latencies).merge(latencies);
+}
+
+// This method returns the histogram with the latencies of an operation.
+const latency_histogram &benchmark_statistics::get_latencies(const latency_operation &operation) const {
+    return operation == latency_operation::allocate ? m_allocate_latencies : m_deallocate_latencies;
+}
+
+// This method returns a percentile of the latencies of an operation, for instance the 99.9th percentile that service levels are set on.
+std::uint64_t benchmark_statistics::get_latency_percentile(const latency_operation &operation, double fraction) const {
+    return get_latencies(operation).get_percentile(fraction);
+}
+
 // This method returns the recognition of your total identifier
 const benchmark_statistics::statistics_recognition &benchmark_statistics::get_total_identifier() const {
     return m_total_identifier; // Return a constant reference to the 'm_total_identifier' field.
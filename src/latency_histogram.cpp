@@ -0,0 +1,92 @@
+#include "latency_histogram.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <bit> // Include here all the 'bit' facilities.
+#include <cmath> // Include here all the 'cmath' facilities.
+
+// This method records a single latency.
+void latency_histogram::record(std::uint64_t latency) noexcept {
+    m_counts[bucket_index(latency)]++;
+    m_total_count++;
+    m_minimum = std::min(m_minimum, latency);
+    m_maximum = std::max(m_maximum, latency);
+    m_sum += static_cast<long double>(latency);
+}
+
+// This method adds all the latencies of another histogram to this one.
+void latency_histogram::merge(const latency_histogram &other_histogram) noexcept {
+    for (std::size_t i = 0; i < bucket_count; i++)
+        m_counts[i] += other_histogram.m_counts[i];
+
+    m_total_count += other_histogram.m_total_count;
+    m_minimum = std::min(m_minimum, other_histogram.m_minimum);
+    m_maximum = std::max(m_maximum, other_histogram.m_maximum);
+    m_sum += other_histogram.m_sum;
+}
+
+// This method forgets all the recorded latencies.
+void latency_histogram::reset() noexcept {
+    *this = latency_histogram{};
+}
+
+// This method returns a percentile of the recorded latencies.
+std::uint64_t latency_histogram::get_percentile(double fraction) const noexcept {
+    if (m_total_count == 0)
+        return 0;
+
+    // The percentile is the latency with this rank, counted from the fastest latency. The rank is at least one, and at most the number of latencies.
+    auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(fraction, 0.0, 1.0) * static_cast<double>(m_total_count)));
+    rank = std::clamp(rank, std::uint64_t{1}, m_total_count);
+
+    std::uint64_t cumulative_count = 0; // The number of latencies up to and including the current bucket.
+
+    for (std::size_t i = 0; i < bucket_count; i++) {
+        cumulative_count += m_counts[i];
+
+        // The exact extremes are known, so a bucket never reports more than the highest latency.
+        if (cumulative_count >= rank)
+            return std::min(highest_latency(i), m_maximum);
+    }
+
+    return m_maximum;
+}
+
+// This method returns the number of recorded latencies.
+std::uint64_t latency_histogram::get_count() const noexcept {
+    return m_total_count;
+}
+
+// This method returns the lowest recorded latency.
+std::uint64_t latency_histogram::get_minimum() const noexcept {
+    return m_total_count == 0 ? 0 : m_minimum;
+}
+
+// This method returns the highest recorded latency.
+std::uint64_t latency_histogram::get_maximum() const noexcept {
+    return m_maximum;
+}
+
+// This method returns the mean of the recorded latencies.
+double latency_histogram::get_mean() const noexcept {
+    return m_total_count == 0 ? 0.0 : static_cast<double>(m_sum / static_cast<long double>(m_total_count));
+}
+
+// This method returns the bucket of a latency.
+std::size_t latency_histogram::bucket_index(std::uint64_t latency) noexcept {
+    // Below twice the number of sub buckets, every latency has a bucket of its own. Above that, the latency is shifted until only its highest bits are left.
+    auto magnitude = static_cast<std::size_t>(std::bit_width(latency)); // The number of significant bits.
+    auto shift = magnitude > sub_bucket_bits + 1 ? magnitude - sub_bucket_bits - 1 : 0; // The number of bits that are dropped.
+
+    return shift * sub_bucket_count + static_cast<std::size_t>(latency >> shift);
+}
+
+// This method returns the highest latency within a bucket.
+std::uint64_t latency_histogram::highest_latency(std::size_t index) noexcept {
+    if (index < 2 * sub_bucket_count)
+        return index;
+
+    auto shift = index / sub_bucket_count - 1; // The number of bits that were dropped.
+    auto highest_bits = static_cast<std::uint64_t>(index % sub_bucket_count + sub_bucket_count); // The bits that were kept.
+
+    return ((highest_bits + 1) << shift) - 1;
+}
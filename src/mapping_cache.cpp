@@ -0,0 +1,232 @@
+#include "mapping_cache.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <bit> // Include here all the 'bit' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <iterator> // Include here all the 'iterator' facilities.
+
+// This is the constructor of the 'mapping_cache' class.
+mapping_cache::mapping_cache(const std::size_t &high_water_mark) :
+    m_regions{},
+    m_buckets{},
+    m_mutex{},
+    m_cached_bytes{0},
+    m_high_water_mark{high_water_mark},
+    m_number_of_hits{0},
+    m_number_of_misses{0}
+{}
+
+// This is the destructor of the 'mapping_cache' class. It unmaps all the cached regions. The regions that are still allocated are not touched.
+mapping_cache::~mapping_cache() {
+    release();
+}
+
+// This method allocates a region of memory. A cached region is reused when it is big enough, otherwise a new region is mapped.
+void *mapping_cache::allocate(std::size_t number_of_bytes) {
+    auto region_size = memory_mapping::round_to_pages(std::max(number_of_bytes, std::size_t{1})); // Every region has at least a single page.
+
+    {
+        std::lock_guard<std::mutex> cache_lock{m_mutex};
+
+        // Search the bucket of this size first. Within a bucket, the smallest region that fits is found. Every region of a bigger bucket fits anyway.
+        for (auto bucket_index = find_bucket(region_size); bucket_index < number_of_buckets; bucket_index++) {
+            auto fitting_region = m_buckets[bucket_index].lower_bound({region_size, 0});
+
+            if (fitting_region != m_buckets[bucket_index].end()) {
+                m_number_of_hits++;
+                return take_region(m_regions.find(fitting_region->second), region_size);
+            }
+        }
+
+        m_number_of_misses++;
+    }
+
+    return memory_mapping::map_region(region_size, memory_mapping::page_size()); // Nothing fits, map a new region. The mutex is not needed for this.
+}
+
+// This method gives a region back to the cache. It is merged with the cached regions next to it.
+void mapping_cache::deallocate(void *memory, std::size_t number_of_bytes) noexcept {
+    auto region_size = memory_mapping::round_to_pages(std::max(number_of_bytes, std::size_t{1})); // The same size as it was allocated with.
+
+    // A region above the high-water mark would be unmapped right away anyway.
+    if (region_size > m_high_water_mark) {
+        memory_mapping::unmap_region(memory, region_size);
+        return;
+    }
+
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+
+    insert_region(reinterpret_cast<std::uintptr_t>(memory), region_size);
+    release_locked(m_high_water_mark); // Stay below the high-water mark.
+}
+
+// This method resizes a region. A region grows in place when the region right after it is cached, otherwise it is moved with 'mremap'. The content is kept.
+void *mapping_cache::reallocate(void *memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes) {
+    auto old_size = memory_mapping::round_to_pages(std::max(old_number_of_bytes, std::size_t{1})); // The size of the region right now.
+    auto new_size = memory_mapping::round_to_pages(std::max(new_number_of_bytes, std::size_t{1})); // The size of the resized region.
+    auto region_begin = reinterpret_cast<std::uintptr_t>(memory); // The first address of the region.
+
+    // A region that shrinks stays where it is, its last pages are given back to the cache.
+    if (new_size <= old_size) {
+        if (new_size < old_size)
+            deallocate(reinterpret_cast<void*>(region_begin + new_size), old_size - new_size);
+
+        return memory;
+    }
+
+    // The region does not have to move, when it can grow in place.
+    if (try_expand(memory, old_size, new_size))
+        return memory;
+
+    // Let the kernel move the pages to a bigger region.
+    if (auto* moved_memory = memory_mapping::remap_region(memory, old_size, new_size))
+        return moved_memory;
+
+    // 'mremap' can not move a region that was merged from several mappings. Then the content is copied to a new region.
+    auto* new_memory = allocate(new_size);
+    std::memcpy(new_memory, memory, old_size);
+    deallocate(memory, old_size);
+
+    return new_memory;
+}
+
+// This method grows a region in place, without moving it. First the cached region right after it is taken, otherwise the kernel tries to grow the mapping itself.
+bool mapping_cache::try_expand(void *memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes) noexcept {
+    auto old_size = memory_mapping::round_to_pages(std::max(old_number_of_bytes, std::size_t{1})); // The size of the region right now.
+    auto new_size = memory_mapping::round_to_pages(std::max(new_number_of_bytes, std::size_t{1})); // The size of the grown region.
+    auto region_begin = reinterpret_cast<std::uintptr_t>(memory); // The first address of the region.
+
+    // The last page of the region may already contain the new size.
+    if (new_size <= old_size)
+        return new_number_of_bytes <= old_size;
+
+    {
+        std::lock_guard<std::mutex> cache_lock{m_mutex};
+
+        // When the region right after this one is cached and big enough, take a part of it. The region grows in place, without any system call.
+        auto next_region = m_regions.find(region_begin + old_size);
+
+        if (next_region != m_regions.end() && next_region->second >= new_size - old_size) {
+            m_number_of_hits++;
+            take_region(next_region, new_size - old_size);
+            return true;
+        }
+    }
+
+    return memory_mapping::remap_region(memory, old_size, new_size, false) != nullptr; // The kernel only grows the region when the address space right after it is not mapped at all.
+}
+
+// This method unmaps cached regions, the biggest first, until the cache holds at most the given number of bytes.
+std::size_t mapping_cache::release(std::size_t kept_bytes) noexcept {
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+    return release_locked(kept_bytes);
+}
+
+// This method returns the number of bytes within the cached regions.
+std::size_t mapping_cache::get_cached_bytes() const noexcept {
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+    return m_cached_bytes;
+}
+
+// This method returns the number of cached regions. Regions next to each other count as a single region.
+std::size_t mapping_cache::get_number_of_cached_regions() const noexcept {
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+    return m_regions.size();
+}
+
+// This method returns the number of allocations that reused a cached region.
+std::size_t mapping_cache::get_number_of_hits() const noexcept {
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+    return m_number_of_hits;
+}
+
+// This method returns the number of allocations that had to map a new region.
+std::size_t mapping_cache::get_number_of_misses() const noexcept {
+    std::lock_guard<std::mutex> cache_lock{m_mutex};
+    return m_number_of_misses;
+}
+
+// This method finds the bucket of a region.
+std::size_t mapping_cache::find_bucket(std::size_t number_of_bytes) noexcept {
+    return static_cast<std::size_t>(std::bit_width(number_of_bytes / memory_mapping::page_size())) - 1; // The highest bit of the number of pages.
+}
+
+// This method adds a free region to the cache, and merges it with the cached regions next to it. When the cache can not keep it, it is unmapped.
+void mapping_cache::insert_region(std::uintptr_t region_begin, std::size_t region_size) noexcept {
+    auto next_region = m_regions.lower_bound(region_begin); // The first cached region after this region.
+
+    // Merge with the region right in front of this region.
+    if (next_region != m_regions.begin()) {
+        auto previous_region = std::prev(next_region);
+
+        if (previous_region->first + previous_region->second == region_begin) {
+            region_begin = previous_region->first;
+            region_size += previous_region->second;
+            erase_region(previous_region);
+        }
+    }
+
+    // Merge with the region right after this region.
+    if (next_region != m_regions.end() && region_begin + region_size == next_region->first) {
+        region_size += next_region->second;
+        erase_region(next_region);
+    }
+
+    try {
+        auto inserted_region = m_regions.emplace(region_begin, region_size).first;
+
+        try {
+            m_buckets[find_bucket(region_size)].emplace(region_size, region_begin);
+        }
+        catch (...) {
+            m_regions.erase(inserted_region); // Both containers must contain the same regions.
+            throw;
+        }
+
+        m_cached_bytes += region_size;
+    }
+    catch (...) {
+        memory_mapping::unmap_region(reinterpret_cast<void*>(region_begin), region_size); // The region could not be administrated, give it back to the operating system.
+    }
+}
+
+// This method removes a free region from the cache.
+void mapping_cache::erase_region(std::map<std::uintptr_t, std::size_t>::iterator cached_region) noexcept {
+    m_buckets[find_bucket(cached_region->second)].erase({cached_region->second, cached_region->first});
+    m_cached_bytes -= cached_region->second;
+    m_regions.erase(cached_region);
+}
+
+// This method takes the part of a cached region that is needed, and gives the rest back to the cache.
+void *mapping_cache::take_region(std::map<std::uintptr_t, std::size_t>::iterator cached_region, std::size_t number_of_bytes) noexcept {
+    auto region_begin = cached_region->first; // The first address of the region.
+    auto region_size = cached_region->second; // The number of bytes of the region.
+
+    erase_region(cached_region);
+
+    // Split the region, the rest stays in the cache.
+    if (region_size > number_of_bytes)
+        insert_region(region_begin + number_of_bytes, region_size - number_of_bytes);
+
+    return reinterpret_cast<void*>(region_begin);
+}
+
+// This method unmaps cached regions, the biggest first, until the cache holds at most the given number of bytes. The mutex must be locked.
+std::size_t mapping_cache::release_locked(std::size_t kept_bytes) noexcept {
+    std::size_t released_bytes{0}; // The number of bytes that are unmapped.
+
+    // Go through the buckets from the biggest to the smallest, and unmap the biggest region of every bucket first.
+    for (auto bucket_index = number_of_buckets; bucket_index > 0 && m_cached_bytes > kept_bytes; bucket_index--) {
+        auto& single_bucket = m_buckets[bucket_index - 1];
+
+        while (!single_bucket.empty() && m_cached_bytes > kept_bytes) {
+            auto [region_size, region_begin] = *std::prev(single_bucket.end());
+
+            erase_region(m_regions.find(region_begin));
+            memory_mapping::unmap_region(reinterpret_cast<void*>(region_begin), region_size);
+            released_bytes += region_size;
+        }
+    }
+
+    return released_bytes; // Return the number of bytes that were unmapped.
+}
@@ -0,0 +1,250 @@
+#include "memory_mapping.h"
+
+#include <atomic> // Include here all the 'atomic' facilities.
+#include <fstream> // Include here all the 'fstream' facilities.
+#include <iostream> // Include here all the 'iostream' facilities.
+#include <new> // Include here all the 'new' facilities.
+#include <cstdint> // Include here all the 'cstdint' facilities.
+#include <cstdlib> // Include here all the 'cstdlib' facilities.
+#include <cstring> // Include here all the 'cstring' facilities.
+#include <fcntl.h> // Include here all the 'fcntl' facilities.
+#include <sched.h> // Include here all the 'sched' facilities.
+#include <string> // Include here all the 'string' facilities.
+#include <sys/mman.h> // Include here all the 'sys/mman' facilities.
+#include <sys/syscall.h> // Include here all the 'sys/syscall' facilities.
+#include <unistd.h> // Include here all the 'unistd' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+namespace {
+    std::atomic<std::size_t> number_of_system_calls{0}; // The number of system calls made by 'memory_mapping', by all the threads together.
+
+    constexpr int numa_policy_bind = 2; // The policy 'MPOL_BIND' of 'mbind': the pages may only come from the given nodes.
+    constexpr unsigned long numa_flag_node = 1; // The flag 'MPOL_F_NODE' of 'get_mempolicy': return the node instead of the policy.
+    constexpr unsigned long numa_flag_address = 2; // The flag 'MPOL_F_ADDR' of 'get_mempolicy': look at the page of the given address.
+}
+
+// This method maps a new region of anonymous memory, that you can read from and write to.
+void* memory_mapping::map_region(std::size_t number_of_bytes, std::size_t alignment, page_mode mode) {
+    auto region_size = round_to_pages(number_of_bytes, mode); // You can only map whole pages.
+
+    // Explicit huge pages are always aligned to a huge page. When no huge page is left, use transparent huge pages instead.
+    if (mode == page_mode::explicit_huge && alignment <= huge_page_size()) {
+        number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+        auto* huge_memory = mmap(nullptr, region_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (huge_memory != MAP_FAILED)
+            return huge_memory;
+    }
+
+    // Transparent huge pages are only used for a region that is aligned to a huge page.
+    if (mode != page_mode::normal && alignment < huge_page_size())
+        alignment = huge_page_size();
+
+    auto extra_size = alignment > page_size() ? alignment : 0; // Only for big alignments, you need extra memory to shift the start of the region.
+
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+    auto* allocated_memory = mmap(nullptr, region_size + extra_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); // Allocate a new memory region with 'mmap'. You can read/write to this memory. Also, the mapping is not mapped to a file.
+
+    // Check if allocating new memory succeeded.
+    if (allocated_memory == MAP_FAILED)
+        throw std::bad_alloc(); // Allocating not succeeded. Throw this exception. Allowed within C++ -> allocating method.
+
+    // A page alignment is always satisfied by 'mmap'.
+    if (extra_size == 0)
+        return allocated_memory;
+
+    auto mapped_begin = reinterpret_cast<std::uintptr_t>(allocated_memory); // The start of the bigger region.
+    auto aligned_begin = (mapped_begin + alignment - 1) & ~(alignment - 1); // The first aligned address within the bigger region.
+    auto aligned_end = aligned_begin + region_size; // The end of the aligned region.
+    auto mapped_end = mapped_begin + region_size + extra_size; // The end of the bigger region.
+
+    // Give the memory in front of, and after the aligned region back.
+    if (aligned_begin != mapped_begin)
+        unmap_region(reinterpret_cast<void*>(mapped_begin), aligned_begin - mapped_begin);
+
+    if (mapped_end != aligned_end)
+        unmap_region(reinterpret_cast<void*>(aligned_end), mapped_end - aligned_end);
+
+    // Ask the kernel to back the region with huge pages. When it can not, for instance because they are disabled, the region simply keeps its normal pages.
+    if (mode != page_mode::normal) {
+        number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+        madvise(reinterpret_cast<void*>(aligned_begin), region_size, MADV_HUGEPAGE);
+    }
+
+    return reinterpret_cast<void*>(aligned_begin); // Return the aligned region.
+}
+
+// This method unmaps a region of memory, that was mapped with the 'map_region' method.
+void memory_mapping::unmap_region(void *memory, std::size_t number_of_bytes, page_mode mode) noexcept {
+    // Here, you unmap the just allocated memory. You are passing the first address of the allocated region, together with the number of bytes.
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+
+    if (munmap(memory, round_to_pages(number_of_bytes, mode)))
+        std::cerr << "Deallocating memory failed!" << std::endl; // If this function failed deallocating the memory, print this as standard error.
+}
+
+// This method resizes a region of normal pages with 'mremap'. The pages are moved by the kernel when the region does not fit at its address, so the content is never copied.
+void *memory_mapping::remap_region(void *memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes, bool may_move) noexcept {
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+    auto* resized_memory = mremap(memory, round_to_pages(old_number_of_bytes), round_to_pages(new_number_of_bytes), may_move ? MREMAP_MAYMOVE : 0);
+
+    return resized_memory == MAP_FAILED ? nullptr : resized_memory;
+}
+
+// This method gives the physical memory of a region back to the operating system, but keeps the region mapped. The next access reads zeros.
+bool memory_mapping::decommit_region(void *memory, std::size_t number_of_bytes) noexcept {
+    // With 'MADV_DONTNEED' the pages of a private anonymous mapping are dropped right away, and filled with zeros on the next access.
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+
+    if (madvise(memory, round_to_pages(number_of_bytes), MADV_DONTNEED)) {
+        std::cerr << "Decommitting memory failed!" << std::endl; // If this function failed decommitting the memory, print this as standard error.
+        return false;
+    }
+
+    return true;
+}
+
+// This method takes all the access rights of a region away, so that every access to it faults right away. It is used for guard pages.
+bool memory_mapping::protect_region(void *memory, std::size_t number_of_bytes) noexcept {
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+
+    if (mprotect(memory, round_to_pages(number_of_bytes), PROT_NONE)) {
+        std::cerr << "Protecting memory failed!" << std::endl; // If this function failed protecting the memory, print this as standard error.
+        return false;
+    }
+
+    return true;
+}
+
+// This method puts all the pages of a region in physical memory right away, so that the first accesses do not fault anymore. The content of the region is kept.
+void memory_mapping::prefault_region(void *memory, std::size_t number_of_bytes, page_mode mode) noexcept {
+    auto region_size = round_to_pages(number_of_bytes, mode); // You can only fault in whole pages.
+
+#ifdef MADV_POPULATE_WRITE
+    // Fault in all the pages, writable, within a single system call.
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+
+    if (!madvise(memory, region_size, MADV_POPULATE_WRITE))
+        return;
+#endif
+
+    // The kernel does not know this advice, so touch every page once. Writing back the same byte keeps the content.
+    for (std::size_t offset = 0; offset < region_size; offset += page_size()) {
+        auto* page_byte = static_cast<volatile char*>(memory) + offset;
+        *page_byte = *page_byte;
+    }
+}
+
+// This method counts the bytes of a region that are in physical memory right now.
+std::size_t memory_mapping::get_resident_bytes(const void *memory, std::size_t number_of_bytes) {
+    auto number_of_pages = round_to_pages(number_of_bytes) / page_size(); // 'mincore' tells the state of every normal page.
+    std::vector<unsigned char> page_states(number_of_pages); // The lowest bit of every state tells whether the page is resident.
+
+    if (mincore(const_cast<void*>(memory), number_of_pages * page_size(), page_states.data()))
+        return 0;
+
+    std::size_t resident_pages{0}; // The number of pages in physical memory.
+
+    for (const auto& single_state : page_states)
+        resident_pages += single_state & 1;
+
+    return resident_pages * page_size();
+}
+
+// This method returns the bytes of the whole process that are in physical memory right now, its resident set size. It does not allocate anything itself.
+std::size_t memory_mapping::get_process_resident_bytes() noexcept {
+    // The file contains the size of the process and its resident pages, for instance '1234 567 ...'. A stream would allocate, and disturb the allocator that is measured.
+    auto statm_file = open("/proc/self/statm", O_RDONLY | O_CLOEXEC);
+
+    if (statm_file < 0)
+        return 0;
+
+    char statm_content[128]{}; // The start of the file, the resident pages are the second number.
+    auto number_of_characters = read(statm_file, statm_content, sizeof(statm_content) - 1);
+    close(statm_file);
+
+    if (number_of_characters <= 0)
+        return 0;
+
+    auto* resident_pages = std::strchr(statm_content, ' '); // The resident pages follow the first space.
+
+    return resident_pages == nullptr ? 0 : std::strtoull(resident_pages + 1, nullptr, 10) * page_size();
+}
+
+// This method binds the pages of a region to a single NUMA node. It must be called before the pages are touched, otherwise they are already placed.
+bool memory_mapping::bind_region(void *memory, std::size_t number_of_bytes, std::size_t numa_node, page_mode mode) noexcept {
+    // With a single node, every page is on the right node anyway.
+    if (get_number_of_numa_nodes() <= 1)
+        return true;
+
+    constexpr std::size_t bits_per_mask = sizeof(unsigned long) * 8; // The number of nodes within a single word of the node mask.
+    std::vector<unsigned long> node_mask(numa_node / bits_per_mask + 1); // The node mask, with only the bit of the given node.
+
+    node_mask[numa_node / bits_per_mask] = 1UL << (numa_node % bits_per_mask);
+
+    // The kernel ignores the last bit of the mask, so it gets one bit more than the mask contains.
+    number_of_system_calls.fetch_add(1, std::memory_order_relaxed); // Count the system call below.
+    return syscall(SYS_mbind, memory, round_to_pages(number_of_bytes, mode), numa_policy_bind, node_mask.data(), node_mask.size() * bits_per_mask + 1, 0) == 0;
+}
+
+// This method finds the NUMA node that backs a page. The page is faulted in when it is not in physical memory yet.
+std::size_t memory_mapping::find_numa_node(const void *memory) noexcept {
+    int numa_node{0}; // The node of the page.
+
+    if (syscall(SYS_get_mempolicy, &numa_node, nullptr, 0, memory, numa_flag_node | numa_flag_address) != 0)
+        return any_numa_node;
+
+    return static_cast<std::size_t>(numa_node);
+}
+
+// This method returns the number of NUMA nodes of this machine.
+std::size_t memory_mapping::get_number_of_numa_nodes() noexcept {
+    // Ask the operating system only once. The file contains the online nodes, for instance '0-1' or '0,2'. The highest node is at the end.
+    static const auto number_of_numa_nodes = [] () -> std::size_t {
+        std::ifstream online_file{"/sys/devices/system/node/online"};
+        std::string online_nodes{};
+
+        if (!std::getline(online_file, online_nodes) || online_nodes.empty())
+            return 1;
+
+        auto last_separator = online_nodes.find_last_of("-,"); // The highest node follows the last separator.
+        auto highest_node = online_nodes.substr(last_separator == std::string::npos ? 0 : last_separator + 1);
+
+        // Only a plain number is a node, otherwise assume a single node.
+        if (highest_node.empty() || highest_node.find_first_not_of("0123456789") != std::string::npos)
+            return 1;
+
+        return std::stoul(highest_node) + 1;
+    }();
+
+    return number_of_numa_nodes;
+}
+
+// This method returns the NUMA node of the processor that runs the calling thread.
+std::size_t memory_mapping::get_current_numa_node() noexcept {
+    unsigned int current_cpu{0}; // The processor of the calling thread.
+    unsigned int current_node{0}; // The node of this processor.
+
+    // 'getcpu' goes through the vDSO, so it does not enter the kernel. A node outside of the online nodes is never used.
+    if (getcpu(&current_cpu, &current_node) != 0 || current_node >= get_number_of_numa_nodes())
+        return 0;
+
+    return current_node;
+}
+
+// This method returns the size of a single page of memory.
+std::size_t memory_mapping::page_size() noexcept {
+    static const auto system_page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE)); // Ask the operating system only once.
+    return system_page_size;
+}
+
+// This method rounds a number of bytes up to whole pages.
+std::size_t memory_mapping::round_to_pages(std::size_t number_of_bytes, page_mode mode) noexcept {
+    auto rounding_size = mode == page_mode::normal ? page_size() : huge_page_size(); // Both huge page modes use whole huge pages.
+    return (number_of_bytes + rounding_size - 1) / rounding_size * rounding_size; // Round up to the next multiple of the page size.
+}
+
+// This method returns the number of system calls ('mmap', 'munmap', 'mremap', 'madvise', 'mprotect' and 'mbind') that this class made so far, by all the threads together.
+std::size_t memory_mapping::get_number_of_system_calls() noexcept {
+    return number_of_system_calls.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,129 @@
+#include "memory_resources.h"
+
+#include <new> // Include here all the 'new' facilities.
+
+#include "memory_mapping.h" // Include here all the 'memory_mapping' facilities.
+
+// This method allocates memory with 'malloc'.
+void *malloc_memory_resource::do_allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    // 'malloc' is aligned to 'std::max_align_t'. Only a bigger alignment needs 'aligned_alloc', whose size must be a multiple of the alignment.
+    if (alignment <= alignof(std::max_align_t))
+        return m_allocator.allocate(number_of_bytes);
+
+    if (auto* allocated_memory = std::aligned_alloc(alignment, (number_of_bytes + alignment - 1) / alignment * alignment))
+        return allocated_memory;
+
+    throw std::bad_alloc(); // Allocating failed, throw this exception.
+}
+
+// This method deallocates memory with 'free'.
+void malloc_memory_resource::do_deallocate(void *memory, std::size_t number_of_bytes, [[maybe_unused]] std::size_t alignment) {
+    m_allocator.deallocate(static_cast<std::byte*>(memory), number_of_bytes); // 'free' also releases the memory of 'aligned_alloc'.
+}
+
+// This method compares this resource with another one.
+bool malloc_memory_resource::do_is_equal(const std::pmr::memory_resource &other_resource) const noexcept {
+    return dynamic_cast<const malloc_memory_resource*>(&other_resource) != nullptr; // Every 'malloc' resource can free the memory of another one.
+}
+
+// This method allocates memory with 'mmap'.
+void *mmap_memory_resource::do_allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    // 'mmap' is aligned to a page. Only a bigger alignment needs a bigger region, that is trimmed afterwards.
+    if (alignment <= memory_mapping::page_size())
+        return m_allocator.allocate(number_of_bytes);
+
+    return memory_mapping::map_region(number_of_bytes, alignment);
+}
+
+// This method deallocates memory with 'munmap'.
+void mmap_memory_resource::do_deallocate(void *memory, std::size_t number_of_bytes, [[maybe_unused]] std::size_t alignment) {
+    m_allocator.deallocate(static_cast<std::byte*>(memory), number_of_bytes); // The trimmed parts of a region are already unmapped, so both cases are the same.
+}
+
+// This method compares this resource with another one.
+bool mmap_memory_resource::do_is_equal(const std::pmr::memory_resource &other_resource) const noexcept {
+    return dynamic_cast<const mmap_memory_resource*>(&other_resource) != nullptr; // Every 'mmap' resource can unmap the memory of another one.
+}
+
+// This method allocates memory with 'new'.
+void *new_memory_resource::do_allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    // 'new' is aligned to the default alignment of the compiler. Only a bigger alignment needs the aligned 'new'.
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        return m_allocator.allocate(number_of_bytes);
+
+    return ::operator new(number_of_bytes, std::align_val_t{alignment});
+}
+
+// This method deallocates memory with 'delete'.
+void new_memory_resource::do_deallocate(void *memory, std::size_t number_of_bytes, std::size_t alignment) {
+    // The same alignment goes to the same 'delete'.
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+        m_allocator.deallocate(static_cast<std::byte*>(memory), number_of_bytes);
+        return;
+    }
+
+    ::operator delete(memory, number_of_bytes, std::align_val_t{alignment}); // The sized 'delete', just like the allocator.
+}
+
+// This method compares this resource with another one.
+bool new_memory_resource::do_is_equal(const std::pmr::memory_resource &other_resource) const noexcept {
+    return dynamic_cast<const new_memory_resource*>(&other_resource) != nullptr; // Every 'new' resource can delete the memory of another one.
+}
+
+// This method returns the table of memory pools of this resource.
+size_class_pool &pool_memory_resource::get_pool() noexcept {
+    return m_pool;
+}
+
+// This method allocates memory from the memory pool of the size class that fits.
+void *pool_memory_resource::do_allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    // A memory pool, and 'mmap' above it, align to at most a page. A bigger alignment needs a trimmed region of its own.
+    if (alignment > memory_mapping::page_size())
+        return memory_mapping::map_region(number_of_bytes, alignment);
+
+    return m_pool.allocate(number_of_bytes, alignment);
+}
+
+// This method gives memory back to the memory pool of its size class.
+void pool_memory_resource::do_deallocate(void *memory, std::size_t number_of_bytes, std::size_t alignment) {
+    // The same request goes to the same place.
+    if (alignment > memory_mapping::page_size()) {
+        memory_mapping::unmap_region(memory, number_of_bytes);
+        return;
+    }
+
+    m_pool.deallocate(memory, number_of_bytes, alignment);
+}
+
+// This method compares this resource with another one.
+bool pool_memory_resource::do_is_equal(const std::pmr::memory_resource &other_resource) const noexcept {
+    return this == &other_resource; // Only this resource owns its memory pools.
+}
+
+// This is the constructor of the 'arena_memory_resource' class.
+arena_memory_resource::arena_memory_resource(const std::size_t &block_size) :
+    m_arena{block_size}
+{}
+
+// This is the constructor of the 'arena_memory_resource' class. The arena starts within the given buffer.
+arena_memory_resource::arena_memory_resource(void *initial_buffer, const std::size_t &buffer_size, const std::size_t &block_size) :
+    m_arena{initial_buffer, buffer_size, block_size}
+{}
+
+// This method returns the arena of this resource, for instance to reset it.
+monotonic_arena &arena_memory_resource::get_arena() noexcept {
+    return m_arena;
+}
+
+// This method allocates memory by bumping the pointer of the arena.
+void *arena_memory_resource::do_allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    return m_arena.allocate(number_of_bytes, alignment);
+}
+
+// This method does nothing. The memory is given back when the arena is reset.
+void arena_memory_resource::do_deallocate([[maybe_unused]] void *memory, [[maybe_unused]] std::size_t number_of_bytes, [[maybe_unused]] std::size_t alignment) {}
+
+// This method compares this resource with another one.
+bool arena_memory_resource::do_is_equal(const std::pmr::memory_resource &other_resource) const noexcept {
+    return this == &other_resource; // Only this resource owns its arena.
+}
@@ -0,0 +1,140 @@
+#include "monotonic_arena.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <limits> // Include here all the 'limits' facilities.
+#include <new> // Include here all the 'new' facilities.
+
+// This is the constructor of the 'monotonic_arena' class. The first block is mapped on the first allocation.
+monotonic_arena::monotonic_arena(const std::size_t &block_size) :
+    monotonic_arena{nullptr, 0, block_size}
+{}
+
+// This is the constructor of the 'monotonic_arena' class. The arena starts within the given buffer, and only maps blocks when this buffer is full.
+monotonic_arena::monotonic_arena(void *initial_buffer, const std::size_t &buffer_size, const std::size_t &block_size) :
+    m_blocks{},
+    m_current_block{no_block},
+    m_current_position{reinterpret_cast<std::uintptr_t>(initial_buffer)},
+    m_current_end{reinterpret_cast<std::uintptr_t>(initial_buffer) + buffer_size},
+    m_initial_buffer{reinterpret_cast<std::uintptr_t>(initial_buffer)},
+    m_initial_size{buffer_size},
+    m_block_size{memory_mapping::round_to_pages(block_size)},
+    m_allocated_bytes{0}
+{}
+
+// This is the destructor of the 'monotonic_arena' class. It unmaps all the blocks.
+monotonic_arena::~monotonic_arena() {
+    release();
+}
+
+// This method allocates memory of any size and alignment, by bumping a pointer.
+void *monotonic_arena::allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    // Every request gets its own address, also a request of zero bytes.
+    if (number_of_bytes == 0)
+        number_of_bytes = 1;
+
+    // Most of the time the request fits in the current region. Otherwise, continue in the next block.
+    if (auto* allocated_memory = bump(number_of_bytes, alignment))
+        return allocated_memory;
+
+    return allocate_from_next_block(number_of_bytes, alignment);
+}
+
+// This method grows an allocation in place, by bumping the pointer further. This only succeeds for the last allocation, when the current region has room for it.
+bool monotonic_arena::try_expand(void *memory, std::size_t old_number_of_bytes, std::size_t new_number_of_bytes) noexcept {
+    auto allocation_begin = reinterpret_cast<std::uintptr_t>(memory); // The first address of the allocation.
+
+    // A request of zero bytes got a single byte.
+    old_number_of_bytes = std::max(old_number_of_bytes, std::size_t{1});
+
+    // An allocation that shrinks, or stays the same, always fits.
+    if (new_number_of_bytes <= old_number_of_bytes)
+        return true;
+
+    // Only the last allocation ends at the free address, and only the current region can grow.
+    if (allocation_begin + old_number_of_bytes != m_current_position || m_current_end - allocation_begin < new_number_of_bytes)
+        return false;
+
+    m_allocated_bytes += new_number_of_bytes - old_number_of_bytes;
+    m_current_position = allocation_begin + new_number_of_bytes; // Bump the pointer past the grown allocation.
+
+    return true;
+}
+
+// This method rewinds the arena to its start. All the memory is free again, but the blocks are kept for the next allocations.
+void monotonic_arena::reset() noexcept {
+    m_current_block = no_block; // Start again in the buffer of the caller (which may be empty).
+    m_current_position = m_initial_buffer;
+    m_current_end = m_initial_buffer + m_initial_size;
+    m_allocated_bytes = 0;
+}
+
+// This method rewinds the arena to its start, and unmaps all the blocks.
+void monotonic_arena::release() noexcept {
+    // Go through all the blocks, and give them back to the operating system.
+    for (const auto& single_block : m_blocks)
+        memory_mapping::unmap_region(reinterpret_cast<void*>(single_block.m_begin), single_block.m_size);
+
+    m_blocks.clear();
+    reset();
+}
+
+// This method returns the number of blocks that this arena mapped.
+std::size_t monotonic_arena::get_number_of_blocks() const noexcept {
+    return m_blocks.size();
+}
+
+// This method returns the number of bytes that were allocated since the last reset, including the padding for the alignment.
+std::size_t monotonic_arena::get_allocated_bytes() const noexcept {
+    return m_allocated_bytes;
+}
+
+// This method tries to bump the pointer within the current region.
+void *monotonic_arena::bump(std::size_t number_of_bytes, std::size_t alignment) noexcept {
+    auto aligned_position = (m_current_position + alignment - 1) & ~(alignment - 1); // Round the free address up to the alignment.
+
+    // Check if the request fits in the rest of the region. Compare the free space, so that nothing overflows.
+    if (aligned_position < m_current_position || aligned_position > m_current_end || m_current_end - aligned_position < number_of_bytes)
+        return nullptr;
+
+    m_allocated_bytes += aligned_position + number_of_bytes - m_current_position; // Also count the padding in front of the request.
+    m_current_position = aligned_position + number_of_bytes; // Bump the pointer past the request.
+
+    return reinterpret_cast<void*>(aligned_position);
+}
+
+// This method continues in the next block that is big enough, and maps a new block when no kept block fits.
+void *monotonic_arena::allocate_from_next_block(std::size_t number_of_bytes, std::size_t alignment) {
+    // First reuse the blocks that were kept by a reset. A block that is too small for this request is skipped until the next reset.
+    for (auto next_block = m_current_block + 1; next_block < m_blocks.size(); next_block++) {
+        enter_block(next_block);
+
+        if (auto* allocated_memory = bump(number_of_bytes, alignment))
+            return allocated_memory;
+    }
+
+    // A request that overflows with its alignment and its rounding to whole pages, never fits in any block.
+    if (number_of_bytes > std::numeric_limits<std::size_t>::max() - alignment - memory_mapping::page_size())
+        throw std::bad_alloc();
+
+    // No block is left, map a new one. A request bigger than a block gets a block of its own size.
+    auto new_size = number_of_bytes + alignment > m_block_size ? memory_mapping::round_to_pages(number_of_bytes + alignment) : m_block_size;
+    auto* new_memory = memory_mapping::map_region(new_size, memory_mapping::page_size());
+
+    try {
+        m_blocks.push_back(arena_block{reinterpret_cast<std::uintptr_t>(new_memory), new_size});
+    }
+    catch (...) {
+        memory_mapping::unmap_region(new_memory, new_size); // The block could not be administrated, give it back.
+        throw;
+    }
+
+    enter_block(m_blocks.size() - 1);
+    return bump(number_of_bytes, alignment); // This always fits, the block is big enough for the request and its alignment.
+}
+
+// This method makes the given block the current region.
+void monotonic_arena::enter_block(std::size_t block_index) noexcept {
+    m_current_block = block_index;
+    m_current_position = m_blocks[block_index].m_begin;
+    m_current_end = m_blocks[block_index].m_begin + m_blocks[block_index].m_size;
+}
@@ -0,0 +1,180 @@
+#include "pattern_generator.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <stdexcept> // Include here all the 'stdexcept' facilities.
+
+// This is the constructor of the 'pattern_generator' class.
+pattern_generator::pattern_generator(const pattern_options &options) :
+    m_options{options}
+{
+    if (m_options.m_minimum_size == 0 || m_options.m_minimum_size > m_options.m_maximum_size)
+        throw std::invalid_argument{"The sizes of a pattern must be between a minimum above zero and a maximum!"};
+}
+
+// This method generates the records of the pattern. Calling it again, generates exactly the same records.
+std::vector<trace_record> pattern_generator::generate() const {
+    generator_state state{std::mt19937_64{m_options.m_seed}, {}, 1}; // A new state, so that every call starts with the same seed.
+    state.m_records.reserve(2 * m_options.m_number_of_allocations);
+
+    auto number_of_allocations = m_options.m_number_of_allocations; // The allocations of the whole pattern.
+    std::vector<std::uint64_t> live_identifiers{}; // The allocations that are not freed yet.
+
+    switch (m_options.m_pattern) {
+        case allocation_pattern::fifo:
+        case allocation_pattern::lifo: {
+            for (std::size_t i = 0; i < number_of_allocations; i++)
+                live_identifiers.push_back(add_allocation(state, 0));
+
+            if (m_options.m_pattern == allocation_pattern::lifo)
+                std::reverse(live_identifiers.begin(), live_identifiers.end());
+
+            for (const auto& single_identifier : live_identifiers)
+                add_deallocation(state, single_identifier, 0);
+
+            live_identifiers.clear();
+            break;
+        }
+        case allocation_pattern::random_free: {
+            // The first half leaves a shuffled free list behind, the second half allocates from it.
+            for (auto round_allocations : {number_of_allocations - number_of_allocations / 2, number_of_allocations / 2}) {
+                for (std::size_t i = 0; i < round_allocations; i++)
+                    live_identifiers.push_back(add_allocation(state, 0));
+
+                std::shuffle(live_identifiers.begin(), live_identifiers.end(), state.m_random_generator);
+
+                for (const auto& single_identifier : live_identifiers)
+                    add_deallocation(state, single_identifier, 0);
+
+                live_identifiers.clear();
+            }
+
+            break;
+        }
+        case allocation_pattern::producer_consumer: {
+            std::size_t oldest_message = 0; // The index of the oldest message within the queue.
+
+            // Thread 0 produces up to 16 messages at once, thread 1 consumes up to 16 of the oldest ones.
+            for (std::size_t allocated = 0; allocated < number_of_allocations;) {
+                for (auto burst = 1 + state.m_random_generator() % 16; burst > 0 && allocated < number_of_allocations; burst--, allocated++)
+                    live_identifiers.push_back(add_allocation(state, 0));
+
+                for (auto burst = 1 + state.m_random_generator() % 16; burst > 0 && oldest_message < live_identifiers.size(); burst--)
+                    add_deallocation(state, live_identifiers[oldest_message++], 1);
+            }
+
+            // The consumer drains the queue.
+            for (; oldest_message < live_identifiers.size(); oldest_message++)
+                add_deallocation(state, live_identifiers[oldest_message], 1);
+
+            live_identifiers.clear();
+            break;
+        }
+        case allocation_pattern::sawtooth: {
+            auto peak = std::max(number_of_allocations / 4, std::size_t{4}); // The number of live allocations at the top of every tooth.
+
+            for (std::size_t allocated = 0; allocated < number_of_allocations;) {
+                for (; live_identifiers.size() < peak && allocated < number_of_allocations; allocated++)
+                    live_identifiers.push_back(add_allocation(state, 0));
+
+                while (live_identifiers.size() > peak / 4)
+                    free_random(state, live_identifiers);
+            }
+
+            break;
+        }
+        case allocation_pattern::steady_state_churn: {
+            auto live_size = std::min(std::max(number_of_allocations / 8, std::size_t{1}), number_of_allocations); // The size of the live set.
+
+            for (std::size_t i = 0; i < live_size; i++)
+                live_identifiers.push_back(add_allocation(state, 0));
+
+            // Every new object replaces a random object of the live set.
+            for (std::size_t i = live_size; i < number_of_allocations; i++) {
+                free_random(state, live_identifiers);
+                live_identifiers.push_back(add_allocation(state, 0));
+            }
+
+            break;
+        }
+    }
+
+    // Free what is left, in a random order.
+    while (!live_identifiers.empty())
+        free_random(state, live_identifiers);
+
+    return std::move(state.m_records);
+}
+
+// This static method returns the name of a pattern, as shown in the messages and the results.
+std::string pattern_generator::get_pattern_name(const allocation_pattern &pattern) {
+    switch (pattern) {
+        case allocation_pattern::fifo: return "fifo";
+        case allocation_pattern::lifo: return "lifo";
+        case allocation_pattern::random_free: return "random_free";
+        case allocation_pattern::producer_consumer: return "producer_consumer";
+        case allocation_pattern::sawtooth: return "sawtooth";
+        case allocation_pattern::steady_state_churn: return "steady_state_churn";
+    }
+
+    return "unknown";
+}
+
+// This static method returns the name of a distribution of sizes, as shown in the messages and the results.
+std::string pattern_generator::get_distribution_name(const size_distribution &distribution) {
+    switch (distribution) {
+        case size_distribution::fixed: return "fixed";
+        case size_distribution::uniform: return "uniform";
+        case size_distribution::power_law: return "power_law";
+        case size_distribution::bimodal: return "bimodal";
+    }
+
+    return "unknown";
+}
+
+// This method adds an allocation of a size from the distribution.
+std::uint64_t pattern_generator::add_allocation(generator_state &state, std::uint32_t thread) const {
+    auto minimum_size = static_cast<double>(m_options.m_minimum_size); // The smallest size, for the power law.
+    auto maximum_size = static_cast<double>(m_options.m_maximum_size); // The biggest size, for the power law.
+    std::size_t number_of_bytes = m_options.m_minimum_size; // The size of the allocation, fixed by default.
+
+    // This chooses a size between two bounds, both included.
+    auto uniform_size = [&] (std::size_t lowest_size, std::size_t highest_size) {
+        return std::uniform_int_distribution<std::size_t>{lowest_size, highest_size}(state.m_random_generator);
+    };
+
+    switch (m_options.m_distribution) {
+        case size_distribution::fixed:
+            break;
+        case size_distribution::uniform:
+            number_of_bytes = uniform_size(m_options.m_minimum_size, m_options.m_maximum_size);
+            break;
+        case size_distribution::power_law: {
+            // The inverse of the distribution function of a power law with an exponent of 2, cut off at the maximum size.
+            auto uniform_fraction = std::uniform_real_distribution<double>{0.0, 1.0}(state.m_random_generator); // A random fraction from 0 up to 1.
+            number_of_bytes = std::min(static_cast<std::size_t>(minimum_size / (1.0 - uniform_fraction * (1.0 - minimum_size / maximum_size))), m_options.m_maximum_size);
+            break;
+        }
+        case size_distribution::bimodal:
+            if (state.m_random_generator() % 10 != 0)
+                number_of_bytes = uniform_size(m_options.m_minimum_size, std::min(2 * m_options.m_minimum_size, m_options.m_maximum_size));
+            else
+                number_of_bytes = uniform_size(std::max(m_options.m_maximum_size / 2, m_options.m_minimum_size), m_options.m_maximum_size);
+            break;
+    }
+
+    state.m_records.push_back(trace_record{state.m_records.size(), state.m_next_identifier, number_of_bytes, thread, trace_operation::allocate, {}});
+
+    return state.m_next_identifier++;
+}
+
+// This method adds the deallocation of an allocation.
+void pattern_generator::add_deallocation(generator_state &state, std::uint64_t identifier, std::uint32_t thread) {
+    state.m_records.push_back(trace_record{state.m_records.size(), identifier, 0, thread, trace_operation::deallocate, {}});
+}
+
+// This method removes a random identifier from a list, and adds its deallocation.
+void pattern_generator::free_random(generator_state &state, std::vector<std::uint64_t> &live_identifiers) {
+    std::swap(live_identifiers[state.m_random_generator() % live_identifiers.size()], live_identifiers.back());
+    add_deallocation(state, live_identifiers.back(), 0);
+    live_identifiers.pop_back();
+}
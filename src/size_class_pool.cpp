@@ -0,0 +1,109 @@
+#include "size_class_pool.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+
+namespace {
+    /// This method creates the lookup table from a size in steps of 8 bytes to the index of its size class.
+    /// \return The lookup table. Element 'i' contains the size class for a request of '8 * i' bytes.
+    constexpr std::array<std::uint8_t, size_class_pool::max_pooled_size / 8 + 1> make_size_class_lookup() {
+        std::array<std::uint8_t, size_class_pool::max_pooled_size / 8 + 1> size_class_lookup{}; // The lookup table, all the steps of 8 bytes.
+        std::size_t class_index{0}; // The size class of the current step.
+
+        // Go through all the steps, and move to the next size class as soon as the current one is too small.
+        for (std::size_t i = 0; i < size_class_lookup.size(); i++) {
+            while (size_class_sizes[class_index] < i * 8)
+                class_index++;
+
+            size_class_lookup[i] = static_cast<std::uint8_t>(class_index);
+        }
+
+        return size_class_lookup; // Return the lookup table.
+    }
+
+    constexpr auto size_class_lookup = make_size_class_lookup(); // The lookup table, calculated at compile time.
+}
+
+// This is the constructor of the 'size_class_pool' class. The memory pools allocate their blocks on first use.
+size_class_pool::size_class_pool() :
+    m_pools{make_pools(std::make_index_sequence<size_class_sizes.size()>{})},
+    m_large_cache{},
+    m_large_allocator{m_large_cache}
+{}
+
+// This method creates a memory pool for every size class.
+template<std::size_t... Indices>
+size_class_pool::pool_tuple size_class_pool::make_pools(std::index_sequence<Indices...>) {
+    return pool_tuple{(bytes_per_block / size_class_sizes[Indices])...}; // Every memory pool gets blocks of the same number of bytes.
+}
+
+// This method creates a table with a function for every size class, that allocates a chunk from the memory pool of that class.
+template<std::size_t... Indices>
+constexpr std::array<void *(*)(size_class_pool::pool_tuple &), sizeof...(Indices)> size_class_pool::make_allocate_functions(std::index_sequence<Indices...>) {
+    return {[] (pool_tuple& pools) -> void* { return std::get<Indices>(pools).allocate(); }...}; // The chunk is a union, so its address is also the address of its data.
+}
+
+// This method creates a table with a function for every size class, that deallocates a chunk to the memory pool of that class.
+template<std::size_t... Indices>
+constexpr std::array<void (*)(size_class_pool::pool_tuple &, void *), sizeof...(Indices)> size_class_pool::make_deallocate_functions(std::index_sequence<Indices...>) {
+    return {[] (pool_tuple& pools, void* memory) { std::get<Indices>(pools).deallocate(static_cast<chunk<size_class_storage<size_class_sizes[Indices]>>*>(memory)); }...};
+}
+
+// This method allocates memory for a request of any size.
+void *size_class_pool::allocate(std::size_t number_of_bytes, std::size_t alignment) {
+    static constexpr auto allocate_functions = make_allocate_functions(std::make_index_sequence<size_class_sizes.size()>{}); // A function for every size class.
+
+    // The cache of the large requests only aligns to a page, so a bigger alignment gets a trimmed mapping of its own.
+    if (alignment > memory_mapping::page_size())
+        return memory_mapping::map_region(std::max(number_of_bytes, std::size_t{1}), alignment);
+
+    number_of_bytes = round_to_alignment(number_of_bytes, alignment);
+
+    // Requests above the largest size class are served by 'mmap'. It aligns to a page.
+    if (number_of_bytes > max_pooled_size)
+        return m_large_allocator.allocate(number_of_bytes);
+
+    return allocate_functions[find_size_class(number_of_bytes, alignment)](m_pools); // Allocate from the memory pool of the size class.
+}
+
+// This method deallocates memory, allocated with the 'allocate' method.
+void size_class_pool::deallocate(void *memory, std::size_t number_of_bytes, std::size_t alignment) noexcept {
+    static constexpr auto deallocate_functions = make_deallocate_functions(std::make_index_sequence<size_class_sizes.size()>{}); // A function for every size class.
+
+    // The same request goes to the same place, so large requests are unmapped again.
+    if (alignment > memory_mapping::page_size()) {
+        memory_mapping::unmap_region(memory, std::max(number_of_bytes, std::size_t{1}));
+        return;
+    }
+
+    number_of_bytes = round_to_alignment(number_of_bytes, alignment);
+
+    if (number_of_bytes > max_pooled_size) {
+        m_large_allocator.deallocate(static_cast<std::byte*>(memory), number_of_bytes);
+        return;
+    }
+
+    deallocate_functions[find_size_class(number_of_bytes, alignment)](m_pools, memory); // Deallocate to the memory pool of the size class.
+}
+
+// This method returns the pool that is used by default constructed allocators. It is never destroyed, so it can be used until the very end of the program.
+const std::shared_ptr<size_class_pool> &size_class_pool::default_pool() {
+    static const auto* shared_default_pool = new std::shared_ptr<size_class_pool>{std::make_shared<size_class_pool>()}; // Created once, and never destroyed on purpose.
+    return *shared_default_pool;
+}
+
+// This method rounds an over-aligned request up to a multiple of its alignment. The size class that fits it is then a multiple of the alignment as well, so its chunks are aligned enough.
+std::size_t size_class_pool::round_to_alignment(std::size_t number_of_bytes, std::size_t alignment) noexcept {
+    if (alignment <= alignof(std::max_align_t))
+        return number_of_bytes;
+
+    return number_of_bytes > max_pooled_size ? number_of_bytes : (std::max(number_of_bytes, std::size_t{1}) + alignment - 1) & ~(alignment - 1);
+}
+
+// This method returns the index of the size class for a request.
+std::size_t size_class_pool::find_size_class(std::size_t number_of_bytes, std::size_t alignment) noexcept {
+    // Only the smallest size class is aligned to less than 'std::max_align_t'. All the other classes are multiples of it.
+    if (alignment > size_class_sizes.front() && number_of_bytes < size_class_sizes[1])
+        number_of_bytes = size_class_sizes[1];
+
+    return size_class_lookup[(number_of_bytes + 7) / 8]; // Look up the size class, in steps of 8 bytes.
+}
@@ -0,0 +1,43 @@
+#include "thread_slot_registry.h"
+
+#include <mutex> // Include here all the 'mutex' facilities.
+#include <vector> // Include here all the 'vector' facilities.
+
+namespace {
+    std::mutex slot_mutex{}; // This mutex protects the administration of the slots. It is only used when a thread starts or exits.
+    std::vector<std::size_t> released_slots{}; // The slots of threads that already exited. These are handed out first.
+    std::size_t next_free_slot{0}; // The next slot that was never handed out before.
+
+    /// This structure 'slot_owner' acquires a slot when it is created, and releases it when its thread exits.
+    struct slot_owner {
+        /// This is the constructor of the 'slot_owner' structure. It acquires a free slot.
+        slot_owner() : m_slot{thread_slot_registry::no_thread_slot} {
+            std::lock_guard<std::mutex> slot_lock{slot_mutex}; // Only one thread may change the administration.
+
+            // Reuse the slot of a thread that already exited, otherwise take a new slot (if any is left).
+            if (!released_slots.empty()) {
+                m_slot = released_slots.back();
+                released_slots.pop_back();
+            }
+            else if (next_free_slot < thread_slot_registry::max_thread_slots)
+                m_slot = next_free_slot++;
+        }
+
+        /// This is the destructor of the 'slot_owner' structure. It releases the slot, so that a new thread can use it.
+        ~slot_owner() {
+            // Threads without a slot have nothing to release.
+            if (m_slot != thread_slot_registry::no_thread_slot) {
+                std::lock_guard<std::mutex> slot_lock{slot_mutex}; // Only one thread may change the administration.
+                released_slots.push_back(m_slot);
+            }
+        }
+
+        std::size_t m_slot; // This field contains the slot of the owning thread.
+    };
+}
+
+// This method returns the slot of the calling thread. The first call within a thread acquires the slot.
+std::size_t thread_slot_registry::current_slot() noexcept {
+    thread_local slot_owner current_owner{}; // Every thread has its own owner, created on first use and destroyed when the thread exits.
+    return current_owner.m_slot; // Return the slot of this thread.
+}
@@ -0,0 +1,96 @@
+#include "trace_replayer.h"
+
+#include <algorithm> // Include here all the 'algorithm' facilities.
+#include <span> // Include here all the 'span' facilities.
+#include <unordered_map> // Include here all the 'unordered_map' facilities.
+#include <unordered_set> // Include here all the 'unordered_set' facilities.
+
+// This is the constructor of the 'trace_replayer' class. It translates the identifiers of the trace to slots.
+trace_replayer::trace_replayer(const allocation_trace &trace) :
+    trace_replayer{trace.begin(), trace.end()}
+{}
+
+// This is the constructor of the 'trace_replayer' class, for records that are not within a file, for instance a generated pattern.
+trace_replayer::trace_replayer(const std::vector<trace_record> &records) :
+    trace_replayer{records.data(), records.data() + records.size()}
+{}
+
+// This is the constructor of the 'trace_replayer' class, that the other constructors delegate to. It translates the identifiers of the records to slots.
+trace_replayer::trace_replayer(const trace_record *first_record, const trace_record *last_record) :
+    m_operations{},
+    m_number_of_slots{0},
+    m_number_of_threads{0},
+    m_number_of_skipped{0}
+{
+    std::unordered_map<std::uint64_t, replay_operation> live_allocations{}; // The allocations that are not given back yet, by their identifier.
+    std::unordered_set<std::uint32_t> trace_threads{}; // All the different threads of the trace.
+    std::vector<std::uint32_t> free_slots{}; // The slots that can be used again, the last one given back is used first.
+
+    m_operations.reserve(static_cast<std::size_t>(last_record - first_record));
+
+    // This gives back an allocation, and frees its slot.
+    auto give_back = [&] (const replay_operation& allocation) {
+        m_operations.push_back(replay_operation{allocation.m_size, allocation.m_slot, false});
+        free_slots.push_back(allocation.m_slot);
+    };
+
+    for (const auto& single_record : std::span{first_record, last_record}) {
+        trace_threads.insert(single_record.m_thread);
+
+        if (single_record.m_operation == trace_operation::deallocate) {
+            auto found_allocation = live_allocations.find(single_record.m_identifier);
+
+            // The allocation is from before the recording.
+            if (found_allocation == live_allocations.end()) {
+                m_number_of_skipped++;
+                continue;
+            }
+
+            give_back(found_allocation->second);
+            live_allocations.erase(found_allocation);
+            continue;
+        }
+
+        // An address that is handed out again, must have been given back without a record. Give it back first.
+        if (auto found_allocation = live_allocations.find(single_record.m_identifier); found_allocation != live_allocations.end()) {
+            give_back(found_allocation->second);
+            live_allocations.erase(found_allocation);
+        }
+
+        // Use a free slot, or take a new one.
+        auto slot = static_cast<std::uint32_t>(m_number_of_slots); // The slot of this allocation.
+
+        if (free_slots.empty())
+            m_number_of_slots++;
+        else {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        }
+
+        // Every allocation gets its own memory, also an allocation of zero bytes.
+        replay_operation allocation{std::max(static_cast<std::size_t>(single_record.m_size), std::size_t{1}), slot, true};
+        m_operations.push_back(allocation);
+        live_allocations.emplace(single_record.m_identifier, allocation);
+    }
+
+    // Give back all the allocations that the trace never gave back, so that the allocator is empty after a replay.
+    for (const auto& [identifier, allocation] : live_allocations)
+        give_back(allocation);
+
+    m_number_of_threads = trace_threads.size();
+}
+
+// This method returns the number of calls that are replayed, including the deallocations at the end.
+std::size_t trace_replayer::get_number_of_operations() const noexcept {
+    return m_operations.size();
+}
+
+// This method returns the number of different threads within the trace.
+std::size_t trace_replayer::get_number_of_threads() const noexcept {
+    return m_number_of_threads;
+}
+
+// This method returns the number of deallocations that are skipped, because their allocation is not within the trace.
+std::size_t trace_replayer::get_number_of_skipped() const noexcept {
+    return m_number_of_skipped;
+}